@@ -5,15 +5,33 @@
 
 #include "YOLOObjectDetectorModel.h"
 #include "core/VisionDataTypes.h"
+#include "core/PerformanceMonitor.h"
 #include <opencv2/opencv.hpp>
 #include <opencv2/dnn.hpp>
 #include <QFileInfo>
 #include <QFile>
 #include <QTextStream>
+#include <QElapsedTimer>
 #include <algorithm>
 
 namespace VisionBox {
 
+namespace {
+
+// Network contexts used at once by parallel tile execution
+constexpr int kMaxTileContexts = 4;
+
+BoxNms::Params nmsParams(float scoreThreshold, float nmsThreshold, bool soft)
+{
+    BoxNms::Params params;
+    params.scoreThreshold = scoreThreshold;
+    params.iouThreshold = nmsThreshold;
+    params.soft = soft;
+    return params;
+}
+
+} // namespace
+
 /*******************************************************************************
  * Constructor
  ******************************************************************************/
@@ -90,6 +108,49 @@ YOLOObjectDetectorModel::YOLOObjectDetectorModel()
     backendLayout->addWidget(m_backendCombo);
     layout->addLayout(backendLayout);
 
+    // Warm-up inferences after loading
+    auto* warmupLayout = new QHBoxLayout();
+    warmupLayout->addWidget(new QLabel("Warm-up Runs:"));
+    m_warmupSpin = new QSpinBox();
+    m_warmupSpin->setRange(0, 10);
+    m_warmupSpin->setValue(m_warmupRuns);
+    m_warmupSpin->setToolTip("Dummy inferences run after loading so the first frame is not slow");
+    warmupLayout->addWidget(m_warmupSpin);
+    layout->addLayout(warmupLayout);
+
+    // Pipelined inference (overlaps consecutive frames on worker threads)
+    auto* pipelineLayout = new QHBoxLayout();
+    m_pipelinedCheck = new QCheckBox("Pipelined Inference");
+    m_pipelinedCheck->setChecked(m_pipelined);
+    m_pipelinedCheck->setToolTip("Preprocess, forward and postprocess consecutive frames in parallel.\n"
+                                 "Raises throughput on streams; results arrive one frame later.");
+    pipelineLayout->addWidget(m_pipelinedCheck);
+    pipelineLayout->addWidget(new QLabel("Workers:"));
+    m_workersSpin = new QSpinBox();
+    m_workersSpin->setRange(1, 4);
+    m_workersSpin->setValue(m_inferenceWorkers);
+    m_workersSpin->setToolTip("Concurrent forward passes (each uses its own network context)");
+    pipelineLayout->addWidget(m_workersSpin);
+    layout->addLayout(pipelineLayout);
+
+    // Batching (pipelined mode only)
+    auto* batchLayout = new QHBoxLayout();
+    batchLayout->addWidget(new QLabel("Batch Size:"));
+    m_batchSpin = new QSpinBox();
+    m_batchSpin->setRange(1, 16);
+    m_batchSpin->setValue(m_batchSize);
+    m_batchSpin->setToolTip("Frames per forward pass in pipelined mode, gathered from this node\n"
+                            "and other nodes running the same model (1 = no batching)");
+    batchLayout->addWidget(m_batchSpin);
+    batchLayout->addWidget(new QLabel("Max Wait:"));
+    m_batchWaitSpin = new QSpinBox();
+    m_batchWaitSpin->setRange(0, 200);
+    m_batchWaitSpin->setSuffix(" ms");
+    m_batchWaitSpin->setValue(m_batchWaitMs);
+    m_batchWaitSpin->setToolTip("Longest a frame waits for its batch to fill");
+    batchLayout->addWidget(m_batchWaitSpin);
+    layout->addLayout(batchLayout);
+
     // Confidence threshold
     auto* confLayout = new QHBoxLayout();
     confLayout->addWidget(new QLabel("Confidence:"));
@@ -108,6 +169,11 @@ YOLOObjectDetectorModel::YOLOObjectDetectorModel()
     m_nmsSpin->setSingleStep(0.05);
     m_nmsSpin->setValue(0.4);
     nmsLayout->addWidget(m_nmsSpin);
+    m_softNmsCheck = new QCheckBox("Soft-NMS");
+    m_softNmsCheck->setChecked(m_softNms);
+    m_softNmsCheck->setToolTip("Lower the scores of overlapping boxes instead of removing them\n"
+                               "(keeps more objects in crowds)");
+    nmsLayout->addWidget(m_softNmsCheck);
     layout->addLayout(nmsLayout);
 
     // Visualization options
@@ -119,6 +185,69 @@ YOLOObjectDetectorModel::YOLOObjectDetectorModel()
     m_showLabelsCheck->setChecked(true);
     layout->addWidget(m_showLabelsCheck);
 
+    m_letterboxCheck = new QCheckBox("Letterbox (keep aspect ratio)");
+    m_letterboxCheck->setChecked(m_letterbox);
+    m_letterboxCheck->setToolTip("Scale uniformly and pad instead of stretching to the input size.\n"
+                                 "YOLOv5/8 are trained letterboxed, Darknet YOLOv3/v4 usually stretched.");
+    layout->addWidget(m_letterboxCheck);
+
+    // Tiled inference (small objects in high-resolution frames)
+    m_tiledCheck = new QCheckBox("Tiled Inference");
+    m_tiledCheck->setChecked(m_tiled);
+    m_tiledCheck->setToolTip("Detect on overlapping tiles at native resolution and merge the\n"
+                             "results with a class-aware NMS (for 4K-8K frames)");
+    layout->addWidget(m_tiledCheck);
+
+    auto* tileLayout = new QHBoxLayout();
+    tileLayout->addWidget(new QLabel("Tile:"));
+    m_tileSizeSpin = new QSpinBox();
+    m_tileSizeSpin->setRange(128, 4096);
+    m_tileSizeSpin->setSingleStep(32);
+    m_tileSizeSpin->setSuffix(" px");
+    m_tileSizeSpin->setValue(m_tileSize);
+    tileLayout->addWidget(m_tileSizeSpin);
+    tileLayout->addWidget(new QLabel("Overlap:"));
+    m_tileOverlapSpin = new QSpinBox();
+    m_tileOverlapSpin->setRange(0, 50);
+    m_tileOverlapSpin->setSuffix(" %");
+    m_tileOverlapSpin->setValue(m_tileOverlap);
+    tileLayout->addWidget(m_tileOverlapSpin);
+    layout->addLayout(tileLayout);
+
+    auto* tileModeLayout = new QHBoxLayout();
+    m_tileExecutionCombo = new QComboBox();
+    m_tileExecutionCombo->addItem("Batched", 0);
+    m_tileExecutionCombo->addItem("Parallel", 1);
+    m_tileExecutionCombo->setToolTip("Batched: one forward pass over all tiles (needs a model with a\n"
+                                     "dynamic batch size). Parallel: one forward pass per tile.");
+    tileModeLayout->addWidget(m_tileExecutionCombo);
+    m_tileFullFrameCheck = new QCheckBox("Full Frame Pass");
+    m_tileFullFrameCheck->setChecked(m_tileFullFrame);
+    m_tileFullFrameCheck->setToolTip("Also detect on the whole frame, for objects larger than a tile");
+    tileModeLayout->addWidget(m_tileFullFrameCheck);
+    layout->addLayout(tileModeLayout);
+
+    // Detection cadence (track between keyframes)
+    auto* cadenceLayout = new QHBoxLayout();
+    cadenceLayout->addWidget(new QLabel("Detect Every:"));
+    m_detectIntervalSpin = new QSpinBox();
+    m_detectIntervalSpin->setRange(1, 60);
+    m_detectIntervalSpin->setSuffix(" frames");
+    m_detectIntervalSpin->setValue(m_detectInterval);
+    m_detectIntervalSpin->setToolTip("Run the network on every Nth frame and track the boxes\n"
+                                     "on the frames in between (1 = every frame)");
+    cadenceLayout->addWidget(m_detectIntervalSpin);
+    cadenceLayout->addWidget(new QLabel("Scene Change:"));
+    m_sceneChangeSpin = new QDoubleSpinBox();
+    m_sceneChangeSpin->setRange(0.0, 255.0);
+    m_sceneChangeSpin->setSingleStep(5.0);
+    m_sceneChangeSpin->setDecimals(0);
+    m_sceneChangeSpin->setValue(m_sceneChangeThreshold);
+    m_sceneChangeSpin->setToolTip("Detect at once when the frame's mean gray level differs this\n"
+                                  "much from the last keyframe (0 = off)");
+    cadenceLayout->addWidget(m_sceneChangeSpin);
+    layout->addLayout(cadenceLayout);
+
     // Load button
     m_loadBtn = new QPushButton("Load Model");
     m_loadBtn->setEnabled(false);
@@ -129,6 +258,12 @@ YOLOObjectDetectorModel::YOLOObjectDetectorModel()
     m_statusLabel->setStyleSheet("QLabel { padding: 5px; }");
     layout->addWidget(m_statusLabel);
 
+    // Load progress (visible while loading)
+    m_loadProgress = new QProgressBar();
+    m_loadProgress->setRange(0, 100);
+    m_loadProgress->setVisible(false);
+    layout->addWidget(m_loadProgress);
+
     // Info text
     m_infoText = new QTextEdit();
     m_infoText->setReadOnly(true);
@@ -151,14 +286,116 @@ YOLOObjectDetectorModel::YOLOObjectDetectorModel()
             this, &YOLOObjectDetectorModel::onConfidenceChanged);
     connect(m_nmsSpin, QOverload<double>::of(&QDoubleSpinBox::valueChanged),
             this, &YOLOObjectDetectorModel::onNmsThresholdChanged);
+    connect(m_softNmsCheck, &QCheckBox::stateChanged,
+            this, &YOLOObjectDetectorModel::onSoftNmsChanged);
     connect(m_inputSizeCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
             this, &YOLOObjectDetectorModel::onInputSizeChanged);
     connect(m_showBoxesCheck, &QCheckBox::stateChanged,
             this, &YOLOObjectDetectorModel::onShowBoxesChanged);
     connect(m_showLabelsCheck, &QCheckBox::stateChanged,
             this, &YOLOObjectDetectorModel::onShowLabelsChanged);
+    connect(m_letterboxCheck, &QCheckBox::stateChanged,
+            this, &YOLOObjectDetectorModel::onLetterboxChanged);
+    connect(m_tiledCheck, &QCheckBox::stateChanged,
+            this, &YOLOObjectDetectorModel::onTiledChanged);
+    connect(m_tileSizeSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &YOLOObjectDetectorModel::onTileSizeChanged);
+    connect(m_tileOverlapSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &YOLOObjectDetectorModel::onTileOverlapChanged);
+    connect(m_tileFullFrameCheck, &QCheckBox::stateChanged,
+            this, &YOLOObjectDetectorModel::onTileFullFrameChanged);
+    connect(m_tileExecutionCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &YOLOObjectDetectorModel::onTileExecutionChanged);
+    connect(m_detectIntervalSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &YOLOObjectDetectorModel::onDetectIntervalChanged);
+    connect(m_sceneChangeSpin, QOverload<double>::of(&QDoubleSpinBox::valueChanged),
+            this, &YOLOObjectDetectorModel::onSceneChangeChanged);
     connect(m_backendCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
             this, &YOLOObjectDetectorModel::onBackendChanged);
+    connect(m_warmupSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &YOLOObjectDetectorModel::onWarmupRunsChanged);
+    connect(m_pipelinedCheck, &QCheckBox::stateChanged,
+            this, &YOLOObjectDetectorModel::onPipelinedChanged);
+    connect(m_workersSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &YOLOObjectDetectorModel::onInferenceWorkersChanged);
+    connect(m_batchSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &YOLOObjectDetectorModel::onBatchSizeChanged);
+    connect(m_batchWaitSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &YOLOObjectDetectorModel::onBatchWaitChanged);
+
+    // A restart drains every queued frame, so spinbox steps restart the
+    // pipeline once, after the value settles
+    m_restartTimer = new QTimer(this);
+    m_restartTimer->setSingleShot(true);
+    m_restartTimer->setInterval(300);
+    connect(m_restartTimer, &QTimer::timeout, this,
+            [this]()
+            {
+                if (m_pipeline->isRunning())
+                {
+                    startPipeline();
+                }
+            });
+
+    // Models are parsed and warmed up off the GUI thread
+    m_loader = new DnnModelLoader(this);
+    connect(m_loader, &DnnModelLoader::progress,
+            this, &YOLOObjectDetectorModel::onLoadProgress);
+    connect(m_loader, &DnnModelLoader::loaded,
+            this, &YOLOObjectDetectorModel::onModelLoaded);
+
+    // Stages run on pipeline threads and only read per-frame parameters,
+    // settings fixed at construction and the snapshot taken in startPipeline()
+    m_pipeline = new InferencePipeline(
+        [this](InferenceFrame& frame)
+        {
+            const BlobPreprocessor::Params params = blobParams(frame.inputSize, m_pipelineLetterbox);
+
+            // Batched frames are written into the batch blob by the batcher
+            if (m_pipelineBatch.maxBatchSize > 1)
+            {
+                frame.transform = BlobPreprocessor::transformFor(frame.image.size(), params);
+                return;
+            }
+            frame.blob = m_preprocessor.process(frame.image, params, &frame.transform);
+        },
+        [this](InferenceFrame& frame)
+        {
+            if (m_pipelineBatch.maxBatchSize > 1)
+            {
+                frame.outputs = m_batcher->infer(
+                    frame.image, blobParams(frame.inputSize, m_pipelineLetterbox), m_pipelineBatch);
+                return;
+            }
+
+            SharedDnnNet::Lease lease = m_net->lease();
+            lease.net().setInput(frame.blob);
+
+            std::vector<cv::Mat> outputs;
+            lease.net().forward(outputs);
+
+            // The next forward() on this context overwrites its output buffers
+            frame.outputs.reserve(outputs.size());
+            for (const cv::Mat& output : outputs)
+            {
+                frame.outputs.push_back(output.clone());
+            }
+        },
+        [this](InferenceFrame& frame)
+        {
+            decodeOutputs(frame.outputs, m_pipelineVersion, frame.transform,
+                          nmsParams(frame.scoreThreshold, frame.nmsThreshold, frame.softNms),
+                          m_pipelineCandidates, frame.boxes, frame.scores, frame.classIds);
+        },
+        this);
+    connect(m_pipeline, &InferencePipeline::resultsReady,
+            this, &YOLOObjectDetectorModel::onPipelineResults);
+}
+
+YOLOObjectDetectorModel::~YOLOObjectDetectorModel()
+{
+    // The stages use members of this node: join them before those go away
+    stopPipeline();
 }
 
 /*******************************************************************************
@@ -172,7 +409,7 @@ unsigned int YOLOObjectDetectorModel::nPorts(QtNodes::PortType portType) const
     }
     else
     {
-        return 1; // One output image (with detections)
+        return 2; // Annotated image, detections
     }
 }
 
@@ -180,8 +417,10 @@ QtNodes::NodeDataType YOLOObjectDetectorModel::dataType(
     QtNodes::PortType portType,
     QtNodes::PortIndex portIndex) const
 {
-    Q_UNUSED(portType);
-    Q_UNUSED(portIndex);
+    if (portType == QtNodes::PortType::Out && portIndex == 1)
+    {
+        return DetectionData().type();
+    }
     return ImageData().type();
 }
 
@@ -190,7 +429,10 @@ QtNodes::NodeDataType YOLOObjectDetectorModel::dataType(
  ******************************************************************************/
 std::shared_ptr<QtNodes::NodeData> YOLOObjectDetectorModel::outData(QtNodes::PortIndex port)
 {
-    Q_UNUSED(port);
+    if (port == 1)
+    {
+        return m_detectionData;
+    }
     return std::make_shared<ImageData>(m_outputImage);
 }
 
@@ -212,14 +454,49 @@ void YOLOObjectDetectorModel::setInData(std::shared_ptr<QtNodes::NodeData> data,
     if (m_modelLoaded && m_inputImage)
     {
         runInference();
+        return;
     }
-    else if (m_inputImage)
+
+    // Just pass through the input
+    m_frameImage = m_inputImage ? m_inputImage->image() : cv::Mat();
+    m_detections.clear();
+    m_detectionData.reset();
+    renderOutputImage();
+
+    Q_EMIT dataUpdated(0);
+    Q_EMIT dataUpdated(1);
+}
+
+/*******************************************************************************
+ * Connections
+ ******************************************************************************/
+void YOLOObjectDetectorModel::outputConnectionCreated(QtNodes::ConnectionId const& connectionId)
+{
+    if (connectionId.outPortIndex != 0)
     {
-        // Just pass through the input
-        m_outputImage = m_inputImage->image().clone();
+        return;
     }
 
-    Q_EMIT dataUpdated(0);
+    // The graph pulls outData() right after this, so render the last
+    // detections now instead of waiting for the next frame
+    if (++m_imageConnections == 1)
+    {
+        renderOutputImage();
+    }
+}
+
+void YOLOObjectDetectorModel::outputConnectionDeleted(QtNodes::ConnectionId const& connectionId)
+{
+    if (connectionId.outPortIndex != 0)
+    {
+        return;
+    }
+
+    m_imageConnections = std::max(0, m_imageConnections - 1);
+    if (m_imageConnections == 0)
+    {
+        m_outputImage.release();
+    }
 }
 
 /*******************************************************************************
@@ -316,6 +593,11 @@ void YOLOObjectDetectorModel::onNmsThresholdChanged(double value)
     m_nmsThreshold = value;
 }
 
+void YOLOObjectDetectorModel::onSoftNmsChanged(int state)
+{
+    m_softNms = (state == Qt::Checked);
+}
+
 void YOLOObjectDetectorModel::onInputSizeChanged(int index)
 {
     m_inputSizeIndex = index;
@@ -331,11 +613,161 @@ void YOLOObjectDetectorModel::onShowLabelsChanged(int state)
     m_showLabels = (state == Qt::Checked);
 }
 
+void YOLOObjectDetectorModel::onLetterboxChanged(int state)
+{
+    m_letterbox = (state == Qt::Checked);
+    if (m_pipeline->isRunning())
+    {
+        startPipeline();
+    }
+}
+
+void YOLOObjectDetectorModel::onTiledChanged(int state)
+{
+    m_tiled = (state == Qt::Checked);
+    prepareTileContexts();
+}
+
+void YOLOObjectDetectorModel::onTileSizeChanged(int value)
+{
+    m_tileSize = value;
+}
+
+void YOLOObjectDetectorModel::onTileOverlapChanged(int value)
+{
+    m_tileOverlap = value;
+}
+
+void YOLOObjectDetectorModel::onTileFullFrameChanged(int state)
+{
+    m_tileFullFrame = (state == Qt::Checked);
+}
+
+void YOLOObjectDetectorModel::onTileExecutionChanged(int index)
+{
+    m_tileExecution = index;
+    prepareTileContexts();
+}
+
+void YOLOObjectDetectorModel::onDetectIntervalChanged(int value)
+{
+    m_detectInterval = value;
+    DetectionCadence::Params params = m_cadence.params();
+    params.interval = value;
+    m_cadence.setParams(params);
+    m_cadence.reset();
+}
+
+void YOLOObjectDetectorModel::onSceneChangeChanged(double value)
+{
+    m_sceneChangeThreshold = value;
+    DetectionCadence::Params params = m_cadence.params();
+    params.sceneChangeThreshold = value;
+    m_cadence.setParams(params);
+}
+
 void YOLOObjectDetectorModel::onBackendChanged(int index)
 {
     m_backendIndex = index;
 }
 
+void YOLOObjectDetectorModel::onWarmupRunsChanged(int value)
+{
+    m_warmupRuns = value;
+}
+
+void YOLOObjectDetectorModel::onPipelinedChanged(int state)
+{
+    m_pipelined = (state == Qt::Checked);
+    if (m_pipelined && m_modelLoaded)
+    {
+        startPipeline();
+    }
+    else
+    {
+        stopPipeline();
+    }
+}
+
+void YOLOObjectDetectorModel::onInferenceWorkersChanged(int value)
+{
+    m_inferenceWorkers = value;
+    if (m_pipeline->isRunning())
+    {
+        m_restartTimer->start();
+    }
+}
+
+void YOLOObjectDetectorModel::onBatchSizeChanged(int value)
+{
+    m_batchSize = value;
+    if (m_pipeline->isRunning())
+    {
+        m_restartTimer->start();
+    }
+}
+
+void YOLOObjectDetectorModel::onBatchWaitChanged(int value)
+{
+    m_batchWaitMs = value;
+    if (m_pipeline->isRunning())
+    {
+        m_restartTimer->start();
+    }
+}
+
+void YOLOObjectDetectorModel::onLoadProgress(const QString& stage, int percent)
+{
+    m_statusLabel->setText(QString("Status: %1").arg(stage));
+    m_loadProgress->setValue(percent);
+}
+
+void YOLOObjectDetectorModel::onModelLoaded(const DnnModelLoader::Result& result)
+{
+    m_loadProgress->setVisible(false);
+    m_loadBtn->setEnabled(true);
+
+    if (!result.error.isEmpty())
+    {
+        m_statusLabel->setText(QString("Status: Error loading model - %1").arg(result.error));
+        m_net.reset();
+        m_modelLoaded = false;
+        return;
+    }
+
+    m_net = result.network;
+    m_modelLoaded = true;
+    if (m_pipelined)
+    {
+        startPipeline();
+    }
+
+    QString status = QString("Status: Model loaded (%1 ms)").arg(result.loadMs);
+    if (!result.warning.isEmpty())
+    {
+        status += QString("\nWarning: %1").arg(result.warning);
+    }
+    else if (m_warmupRuns > 0)
+    {
+        status += QString("\nWarm-up: first %1 ms, steady %2 ms")
+                      .arg(result.firstRunMs, 0, 'f', 1)
+                      .arg(result.steadyRunMs, 0, 'f', 1);
+    }
+    m_statusLabel->setText(status);
+
+    // Load classes if file selected
+    if (!m_classesPath.isEmpty())
+    {
+        loadClasses();
+    }
+
+    // Run inference on current image
+    if (m_inputImage)
+    {
+        runInference();
+    }
+}
+
 /*******************************************************************************
  * Model Loading
  ******************************************************************************/
@@ -347,66 +779,55 @@ void YOLOObjectDetectorModel::loadModel()
         return;
     }
 
-    try
-    {
-        int version = m_yoloVersionCombo->currentData().toInt();
-
-        // Load network based on version
-        if (version == 2)
-        {
-            // YOLOv5/ONNX
-            cv::dnn::Net net = cv::dnn::readNetFromONNX(m_modelPath.toStdString());
-            m_net = cv::makePtr<cv::dnn::Net>(net);
-        }
-        else
-        {
-            // YOLOv3/v4 Darknet
-            if (m_configPath.isEmpty())
-            {
-                m_statusLabel->setText("Status: Config file required for Darknet models");
-                return;
-            }
-
-            cv::dnn::Net net = cv::dnn::readNetFromDarknet(
-                m_configPath.toStdString(),
-                m_modelPath.toStdString()
-            );
-            m_net = cv::makePtr<cv::dnn::Net>(net);
-        }
+    int version = m_yoloVersionCombo->currentData().toInt();
 
-        // Set backend and target
-        if (m_backendIndex == 1)
-        {
-            // CUDA
-            m_net->setPreferableBackend(cv::dnn::DNN_BACKEND_CUDA);
-            m_net->setPreferableTarget(cv::dnn::DNN_TARGET_CUDA);
-        }
-        else
+    // YOLOv5/ONNX needs only the model, YOLOv3/v4 Darknet also the config
+    QString configPath;
+    if (version != 2)
+    {
+        if (m_configPath.isEmpty())
         {
-            // CPU
-            m_net->setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
-            m_net->setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
+            m_statusLabel->setText("Status: Config file required for Darknet models");
+            return;
         }
+        configPath = m_configPath;
+    }
 
-        m_modelLoaded = true;
-        m_statusLabel->setText("Status: Model loaded successfully");
+    // Backend and target (CUDA or CPU)
+    const bool cuda = (m_backendIndex == 1);
+
+    DnnModelLoader::Request request;
+    request.modelPath = m_modelPath;
+    request.configPath = configPath;
+    request.backend = cuda ? cv::dnn::DNN_BACKEND_CUDA : cv::dnn::DNN_BACKEND_OPENCV;
+    request.target = cuda ? cv::dnn::DNN_TARGET_CUDA : cv::dnn::DNN_TARGET_CPU;
+    request.inputSize = selectedInputSize();
+    request.warmupRuns = m_warmupRuns;
+    request.contexts = (m_tiled && m_tileExecution == 1) ? kMaxTileContexts : 1;
+
+    // Frames pass through until onModelLoaded()
+    stopPipeline();
+    m_modelLoaded = false;
+    m_batcher.reset();
+    m_net.reset();
+    m_cadence.reset();
+    m_loadBtn->setEnabled(false);
+    m_loadProgress->setValue(0);
+    m_loadProgress->setVisible(true);
+    m_statusLabel->setText("Status: Loading model...");
 
-        // Load classes if file selected
-        if (!m_classesPath.isEmpty())
-        {
-            loadClasses();
-        }
+    m_loader->load(request);
+}
 
-        // Run inference on current image
-        if (m_inputImage)
-        {
-            runInference();
-        }
-    }
-    catch (const cv::Exception& e)
+void YOLOObjectDetectorModel::prepareTileContexts()
+{
+    // Parallel tiles run on several contexts at once; the missing ones are
+    // parsed by the loader (the network itself is a cache hit), not by the
+    // next frame on the GUI thread
+    if (m_modelLoaded && m_net && m_tiled && m_tileExecution == 1 &&
+        m_net->contextCount() < kMaxTileContexts)
     {
-        m_statusLabel->setText(QString("Status: Error loading model - %1").arg(e.what()));
-        m_modelLoaded = false;
+        loadModel();
     }
 }
 
@@ -448,288 +869,546 @@ void YOLOObjectDetectorModel::runInference()
         return;
     }
 
+    // Cadence: between keyframes the last detections are tracked
+    const bool cadence = m_detectInterval > 1;
+    if (cadence && !m_cadence.needsDetection(image))
+    {
+        publishTracked(image);
+        return;
+    }
+
+    // Tiled: synchronous, the tiles of one frame are the batch
+    if (m_tiled)
+    {
+        runTiledInference(image);
+        return;
+    }
+
+    // Pipelined: results are published by onPipelineResults()
+    if (m_pipeline->isRunning())
+    {
+        InferenceFrame frame;
+        frame.image = image;
+        frame.inputSize = selectedInputSize();
+        frame.scoreThreshold = static_cast<float>(m_confidenceThreshold);
+        frame.nmsThreshold = static_cast<float>(m_nmsThreshold);
+        frame.softNms = m_softNms;
+        m_pipeline->submit(std::move(frame));
+        return;
+    }
+
     // Preprocess
     cv::Mat blob = preprocessImage(image);
 
+    // Borrow an inference context; outputs stay valid while it is held
+    SharedDnnNet::Lease lease = m_net->lease();
+
     // Set input
-    m_net->setInput(blob);
+    lease.net().setInput(blob);
 
     // Forward pass
     std::vector<cv::Mat> outputs;
-    m_net->forward(outputs);
-
-    // Postprocess and draw
-    m_outputImage = image.clone();
-    postprocessAndDraw(m_outputImage, outputs);
+    lease.net().forward(outputs);
+
+    // Decode detections
+    decodeOutputs(outputs, m_yoloVersionCombo->currentData().toInt(), m_transform,
+                  nmsParams(static_cast<float>(m_confidenceThreshold),
+                            static_cast<float>(m_nmsThreshold), m_softNms),
+                  m_candidates, m_keptBoxes, m_keptScores, m_keptClassIds);
+    publishDetections(image, m_keptBoxes, m_keptScores, m_keptClassIds);
+    if (cadence)
+    {
+        startTracking(image, m_keptBoxes, m_keptScores, m_keptClassIds);
+    }
 
     Q_EMIT dataUpdated(0);
+    Q_EMIT dataUpdated(1);
 }
 
-cv::Mat YOLOObjectDetectorModel::preprocessImage(const cv::Mat& image)
+void YOLOObjectDetectorModel::runTiledInference(const cv::Mat& image)
 {
-    // Get input size
-    int sizeIndex = m_inputSizeCombo->currentData().toInt();
-    cv::Size inputSize(320, 320);
-    switch (sizeIndex)
-    {
-        case 0: inputSize = cv::Size(320, 320); break;
-        case 1: inputSize = cv::Size(416, 416); break;
-        case 2: inputSize = cv::Size(512, 512); break;
-        case 3: inputSize = cv::Size(608, 608); break;
-        case 4: inputSize = cv::Size(640, 640); break;
-    }
-
-    // Create blob from image
-    cv::Mat blob = cv::dnn::blobFromImage(
-        image,
-        m_inputScale,
-        inputSize,
-        m_mean,
-        m_swapRB,
-        false,
-        CV_32F
-    );
+    QElapsedTimer timer;
+    timer.start();
 
-    return blob;
-}
-
-void YOLOObjectDetectorModel::postprocessAndDraw(cv::Mat& image,
-                                                  const std::vector<cv::Mat>& outputs)
-{
-    m_detections.clear();
-
-    // Get output dimensions based on YOLO version
-    int version = m_yoloVersionCombo->currentData().toInt();
+    std::vector<cv::Rect> tiles = TileGrid::cut(image.size(), cv::Size(m_tileSize, m_tileSize),
+                                                m_tileOverlap / 100.0);
+    if (m_tileFullFrame && tiles.size() > 1)
+    {
+        tiles.emplace_back(0, 0, image.cols, image.rows);
+    }
 
-    if (version == 2)
+    // Tiles are views into the frame, read in place by the preprocessor
+    const int count = static_cast<int>(tiles.size());
+    std::vector<cv::Mat> tileImages;
+    tileImages.reserve(count);
+    for (const cv::Rect& tile : tiles)
     {
-        // YOLOv5/ONNX format: [1, 25200, 85] for COCO
-        // Output format: [batch, num_detections, num_classes + 5]
-        // 5 = [x, y, w, h, confidence]
+        tileImages.push_back(image(tile));
+    }
 
-        cv::Mat output = outputs[0];
-        int numDetections = output.size[1];
-        int numClasses = output.size[2] - 5;
+    const BlobPreprocessor::Params params = blobParams(selectedInputSize(), m_letterbox);
+    std::vector<LetterboxTransform> transforms(count);
+    std::vector<std::vector<cv::Mat>> tileOutputs(count);
 
-        // Reshape if needed
-        if (output.dims == 3)
+    try
+    {
+        if (m_tileExecution == 0)
         {
-            output = output.reshape(1, output.size[1]);
-        }
+            // One forward pass over an [N, 3, H, W] batch of tiles
+            cv::Mat blob = m_preprocessor.processBatch(tileImages, params, &transforms);
 
-        std::vector<int> classIds;
-        std::vector<float> confidences;
-        std::vector<cv::Rect> boxes;
+            SharedDnnNet::Lease lease = m_net->lease();
+            lease.net().setInput(blob);
 
-        // Process each detection
-        for (int i = 0; i < numDetections; ++i)
-        {
-            // Get confidence scores
-            cv::Mat scores = output.row(i).colRange(5, output.cols);
-            cv::Point classIdPoint;
-            double maxScore;
-            cv::minMaxLoc(scores, 0, &maxScore, 0, &classIdPoint);
+            std::vector<cv::Mat> outputs;
+            lease.net().forward(outputs);
 
-            if (maxScore >= m_confidenceThreshold)
+            for (int i = 0; i < count; ++i)
             {
-                // Get box coordinates (center x, center y, width, height)
-                float centerX = output.at<float>(i, 0);
-                float centerY = output.at<float>(i, 1);
-                float width = output.at<float>(i, 2);
-                float height = output.at<float>(i, 3);
-
-                // Scale to image size
-                int left = static_cast<int>((centerX - width / 2) * image.cols);
-                int top = static_cast<int>((centerY - height / 2) * image.rows);
-                int right = static_cast<int>((centerX + width / 2) * image.cols);
-                int bottom = static_cast<int>((centerY + height / 2) * image.rows);
-
-                // Clip to image bounds
-                left = std::max(0, std::min(left, image.cols - 1));
-                top = std::max(0, std::min(top, image.rows - 1));
-                right = std::max(0, std::min(right, image.cols - 1));
-                bottom = std::max(0, std::min(bottom, image.rows - 1));
-
-                classIds.push_back(classIdPoint.x);
-                confidences.push_back(static_cast<float>(maxScore));
-                boxes.push_back(cv::Rect(left, top, right - left, bottom - top));
+                for (const cv::Mat& output : outputs)
+                {
+                    tileOutputs[i].push_back(DnnBatcher::sliceOutput(output, count, i));
+                }
             }
         }
-
-        // Apply non-maximum suppression
-        std::vector<int> indices;
-        cv::dnn::NMSBoxes(boxes, confidences, m_confidenceThreshold,
-                         m_nmsThreshold, indices);
-
-        // Draw detections
-        for (size_t i = 0; i < indices.size(); ++i)
+        else
         {
-            int idx = indices[i];
-            cv::Rect box = boxes[idx];
-            int classId = classIds[idx];
-            float confidence = confidences[idx];
-
-            Detection det;
-            det.classId = classId;
-            det.confidence = confidence;
-            det.box = box;
-            m_detections.push_back(det);
-
-            if (m_showBoxes)
+            // One forward pass per tile on the contexts that are idle now;
+            // never parse more here, the loader prepares them in the background
+            std::vector<SharedDnnNet::Lease> leases;
+            leases.push_back(m_net->lease());
+            while (static_cast<int>(leases.size()) < std::min(count, kMaxTileContexts))
             {
-                // Generate color based on class ID
-                cv::Scalar color =
-                    cv::Scalar((classId * 37) % 256,
-                              (classId * 97) % 256,
-                              (classId * 151) % 256);
-                cv::rectangle(image, box, color, 2);
-
-                if (m_showLabels)
+                SharedDnnNet::Lease lease = m_net->tryLease();
+                if (!lease.isValid())
                 {
-                    std::string label;
-                    if (classId < static_cast<int>(m_classNames.size()))
-                    {
-                        label = m_classNames[classId];
-                    }
-                    else
-                    {
-                        label = "Class_" + std::to_string(classId);
-                    }
+                    break;
+                }
+                leases.push_back(std::move(lease));
+            }
 
-                    if (m_showConfidence)
+            // Worker w owns leases[w] and runs tiles w, w + workers, ...
+            const int workers = static_cast<int>(leases.size());
+            std::vector<std::string> errors(count);
+            cv::parallel_for_(cv::Range(0, workers), [&](const cv::Range& range)
+            {
+                for (int w = range.start; w < range.end; ++w)
+                {
+                    cv::dnn::Net& net = leases[w].net();
+                    for (int i = w; i < count; i += workers)
                     {
-                        label += ": " + std::to_string(static_cast<int>(confidence * 100)) + "%";
+                        try
+                        {
+                            cv::Mat blob = m_preprocessor.process(tileImages[i], params, &transforms[i]);
+                            net.setInput(blob);
+
+                            std::vector<cv::Mat> outputs;
+                            net.forward(outputs);
+                            for (const cv::Mat& output : outputs)
+                            {
+                                tileOutputs[i].push_back(output.clone());
+                            }
+                        }
+                        catch (const cv::Exception& e)
+                        {
+                            errors[i] = e.what();
+                        }
                     }
+                }
+            }, workers);
 
-                    int baseLine;
-                    cv::Size labelSize =
-                        cv::getTextSize(label, cv::FONT_HERSHEY_SIMPLEX,
-                                       0.5, 1, &baseLine);
-                    cv::rectangle(image,
-                                cv::Point(box.x, box.y - round(labelSize.height)),
-                                cv::Point(box.x + round(labelSize.width),
-                                         box.y + baseLine),
-                                color, cv::FILLED);
-                    cv::putText(image, label,
-                               cv::Point(box.x, box.y),
-                               cv::FONT_HERSHEY_SIMPLEX, 0.5,
-                               cv::Scalar(255, 255, 255), 1);
+            for (const std::string& error : errors)
+            {
+                if (!error.empty())
+                {
+                    CV_Error(cv::Error::StsError, error);
                 }
             }
         }
     }
-    else
+    catch (const cv::Exception& e)
     {
-        // YOLOv3/v4 format
-        // Multiple output layers for different scales
-        std::vector<int> classIds;
-        std::vector<float> confidences;
-        std::vector<cv::Rect> boxes;
+        QString message = QString("Tiled inference failed: %1").arg(QString::fromStdString(e.what()));
+        if (m_tileExecution == 0)
+        {
+            message += "\nModels exported with a fixed batch size need Parallel tile execution.";
+        }
+        m_infoText->setText(message);
+        return;
+    }
 
-        for (const cv::Mat& output : outputs)
+    // Decode every tile in tile pixels, then move the boxes into the frame
+    const int version = m_yoloVersionCombo->currentData().toInt();
+    const float scoreThreshold = static_cast<float>(m_confidenceThreshold);
+    m_candidates.clear();
+    for (int i = 0; i < count; ++i)
+    {
+        const size_t first = m_candidates.size();
+        decodeCandidates(tileOutputs[i], version, transforms[i], scoreThreshold, m_candidates);
+        for (size_t j = first; j < m_candidates.size(); ++j)
         {
-            int numDetections = output.rows;
-            int numClasses = output.cols - 5;
+            m_candidates.x[j] += tiles[i].x;
+            m_candidates.y[j] += tiles[i].y;
+        }
+    }
 
-            for (int i = 0; i < numDetections; ++i)
-            {
-                const float* data = output.ptr<float>(i);
+    // Merge duplicates from overlapping tiles with a frame-wide class-aware NMS
+    suppress(m_candidates,
+             nmsParams(scoreThreshold, static_cast<float>(m_nmsThreshold), m_softNms),
+             m_keptBoxes, m_keptScores, m_keptClassIds);
+    publishDetections(image, m_keptBoxes, m_keptScores, m_keptClassIds);
+    m_infoText->append(QString("%1 tiles in %2 ms").arg(count).arg(timer.elapsed()));
+    if (m_detectInterval > 1)
+    {
+        startTracking(image, m_keptBoxes, m_keptScores, m_keptClassIds);
+    }
 
-                // Get confidence
-                float confidence = data[4];
-                if (confidence >= m_confidenceThreshold)
-                {
-                    cv::Mat scores(1, numClasses, CV_32F, const_cast<float*>(data + 5));
-                    cv::Point classIdPoint;
-                    double maxScore;
-                    cv::minMaxLoc(scores, 0, &maxScore, 0, &classIdPoint);
+    Q_EMIT dataUpdated(0);
+    Q_EMIT dataUpdated(1);
+}
 
-                    if (maxScore >= m_confidenceThreshold)
-                    {
-                        // Get box coordinates (center x, center y, width, height)
-                        float centerX = data[0] * image.cols;
-                        float centerY = data[1] * image.rows;
-                        float width = data[2] * image.cols;
-                        float height = data[3] * image.rows;
-
-                        int left = static_cast<int>(centerX - width / 2);
-                        int top = static_cast<int>(centerY - height / 2);
-
-                        classIds.push_back(classIdPoint.x);
-                        confidences.push_back(static_cast<float>(maxScore));
-                        boxes.push_back(cv::Rect(left, top,
-                                               static_cast<int>(width),
-                                               static_cast<int>(height)));
-                    }
-                }
-            }
-        }
+void YOLOObjectDetectorModel::startPipeline()
+{
+    if (!m_net)
+    {
+        return;
+    }
+
+    // Restarts with the current settings when already running
+    m_restartTimer->stop();
+    m_pipeline->stop();
+    m_pipelineVersion = m_yoloVersionCombo->currentData().toInt();
+    m_pipelineLetterbox = m_letterbox;
+    m_pipelineBatch.maxBatchSize = m_batchSize;
+    m_pipelineBatch.maxWaitMs = m_batchWaitMs;
+    m_batcher = DnnBatcher::forNetwork(m_net);
+
+    // A batch fills from frames waiting in concurrent inference workers
+    InferencePipeline::Config config;
+    config.inferenceWorkers = std::max(m_inferenceWorkers, m_batchSize);
+    config.queueDepth = std::max(config.queueDepth, m_batchSize);
+    m_pipeline->start(config);
+}
 
-        // Apply NMS
-        std::vector<int> indices;
-        cv::dnn::NMSBoxes(boxes, confidences, m_confidenceThreshold,
-                         m_nmsThreshold, indices);
+void YOLOObjectDetectorModel::stopPipeline()
+{
+    m_restartTimer->stop();
+    if (m_pipeline)
+    {
+        m_pipeline->stop();
+    }
+}
 
-        // Draw detections
-        for (size_t i = 0; i < indices.size(); ++i)
+void YOLOObjectDetectorModel::onPipelineResults()
+{
+    std::vector<InferenceFrame> results = m_pipeline->takeResults();
+    if (results.empty())
+    {
+        return;
+    }
+
+    // In submission order, one update per frame
+    for (const InferenceFrame& frame : results)
+    {
+        if (!frame.error.isEmpty())
+        {
+            m_infoText->setText(QString("Inference error: %1").arg(frame.error));
+            continue;
+        }
+
+        if (m_detectInterval > 1)
         {
-            int idx = indices[i];
-            cv::Rect box = boxes[idx];
-            int classId = classIds[idx];
-            float confidence = confidences[idx];
-
-            Detection det;
-            det.classId = classId;
-            det.confidence = confidence;
-            det.box = box;
-            m_detections.push_back(det);
-
-            if (m_showBoxes)
+            startTracking(frame.image, frame.boxes, frame.scores, frame.classIds);
+
+            // Later frames were tracked while this keyframe was in flight:
+            // move the fresh boxes up to the newest frame
+            cv::Mat latest = m_inputImage ? m_inputImage->image() : cv::Mat();
+            if (!latest.empty() && latest.data != frame.image.data)
             {
-                cv::Scalar color =
-                    cv::Scalar((classId * 37) % 256,
-                              (classId * 97) % 256,
-                              (classId * 151) % 256);
-                cv::rectangle(image, box, color, 2);
+                publishTracked(latest);
+                continue;
+            }
+        }
 
-                if (m_showLabels)
-                {
-                    std::string label;
-                    if (classId < static_cast<int>(m_classNames.size()))
-                    {
-                        label = m_classNames[classId];
-                    }
-                    else
-                    {
-                        label = "Class_" + std::to_string(classId);
-                    }
+        publishDetections(frame.image, frame.boxes, frame.scores, frame.classIds);
+        Q_EMIT dataUpdated(0);
+        Q_EMIT dataUpdated(1);
+    }
 
-                    if (m_showConfidence)
-                    {
-                        label += ": " + std::to_string(static_cast<int>(confidence * 100)) + "%";
-                    }
+    const InferencePipelineStats stats = m_pipeline->stats();
+    m_infoText->append(QString("Pipeline: pre %1 ms, forward %2 ms, post %3 ms\n"
+                               "%4 fps, latency %5 ms, %6 dropped")
+                           .arg(stats.preprocessMs, 0, 'f', 1)
+                           .arg(stats.inferenceMs, 0, 'f', 1)
+                           .arg(stats.postprocessMs, 0, 'f', 1)
+                           .arg(stats.throughputFps, 0, 'f', 1)
+                           .arg(stats.latencyMs, 0, 'f', 1)
+                           .arg(stats.dropped));
+
+    PerformanceMonitor* monitor = PerformanceMonitor::instance();
+    if (m_pipelineBatch.maxBatchSize > 1)
+    {
+        const double batchSize = m_batcher->stats().averageBatchSize();
+        m_infoText->append(QString("Average batch: %1 frames").arg(batchSize, 0, 'f', 1));
+        monitor->recordMetric(this, caption(), "batchSize", batchSize);
+    }
+    monitor->recordMetric(this, caption(), "preprocessMs", stats.preprocessMs);
+    monitor->recordMetric(this, caption(), "inferenceMs", stats.inferenceMs);
+    monitor->recordMetric(this, caption(), "postprocessMs", stats.postprocessMs);
+    monitor->recordMetric(this, caption(), "pipelineFps", stats.throughputFps);
+    monitor->recordMetric(this, caption(), "droppedFrames", static_cast<double>(stats.dropped));
+}
 
-                    int baseLine;
-                    cv::Size labelSize =
-                        cv::getTextSize(label, cv::FONT_HERSHEY_SIMPLEX,
-                                       0.5, 1, &baseLine);
-                    cv::rectangle(image,
-                                cv::Point(box.x, box.y - round(labelSize.height)),
-                                cv::Point(box.x + round(labelSize.width),
-                                         box.y + baseLine),
-                                color, cv::FILLED);
-                    cv::putText(image, label,
-                               cv::Point(box.x, box.y),
-                               cv::FONT_HERSHEY_SIMPLEX, 0.5,
-                               cv::Scalar(255, 255, 255), 1);
-                }
-            }
+cv::Size YOLOObjectDetectorModel::selectedInputSize() const
+{
+    switch (m_inputSizeCombo->currentData().toInt())
+    {
+        case 1: return cv::Size(416, 416);
+        case 2: return cv::Size(512, 512);
+        case 3: return cv::Size(608, 608);
+        case 4: return cv::Size(640, 640);
+        default: return cv::Size(320, 320);
+    }
+}
+
+cv::Mat YOLOObjectDetectorModel::preprocessImage(const cv::Mat& image)
+{
+    // Letterbox, normalize and convert to NCHW in one pass into a reused
+    // buffer; the transform is remembered to map output boxes back
+    return m_preprocessor.process(image, blobParams(selectedInputSize(), m_letterbox),
+                                  &m_transform);
+}
+
+BlobPreprocessor::Params YOLOObjectDetectorModel::blobParams(const cv::Size& inputSize,
+                                                              bool letterbox) const
+{
+    BlobPreprocessor::Params params;
+    params.inputSize = inputSize;
+    params.scale = m_inputScale;
+    params.mean = m_mean;
+    params.swapRB = m_swapRB;
+    params.letterbox = letterbox;
+    return params;
+}
+
+void YOLOObjectDetectorModel::decodeOutputs(const std::vector<cv::Mat>& outputs,
+                                            int version,
+                                            const LetterboxTransform& transform,
+                                            const BoxNms::Params& nms,
+                                            YoloCandidates& candidates,
+                                            std::vector<cv::Rect>& boxes,
+                                            std::vector<float>& scores,
+                                            std::vector<int>& classIds)
+{
+    candidates.clear();
+    decodeCandidates(outputs, version, transform, nms.scoreThreshold, candidates);
+    suppress(candidates, nms, boxes, scores, classIds);
+}
+
+void YOLOObjectDetectorModel::decodeCandidates(const std::vector<cv::Mat>& outputs,
+                                               int version,
+                                               const LetterboxTransform& transform,
+                                               float scoreThreshold,
+                                               YoloCandidates& candidates)
+{
+    if (outputs.empty())
+    {
+        return;
+    }
+
+    YoloDecoder::Params params;
+    params.scoreThreshold = scoreThreshold;
+    params.clipWidth = transform.imageSize.width;
+    params.clipHeight = transform.imageSize.height;
+
+    if (version == 2)
+    {
+        // YOLOv5/ONNX format: [1, 25200, 85] for COCO
+        // Output format: [batch, num_detections, num_classes + 5]
+        // 5 = [x, y, w, h, objectness], boxes in network input pixels,
+        // class scores conditional on objectness
+        params.multiplyObjectness = true;
+        params.scaleX = 1.0f / transform.scaleX();
+        params.scaleY = 1.0f / transform.scaleY();
+        params.offsetX = static_cast<float>(transform.content.x);
+        params.offsetY = static_cast<float>(transform.content.y);
+        YoloDecoder::decode(outputs[0], params, candidates);
+    }
+    else
+    {
+        // YOLOv3/v4 format
+        // Multiple output layers for different scales, boxes normalized to
+        // the network input, class scores already multiplied by objectness
+        const float inputWidth = static_cast<float>(transform.inputSize.width);
+        const float inputHeight = static_cast<float>(transform.inputSize.height);
+        params.multiplyObjectness = false;
+        params.scaleX = inputWidth / transform.scaleX();
+        params.scaleY = inputHeight / transform.scaleY();
+        params.offsetX = transform.content.x / inputWidth;
+        params.offsetY = transform.content.y / inputHeight;
+        for (const cv::Mat& output : outputs)
+        {
+            YoloDecoder::decode(output, params, candidates);
         }
     }
+}
+
+void YOLOObjectDetectorModel::suppress(const YoloCandidates& candidates,
+                                       const BoxNms::Params& nms,
+                                       std::vector<cv::Rect>& boxes,
+                                       std::vector<float>& scores,
+                                       std::vector<int>& classIds)
+{
+    boxes.clear();
+    classIds.clear();
+
+    // Class-aware: boxes only suppress boxes of their own class
+    std::vector<int> indices;
+    BoxNms::run(candidates, nms, indices, scores);
+
+    boxes.reserve(indices.size());
+    classIds.reserve(indices.size());
+    for (int idx : indices)
+    {
+        boxes.push_back(candidates.rect(idx));
+        classIds.push_back(candidates.classId[idx]);
+    }
+}
+
+void YOLOObjectDetectorModel::publishDetections(const cv::Mat& image,
+                                                const std::vector<cv::Rect>& boxes,
+                                                const std::vector<float>& scores,
+                                                const std::vector<int>& classIds)
+{
+    m_frameImage = image;
+    m_detections.clear();
+
+    // Keep the survivors, and publish them with normalized boxes
+    const double invWidth = 1.0 / image.cols;
+    const double invHeight = 1.0 / image.rows;
+    QVector<DetectionData::Detection> published;
+    published.reserve(static_cast<int>(boxes.size()));
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        Detection det;
+        det.classId = classIds[i];
+        det.confidence = scores[i];
+        det.box = boxes[i];
+        m_detections.push_back(det);
+
+        published.append(DetectionData::Detection(
+            QRectF(det.box.x * invWidth, det.box.y * invHeight,
+                   det.box.width * invWidth, det.box.height * invHeight),
+            QString::fromStdString(className(det.classId)),
+            det.confidence));
+    }
+    m_detectionData = std::make_shared<DetectionData>(published);
 
     // Update info text
     QString info = QString("Detected %1 objects").arg(m_detections.size());
     m_infoText->setText(info);
+
+    // Drawing is only done for a connected image port
+    renderOutputImage();
+}
+
+void YOLOObjectDetectorModel::startTracking(const cv::Mat& image,
+                                            const std::vector<cv::Rect>& boxes,
+                                            const std::vector<float>& scores,
+                                            const std::vector<int>& classIds)
+{
+    m_keyScores = scores;
+    m_keyClassIds = classIds;
+    m_cadence.setDetections(image, boxes);
+}
+
+void YOLOObjectDetectorModel::publishTracked(const cv::Mat& image)
+{
+    m_cadence.track(image, m_trackedBoxes, m_trackedSources);
+
+    // Tracked boxes keep the class and score of their keyframe detection
+    m_trackedScores.clear();
+    m_trackedClassIds.clear();
+    for (int source : m_trackedSources)
+    {
+        m_trackedScores.push_back(m_keyScores[source]);
+        m_trackedClassIds.push_back(m_keyClassIds[source]);
+    }
+    publishDetections(image, m_trackedBoxes, m_trackedScores, m_trackedClassIds);
+
+    const double share = m_cadence.stats().detectorShare();
+    m_infoText->append(QString("Tracked frame (network on %1% of frames)")
+                           .arg(share * 100.0, 0, 'f', 0));
+    PerformanceMonitor::instance()->recordMetric(this, caption(), "detectorShare", share);
+
+    Q_EMIT dataUpdated(0);
+    Q_EMIT dataUpdated(1);
+}
+
+void YOLOObjectDetectorModel::renderOutputImage()
+{
+    // Nobody consumes the image: skip the copy and the drawing entirely
+    if (m_imageConnections == 0 || m_frameImage.empty())
+    {
+        m_outputImage.release();
+        return;
+    }
+
+    m_outputImage = m_frameImage.clone();
+    for (const Detection& det : m_detections)
+    {
+        drawDetection(m_outputImage, det);
+    }
+}
+
+std::string YOLOObjectDetectorModel::className(int classId) const
+{
+    if (classId >= 0 && classId < static_cast<int>(m_classNames.size()))
+    {
+        return m_classNames[classId];
+    }
+    return "Class_" + std::to_string(classId);
+}
+
+void YOLOObjectDetectorModel::drawDetection(cv::Mat& image, const Detection& det) const
+{
+    if (!m_showBoxes)
+    {
+        return;
+    }
+
+    // Generate color based on class ID
+    const int classId = det.classId;
+    const cv::Rect& box = det.box;
+    cv::Scalar color =
+        cv::Scalar((classId * 37) % 256,
+                  (classId * 97) % 256,
+                  (classId * 151) % 256);
+    cv::rectangle(image, box, color, 2);
+
+    if (m_showLabels)
+    {
+        std::string label = className(classId);
+
+        if (m_showConfidence)
+        {
+            label += ": " + std::to_string(static_cast<int>(det.confidence * 100)) + "%";
+        }
+
+        int baseLine;
+        cv::Size labelSize =
+            cv::getTextSize(label, cv::FONT_HERSHEY_SIMPLEX,
+                           0.5, 1, &baseLine);
+        cv::rectangle(image,
+                    cv::Point(box.x, box.y - round(labelSize.height)),
+                    cv::Point(box.x + round(labelSize.width),
+                             box.y + baseLine),
+                    color, cv::FILLED);
+        cv::putText(image, label,
+                   cv::Point(box.x, box.y),
+                   cv::FONT_HERSHEY_SIMPLEX, 0.5,
+                   cv::Scalar(255, 255, 255), 1);
+    }
 }
 
 std::vector<int> YOLOObjectDetectorModel::getOutputLayers(const cv::dnn::Net& net)
@@ -757,10 +1436,24 @@ QJsonObject YOLOObjectDetectorModel::save() const
     modelJson["yoloVersion"] = m_yoloVersion;
     modelJson["confidenceThreshold"] = m_confidenceThreshold;
     modelJson["nmsThreshold"] = m_nmsThreshold;
+    modelJson["softNms"] = m_softNms;
     modelJson["inputSizeIndex"] = m_inputSizeIndex;
     modelJson["backendIndex"] = m_backendIndex;
+    modelJson["warmupRuns"] = m_warmupRuns;
+    modelJson["pipelined"] = m_pipelined;
+    modelJson["inferenceWorkers"] = m_inferenceWorkers;
+    modelJson["batchSize"] = m_batchSize;
+    modelJson["batchWaitMs"] = m_batchWaitMs;
     modelJson["showBoxes"] = m_showBoxes;
     modelJson["showLabels"] = m_showLabels;
+    modelJson["letterbox"] = m_letterbox;
+    modelJson["tiled"] = m_tiled;
+    modelJson["tileSize"] = m_tileSize;
+    modelJson["tileOverlap"] = m_tileOverlap;
+    modelJson["tileFullFrame"] = m_tileFullFrame;
+    modelJson["tileExecution"] = m_tileExecution;
+    modelJson["detectInterval"] = m_detectInterval;
+    modelJson["sceneChangeThreshold"] = m_sceneChangeThreshold;
     return modelJson;
 }
 
@@ -818,6 +1511,13 @@ void YOLOObjectDetectorModel::load(QJsonObject const& model)
         m_nmsSpin->setValue(m_nmsThreshold);
     }
 
+    QJsonValue softNmsJson = model["softNms"];
+    if (!softNmsJson.isUndefined())
+    {
+        m_softNms = softNmsJson.toBool();
+        m_softNmsCheck->setChecked(m_softNms);
+    }
+
     QJsonValue sizeJson = model["inputSizeIndex"];
     if (!sizeJson.isUndefined())
     {
@@ -836,6 +1536,41 @@ void YOLOObjectDetectorModel::load(QJsonObject const& model)
         m_backendCombo->blockSignals(false);
     }
 
+    QJsonValue warmupJson = model["warmupRuns"];
+    if (!warmupJson.isUndefined())
+    {
+        m_warmupRuns = warmupJson.toInt();
+        m_warmupSpin->setValue(m_warmupRuns);
+    }
+
+    QJsonValue workersJson = model["inferenceWorkers"];
+    if (!workersJson.isUndefined())
+    {
+        m_inferenceWorkers = workersJson.toInt();
+        m_workersSpin->setValue(m_inferenceWorkers);
+    }
+
+    QJsonValue batchJson = model["batchSize"];
+    if (!batchJson.isUndefined())
+    {
+        m_batchSize = batchJson.toInt();
+        m_batchSpin->setValue(m_batchSize);
+    }
+
+    QJsonValue batchWaitJson = model["batchWaitMs"];
+    if (!batchWaitJson.isUndefined())
+    {
+        m_batchWaitMs = batchWaitJson.toInt();
+        m_batchWaitSpin->setValue(m_batchWaitMs);
+    }
+
+    QJsonValue pipelinedJson = model["pipelined"];
+    if (!pipelinedJson.isUndefined())
+    {
+        m_pipelined = pipelinedJson.toBool();
+        m_pipelinedCheck->setChecked(m_pipelined);
+    }
+
     QJsonValue boxesJson = model["showBoxes"];
     if (!boxesJson.isUndefined())
     {
@@ -850,6 +1585,62 @@ void YOLOObjectDetectorModel::load(QJsonObject const& model)
         m_showLabelsCheck->setChecked(m_showLabels);
     }
 
+    QJsonValue letterboxJson = model["letterbox"];
+    if (!letterboxJson.isUndefined())
+    {
+        m_letterbox = letterboxJson.toBool();
+        m_letterboxCheck->setChecked(m_letterbox);
+    }
+
+    QJsonValue tiledJson = model["tiled"];
+    if (!tiledJson.isUndefined())
+    {
+        m_tiled = tiledJson.toBool();
+        m_tiledCheck->setChecked(m_tiled);
+    }
+
+    QJsonValue tileSizeJson = model["tileSize"];
+    if (!tileSizeJson.isUndefined())
+    {
+        m_tileSize = tileSizeJson.toInt();
+        m_tileSizeSpin->setValue(m_tileSize);
+    }
+
+    QJsonValue tileOverlapJson = model["tileOverlap"];
+    if (!tileOverlapJson.isUndefined())
+    {
+        m_tileOverlap = tileOverlapJson.toInt();
+        m_tileOverlapSpin->setValue(m_tileOverlap);
+    }
+
+    QJsonValue tileFullFrameJson = model["tileFullFrame"];
+    if (!tileFullFrameJson.isUndefined())
+    {
+        m_tileFullFrame = tileFullFrameJson.toBool();
+        m_tileFullFrameCheck->setChecked(m_tileFullFrame);
+    }
+
+    QJsonValue tileExecutionJson = model["tileExecution"];
+    if (!tileExecutionJson.isUndefined())
+    {
+        m_tileExecution = tileExecutionJson.toInt();
+        m_tileExecutionCombo->setCurrentIndex(m_tileExecution);
+    }
+
+    QJsonValue detectIntervalJson = model["detectInterval"];
+    if (!detectIntervalJson.isUndefined())
+    {
+        m_detectInterval = detectIntervalJson.toInt();
+        m_detectIntervalSpin->setValue(m_detectInterval);
+    }
+
+    QJsonValue sceneChangeJson = model["sceneChangeThreshold"];
+    if (!sceneChangeJson.isUndefined())
+    {
+        m_sceneChangeThreshold = sceneChangeJson.toDouble();
+        m_sceneChangeSpin->setValue(m_sceneChangeThreshold);
+    }
+
     // Auto-load model if paths are available
     if (!m_modelPath.isEmpty())
     {
@@ -7,6 +7,15 @@
 #define VISIONBOX_YOLOOBJECTDETECTORMODEL_H
 
 #include "core/PluginInterface.h"
+#include "core/YoloDecoder.h"
+#include "core/DnnNetCache.h"
+#include "core/DnnModelLoader.h"
+#include "core/InferencePipeline.h"
+#include "core/DnnBatcher.h"
+#include "core/BlobPreprocessor.h"
+#include "core/TileGrid.h"
+#include "core/BoxNms.h"
+#include "core/DetectionCadence.h"
 #include <QtNodes/NodeDelegateModel>
 #include <QWidget>
 #include <QVBoxLayout>
@@ -18,6 +27,9 @@
 #include <QComboBox>
 #include <QDoubleSpinBox>
 #include <QCheckBox>
+#include <QSpinBox>
+#include <QProgressBar>
+#include <QTimer>
 #include <QTextEdit>
 #include <opencv2/opencv.hpp>
 #include <opencv2/dnn.hpp>
@@ -25,6 +37,7 @@
 namespace VisionBox {
 
 class ImageData;
+class DetectionData;
 
 /*******************************************************************************
  * YOLOObjectDetectorModel - Real-time object detection with YOLO
@@ -35,7 +48,7 @@ class YOLOObjectDetectorModel : public QtNodes::NodeDelegateModel
 
 public:
     YOLOObjectDetectorModel();
-    ~YOLOObjectDetectorModel() override = default;
+    ~YOLOObjectDetectorModel() override;
 
     QString caption() const override { return "YOLO Detector"; }
     QString name() const override { return "YOLOObjectDetectorModel"; }
@@ -53,22 +66,79 @@ public:
     QJsonObject save() const override;
     void load(QJsonObject const& model) override;
 
+public slots:
+    void outputConnectionCreated(QtNodes::ConnectionId const& connectionId) override;
+    void outputConnectionDeleted(QtNodes::ConnectionId const& connectionId) override;
+
 private slots:
     void onLoadModelClicked();
     void onClassesFileClicked();
     void onConfidenceChanged(double value);
     void onNmsThresholdChanged(double value);
+    void onSoftNmsChanged(int state);
     void onInputSizeChanged(int index);
     void onShowBoxesChanged(int state);
     void onShowLabelsChanged(int state);
+    void onLetterboxChanged(int state);
+    void onTiledChanged(int state);
+    void onTileSizeChanged(int value);
+    void onTileOverlapChanged(int value);
+    void onTileFullFrameChanged(int state);
+    void onTileExecutionChanged(int index);
+    void onDetectIntervalChanged(int value);
+    void onSceneChangeChanged(double value);
     void onBackendChanged(int index);
+    void onWarmupRunsChanged(int value);
+    void onLoadProgress(const QString& stage, int percent);
+    void onModelLoaded(const DnnModelLoader::Result& result);
+    void onPipelinedChanged(int state);
+    void onInferenceWorkersChanged(int value);
+    void onBatchSizeChanged(int value);
+    void onBatchWaitChanged(int value);
+    void onPipelineResults();
 
 private:
     void loadModel();
+    void prepareTileContexts();
     void loadClasses();
     void runInference();
+    void runTiledInference(const cv::Mat& image);
+    cv::Size selectedInputSize() const;
     cv::Mat preprocessImage(const cv::Mat& image);
-    void postprocessAndDraw(cv::Mat& image, const std::vector<cv::Mat>& outputs);
+    BlobPreprocessor::Params blobParams(const cv::Size& inputSize, bool letterbox) const;
+    void publishDetections(const cv::Mat& image,
+                           const std::vector<cv::Rect>& boxes,
+                           const std::vector<float>& scores,
+                           const std::vector<int>& classIds);
+    void renderOutputImage();
+    void startTracking(const cv::Mat& image,
+                       const std::vector<cv::Rect>& boxes,
+                       const std::vector<float>& scores,
+                       const std::vector<int>& classIds);
+    void publishTracked(const cv::Mat& image);
+    void startPipeline();
+    void stopPipeline();
+
+    // Decode + NMS; these touch only their arguments, so they also run on
+    // the pipeline's postprocess thread
+    static void decodeOutputs(const std::vector<cv::Mat>& outputs,
+                              int version,
+                              const LetterboxTransform& transform,
+                              const BoxNms::Params& nms,
+                              YoloCandidates& candidates,
+                              std::vector<cv::Rect>& boxes,
+                              std::vector<float>& scores,
+                              std::vector<int>& classIds);
+    static void decodeCandidates(const std::vector<cv::Mat>& outputs,
+                                 int version,
+                                 const LetterboxTransform& transform,
+                                 float scoreThreshold,
+                                 YoloCandidates& candidates);
+    static void suppress(const YoloCandidates& candidates,
+                         const BoxNms::Params& nms,
+                         std::vector<cv::Rect>& boxes,
+                         std::vector<float>& scores,
+                         std::vector<int>& classIds);
     std::vector<int> getOutputLayers(const cv::dnn::Net& net);
     cv::Mat getOutputBlob(const std::vector<cv::Mat>& outputs);
 
@@ -79,14 +149,36 @@ private:
     QString m_classesPath;         // Path to classes names file
     int m_yoloVersion = 0;         // 0=YOLOv3, 1=YOLOv4, 2=YOLOv5/ONNX
     int m_backendIndex = 0;        // 0=CPU, 1=CUDA
+    int m_warmupRuns = 2;          // Dummy inferences after loading
 
     // Detection parameters
     double m_confidenceThreshold = 0.5;   // Confidence threshold (0.0-1.0)
     double m_nmsThreshold = 0.4;          // Non-maximum suppression (0.0-1.0)
+    bool m_softNms = false;               // Decay overlapping scores instead of dropping boxes
     int m_inputSizeIndex = 0;             // Input size selection
     float m_inputScale = 1.0 / 255.0;     // Scale factor
     cv::Scalar m_mean = {0, 0, 0};        // Mean subtraction
     bool m_swapRB = true;                 // Swap Red and Blue
+    bool m_letterbox = true;              // Keep aspect ratio, pad to input size
+
+    // Tiled inference for high-resolution frames (synchronous)
+    bool m_tiled = false;
+    int m_tileSize = 640;                 // Tile side in image pixels
+    int m_tileOverlap = 20;               // Percent
+    bool m_tileFullFrame = true;          // Extra full-frame pass for large objects
+    int m_tileExecution = 0;              // 0=one batched forward, 1=parallel forwards
+
+    // Detection cadence: the network runs on keyframes only, boxes are
+    // tracked on the frames in between
+    int m_detectInterval = 1;             // 1 = detect on every frame
+    double m_sceneChangeThreshold = 25.0; // Gray levels; 0 = off
+    DetectionCadence m_cadence;
+    std::vector<float> m_keyScores;       // Of the boxes being tracked
+    std::vector<int> m_keyClassIds;
+    std::vector<cv::Rect> m_trackedBoxes;
+    std::vector<int> m_trackedSources;
+    std::vector<float> m_trackedScores;
+    std::vector<int> m_trackedClassIds;
 
     // Visualization
     bool m_showBoxes = true;        // Show bounding boxes
@@ -102,14 +194,44 @@ private:
     };
     std::vector<Detection> m_detections;
     std::vector<std::string> m_classNames;
+    YoloCandidates m_candidates;   // Reused decode buffers
+    std::vector<cv::Rect> m_keptBoxes;
+    std::vector<float> m_keptScores;
+    std::vector<int> m_keptClassIds;
+    BlobPreprocessor m_preprocessor;       // Reusable blob buffers (thread-safe)
+    LetterboxTransform m_transform;       // Of the last synchronous inference
+
+    std::string className(int classId) const;
+    void drawDetection(cv::Mat& image, const Detection& det) const;
 
     // Network
-    cv::Ptr<cv::dnn::Net> m_net;
+    std::shared_ptr<SharedDnnNet> m_net;
     bool m_modelLoaded = false;
+    DnnModelLoader* m_loader = nullptr;
+
+    // Pipelined mode: preprocess, forward and postprocess of consecutive
+    // frames overlap on worker threads; m_net only changes while stopped
+    bool m_pipelined = false;
+    int m_inferenceWorkers = 1;
+    InferencePipeline* m_pipeline = nullptr;
+    int m_pipelineVersion = 2;                     // Snapshots read by the stages
+    bool m_pipelineLetterbox = true;
+    YoloCandidates m_pipelineCandidates;           // Postprocess thread only
+
+    // Batching (pipelined mode): inference workers of this node and of other
+    // nodes running the same network share forward passes
+    int m_batchSize = 1;                           // 1 disables batching
+    int m_batchWaitMs = 5;
+    std::shared_ptr<DnnBatcher> m_batcher;
+    QTimer* m_restartTimer = nullptr;              // Debounces pipeline restarts
+    DnnBatcher::Limits m_pipelineBatch;            // Snapshot read by the stages
 
     // Data
     std::shared_ptr<ImageData> m_inputImage;
-    cv::Mat m_outputImage;
+    cv::Mat m_frameImage;                          // Frame the current detections belong to
+    cv::Mat m_outputImage;                         // Only rendered while port 0 is connected
+    std::shared_ptr<DetectionData> m_detectionData;
+    int m_imageConnections = 0;
 
     // UI
     QWidget* m_widget = nullptr;
@@ -122,12 +244,27 @@ private:
     QComboBox* m_yoloVersionCombo = nullptr;
     QComboBox* m_inputSizeCombo = nullptr;
     QComboBox* m_backendCombo = nullptr;
+    QSpinBox* m_warmupSpin = nullptr;
+    QCheckBox* m_pipelinedCheck = nullptr;
+    QSpinBox* m_workersSpin = nullptr;
+    QSpinBox* m_batchSpin = nullptr;
+    QSpinBox* m_batchWaitSpin = nullptr;
     QDoubleSpinBox* m_confidenceSpin = nullptr;
     QDoubleSpinBox* m_nmsSpin = nullptr;
+    QCheckBox* m_softNmsCheck = nullptr;
     QCheckBox* m_showBoxesCheck = nullptr;
     QCheckBox* m_showLabelsCheck = nullptr;
+    QCheckBox* m_letterboxCheck = nullptr;
+    QCheckBox* m_tiledCheck = nullptr;
+    QSpinBox* m_tileSizeSpin = nullptr;
+    QSpinBox* m_tileOverlapSpin = nullptr;
+    QCheckBox* m_tileFullFrameCheck = nullptr;
+    QComboBox* m_tileExecutionCombo = nullptr;
+    QSpinBox* m_detectIntervalSpin = nullptr;
+    QDoubleSpinBox* m_sceneChangeSpin = nullptr;
     QPushButton* m_loadBtn = nullptr;
     QLabel* m_statusLabel = nullptr;
+    QProgressBar* m_loadProgress = nullptr;
     QTextEdit* m_infoText = nullptr;
 };
 
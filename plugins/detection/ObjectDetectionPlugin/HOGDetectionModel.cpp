@@ -9,6 +9,7 @@
 #include <opencv2/imgproc.hpp>
 #include <opencv2/objdetect.hpp>
 #include <opencv2/opencv_modules.hpp>
+#include <cmath>
 
 namespace VisionBox {
 
@@ -73,6 +74,30 @@ HOGDetectionModel::HOGDetectionModel()
     m_drawBoxesCheck->setChecked(true);
     layout->addWidget(m_drawBoxesCheck);
 
+    // Detection cadence (track between keyframes)
+    auto* intervalLayout = new QHBoxLayout();
+    intervalLayout->addWidget(new QLabel("Detect Every:"));
+    m_detectIntervalSpin = new QSpinBox();
+    m_detectIntervalSpin->setRange(1, 60);
+    m_detectIntervalSpin->setSuffix(" frames");
+    m_detectIntervalSpin->setValue(1);
+    m_detectIntervalSpin->setToolTip("Run HOG on every Nth frame and track the boxes\n"
+                                     "on the frames in between (1 = every frame)");
+    intervalLayout->addWidget(m_detectIntervalSpin);
+    layout->addLayout(intervalLayout);
+
+    auto* sceneLayout = new QHBoxLayout();
+    sceneLayout->addWidget(new QLabel("Scene Change:"));
+    m_sceneChangeSpin = new QDoubleSpinBox();
+    m_sceneChangeSpin->setRange(0.0, 255.0);
+    m_sceneChangeSpin->setSingleStep(5.0);
+    m_sceneChangeSpin->setDecimals(0);
+    m_sceneChangeSpin->setValue(25.0);
+    m_sceneChangeSpin->setToolTip("Detect at once when the frame's mean gray level differs this\n"
+                                  "much from the last keyframe (0 = off)");
+    sceneLayout->addWidget(m_sceneChangeSpin);
+    layout->addLayout(sceneLayout);
+
     layout->setContentsMargins(5, 5, 5, 5);
 
     // Initialize HOG descriptor with default people detector
@@ -90,6 +115,10 @@ HOGDetectionModel::HOGDetectionModel()
             this, &HOGDetectionModel::onMeanShiftChanged);
     connect(m_drawBoxesCheck, &QCheckBox::stateChanged,
             this, &HOGDetectionModel::onDrawBoxesChanged);
+    connect(m_detectIntervalSpin, &QSpinBox::valueChanged,
+            this, &HOGDetectionModel::onDetectIntervalChanged);
+    connect(m_sceneChangeSpin, &QDoubleSpinBox::valueChanged,
+            this, &HOGDetectionModel::onSceneChangeChanged);
 }
 
 /*******************************************************************************
@@ -103,7 +132,7 @@ unsigned int HOGDetectionModel::nPorts(QtNodes::PortType portType) const
     }
     else
     {
-        return 1;
+        return 2;
     }
 }
 
@@ -111,8 +140,10 @@ QtNodes::NodeDataType HOGDetectionModel::dataType(
     QtNodes::PortType portType,
     QtNodes::PortIndex portIndex) const
 {
-    Q_UNUSED(portType);
-    Q_UNUSED(portIndex);
+    if (portType == QtNodes::PortType::Out && portIndex == 1)
+    {
+        return DetectionData().type();
+    }
     return ImageData().type();
 }
 
@@ -121,7 +152,10 @@ QtNodes::NodeDataType HOGDetectionModel::dataType(
  ******************************************************************************/
 std::shared_ptr<QtNodes::NodeData> HOGDetectionModel::outData(QtNodes::PortIndex port)
 {
-    Q_UNUSED(port);
+    if (port == 1)
+    {
+        return m_detectionData;
+    }
     return m_outputImage;
 }
 
@@ -148,30 +182,35 @@ QWidget* HOGDetectionModel::embeddedWidget()
 void HOGDetectionModel::onHitThresholdChanged(double value)
 {
     m_hitThreshold = value;
+    m_cadence.reset();
     detectObjects();
 }
 
 void HOGDetectionModel::onWinStrideChanged(int value)
 {
     m_winStride = value;
+    m_cadence.reset();
     detectObjects();
 }
 
 void HOGDetectionModel::onPaddingChanged(int value)
 {
     m_padding = value;
+    m_cadence.reset();
     detectObjects();
 }
 
 void HOGDetectionModel::onScaleChanged(double value)
 {
     m_scale = value;
+    m_cadence.reset();
     detectObjects();
 }
 
 void HOGDetectionModel::onMeanShiftChanged(int state)
 {
     m_meanShift = (state == Qt::Checked);
+    m_cadence.reset();
     detectObjects();
 }
 
@@ -181,6 +220,23 @@ void HOGDetectionModel::onDrawBoxesChanged(int state)
     detectObjects();
 }
 
+void HOGDetectionModel::onDetectIntervalChanged(int value)
+{
+    m_detectInterval = value;
+    DetectionCadence::Params params = m_cadence.params();
+    params.interval = value;
+    m_cadence.setParams(params);
+    m_cadence.reset();
+}
+
+void HOGDetectionModel::onSceneChangeChanged(double value)
+{
+    m_sceneChangeThreshold = value;
+    DetectionCadence::Params params = m_cadence.params();
+    params.sceneChangeThreshold = value;
+    m_cadence.setParams(params);
+}
+
 /*******************************************************************************
  * Object Detection
  ******************************************************************************/
@@ -189,6 +245,7 @@ void HOGDetectionModel::detectObjects()
     if (!m_inputImage)
     {
         m_outputImage = nullptr;
+        m_detectionData = nullptr;
         return;
     }
 
@@ -197,7 +254,9 @@ void HOGDetectionModel::detectObjects()
     if (input.empty())
     {
         m_outputImage = nullptr;
+        m_detectionData = nullptr;
         Q_EMIT dataUpdated(0);
+        Q_EMIT dataUpdated(1);
         return;
     }
 
@@ -233,10 +292,47 @@ void HOGDetectionModel::detectObjects()
         cv::Size padding(m_padding, m_padding);
         cv::Size winSize(64, 128);  // Default HOG window size
 
-        // Detect people in image
-        m_hog.detectMultiScale(gray, foundLocations, weights,
-                              m_hitThreshold, winStride, padding,
-                              m_scale, m_meanShift);
+        const bool cadence = m_detectInterval > 1;
+        if (cadence && !m_cadence.needsDetection(input))
+        {
+            // Between keyframes: move the last detections along
+            std::vector<int> sources;
+            m_cadence.track(input, foundLocations, sources);
+            for (int source : sources)
+            {
+                weights.push_back(m_keyWeights[source]);
+            }
+        }
+        else
+        {
+            // Detect people in image
+            m_hog.detectMultiScale(gray, foundLocations, weights,
+                                  m_hitThreshold, winStride, padding,
+                                  m_scale, m_meanShift);
+            weights.resize(foundLocations.size(), 0.0);
+
+            if (cadence)
+            {
+                m_keyWeights = weights;
+                m_cadence.setDetections(input, foundLocations);
+            }
+        }
+
+        // Publish with normalized boxes; the SVM margin is squashed to [0, 1]
+        QVector<DetectionData::Detection> published;
+        published.reserve(static_cast<int>(foundLocations.size()));
+        for (size_t i = 0; i < foundLocations.size(); ++i)
+        {
+            const cv::Rect& rect = foundLocations[i];
+            published.append(DetectionData::Detection(
+                QRectF(static_cast<double>(rect.x) / input.cols,
+                       static_cast<double>(rect.y) / input.rows,
+                       static_cast<double>(rect.width) / input.cols,
+                       static_cast<double>(rect.height) / input.rows),
+                "Person",
+                static_cast<float>(1.0 / (1.0 + std::exp(-weights[i])))));
+        }
+        m_detectionData = std::make_shared<DetectionData>(published);
 
         // Draw bounding boxes
         if (m_drawBoxes)
@@ -269,11 +365,14 @@ void HOGDetectionModel::detectObjects()
 
         m_outputImage = std::make_shared<ImageData>(output);
         Q_EMIT dataUpdated(0);
+        Q_EMIT dataUpdated(1);
     }
     catch (const cv::Exception& e)
     {
         m_outputImage = nullptr;
+        m_detectionData = nullptr;
         Q_EMIT dataUpdated(0);
+        Q_EMIT dataUpdated(1);
     }
 }
 
@@ -289,6 +388,8 @@ QJsonObject HOGDetectionModel::save() const
     modelJson["scale"] = m_scale;
     modelJson["meanShift"] = m_meanShift;
     modelJson["drawBoxes"] = m_drawBoxes;
+    modelJson["detectInterval"] = m_detectInterval;
+    modelJson["sceneChangeThreshold"] = m_sceneChangeThreshold;
     return modelJson;
 }
 
@@ -336,6 +437,20 @@ void HOGDetectionModel::load(QJsonObject const& model)
         m_drawBoxesCheck->setChecked(m_drawBoxes);
     }
 
+    QJsonValue intervalJson = model["detectInterval"];
+    if (!intervalJson.isUndefined())
+    {
+        m_detectInterval = intervalJson.toInt();
+        m_detectIntervalSpin->setValue(m_detectInterval);
+    }
+
+    QJsonValue sceneChangeJson = model["sceneChangeThreshold"];
+    if (!sceneChangeJson.isUndefined())
+    {
+        m_sceneChangeThreshold = sceneChangeJson.toDouble();
+        m_sceneChangeSpin->setValue(m_sceneChangeThreshold);
+    }
+
     detectObjects();
 }
 
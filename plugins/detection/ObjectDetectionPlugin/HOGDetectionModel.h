@@ -7,6 +7,7 @@
 #define HOGDETECTIONMODEL_H
 
 #include "core/PluginInterface.h"
+#include "core/DetectionCadence.h"
 #include <QtNodes/NodeDelegateModel>
 #include <QWidget>
 #include <QVBoxLayout>
@@ -22,6 +23,7 @@
 namespace VisionBox {
 
 class ImageData;
+class DetectionData;
 
 class HOGDetectionModel : public QtNodes::NodeDelegateModel
 {
@@ -54,6 +56,8 @@ public slots:
     void onScaleChanged(double value);
     void onMeanShiftChanged(int state);
     void onDrawBoxesChanged(int state);
+    void onDetectIntervalChanged(int value);
+    void onSceneChangeChanged(double value);
 
 private:
     void detectObjects();
@@ -67,9 +71,16 @@ private:
     bool m_meanShift = false;
     bool m_drawBoxes = true;
 
+    // Detection cadence: HOG runs on keyframes, boxes are tracked in between
+    int m_detectInterval = 1;               // 1 = detect on every frame
+    double m_sceneChangeThreshold = 25.0;   // Gray levels; 0 = off
+    DetectionCadence m_cadence;
+    std::vector<double> m_keyWeights;       // Of the boxes being tracked
+
     // Data
     std::shared_ptr<ImageData> m_inputImage;
     std::shared_ptr<ImageData> m_outputImage;
+    std::shared_ptr<DetectionData> m_detectionData;
 
     // HOG descriptor
     cv::HOGDescriptor m_hog;
@@ -82,6 +93,8 @@ private:
     QDoubleSpinBox* m_scaleSpin = nullptr;
     QCheckBox* m_meanShiftCheck = nullptr;
     QCheckBox* m_drawBoxesCheck = nullptr;
+    QSpinBox* m_detectIntervalSpin = nullptr;
+    QDoubleSpinBox* m_sceneChangeSpin = nullptr;
 };
 
 } // namespace VisionBox
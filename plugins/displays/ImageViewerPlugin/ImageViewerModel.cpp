@@ -7,6 +7,8 @@
 #include "core/VisionDataTypes.h"
 #include "core/PerformanceMonitor.h"
 #include <QVBoxLayout>
+#include <QGuiApplication>
+#include <QScreen>
 #include <opencv2/opencv.hpp>
 #include <opencv2/imgproc.hpp>
 
@@ -33,6 +35,17 @@ ImageViewerModel::ImageViewerModel()
 
     auto* layout = new QVBoxLayout(m_label);
     layout->setContentsMargins(0, 0, 0, 0);
+
+    // Repaint no faster than the screen can show, however fast frames arrive
+    qreal refreshRate = 60.0;
+    if (QScreen* screen = QGuiApplication::primaryScreen())
+    {
+        refreshRate = qBound<qreal>(1.0, screen->refreshRate(), 240.0);
+    }
+    m_displayTimer = new QTimer(this);
+    m_displayTimer->setInterval(qMax(1, qRound(1000.0 / refreshRate)));
+    connect(m_displayTimer, &QTimer::timeout,
+            this, &ImageViewerModel::onDisplayTick);
 }
 
 /*******************************************************************************
@@ -75,7 +88,13 @@ void ImageViewerModel::setInData(std::shared_ptr<QtNodes::NodeData> data,
 
     m_inputImage = std::dynamic_pointer_cast<ImageData>(data);
     m_imageChanged = true;
-    updateImage();
+
+    // Show the first frame of a burst at once; later ones wait for the tick
+    if (!m_displayTimer->isActive())
+    {
+        updateImage();
+        m_displayTimer->start();
+    }
 }
 
 /*******************************************************************************
@@ -112,50 +131,13 @@ void ImageViewerModel::updateImage()
         return;
     }
 
-    // Convert cv::Mat to QImage
-    QImage qImage;
-    switch (image.channels())
+    if (!renderToLabel(image))
     {
-        case 1: // Grayscale
-            qImage = QImage(
-                image.data,
-                image.cols,
-                image.rows,
-                static_cast<int>(image.step),
-                QImage::Format_Grayscale8
-            );
-            break;
-        case 3: // BGR
-            qImage = QImage(
-                image.data,
-                image.cols,
-                image.rows,
-                static_cast<int>(image.step),
-                QImage::Format_RGB888
-            ).rgbSwapped(); // BGR to RGB
-            break;
-        case 4: // BGRA
-            qImage = QImage(
-                image.data,
-                image.cols,
-                image.rows,
-                static_cast<int>(image.step),
-                QImage::Format_ARGB32
-            ).rgbSwapped(); // BGRA to ARGB
-            break;
-        default:
-            m_label->setText("Unsupported\nFormat");
-            return;
+        m_label->setPixmap(QPixmap());
+        m_label->setText("Unsupported\nFormat");
+        return;
     }
 
-    // Scale image to fit label while maintaining aspect ratio
-    QPixmap pixmap = QPixmap::fromImage(qImage);
-    m_label->setPixmap(pixmap.scaled(
-        m_label->size(),
-        Qt::KeepAspectRatio,
-        Qt::SmoothTransformation
-    ));
-
     // Update tooltip with image info
     m_label->setToolTip(QString("Size: %1x%2\nChannels: %3\nDepth: %4")
         .arg(image.cols)
@@ -164,6 +146,53 @@ void ImageViewerModel::updateImage()
         .arg(image.depth()));
 }
 
+void ImageViewerModel::onDisplayTick()
+{
+    if (!m_imageChanged)
+    {
+        // Input went quiet; the next frame is shown immediately again
+        m_displayTimer->stop();
+        return;
+    }
+    updateImage();
+}
+
+/*******************************************************************************
+ * Rendering
+ ******************************************************************************/
+bool ImageViewerModel::renderToLabel(const cv::Mat& image)
+{
+    // Fit into the label (inside its border) keeping the aspect ratio
+    const QSize area = m_label->contentsRect().size();
+    const double scale = std::min(static_cast<double>(area.width()) / image.cols,
+                                  static_cast<double>(area.height()) / image.rows);
+    const cv::Size target(std::max(1, static_cast<int>(image.cols * scale)),
+                          std::max(1, static_cast<int>(image.rows * scale)));
+
+    // Resize before any conversion so the per-pixel work is label-sized.
+    // m_scaled only ever holds our own pixels: resize() reuses its buffer,
+    // which must never be an upstream frame.
+    cv::Mat shown = image;
+    if (target != image.size())
+    {
+        cv::resize(image, m_scaled, target, 0, 0,
+                   scale < 1.0 ? cv::INTER_AREA : cv::INTER_LINEAR);
+        shown = m_scaled;
+    }
+
+    // Same conversion as every other display path (8-bit wraps without
+    // copying); fromImage() makes the only copy, before m_scaled is reused
+    QImage qImage = ImageData(shown).toQImage();
+    if (qImage.isNull())
+    {
+        return false;
+    }
+
+    m_pixmap = QPixmap::fromImage(qImage);
+    m_label->setPixmap(m_pixmap);
+    return true;
+}
+
 /*******************************************************************************
  * Serialization
  ******************************************************************************/
@@ -12,6 +12,7 @@
 #include <QString>
 #include <QLabel>
 #include <QPixmap>
+#include <QTimer>
 #include <opencv2/opencv.hpp>
 
 namespace VisionBox {
@@ -52,12 +53,23 @@ public:
 
 private slots:
     void updateImage();
+    void onDisplayTick();
 
 private:
+    // Downscale to the label and convert through ImageData::toQImage();
+    // returns false if unsupported
+    bool renderToLabel(const cv::Mat& image);
+
     std::shared_ptr<ImageData> m_inputImage;
     QLabel* m_label = nullptr;
     QPixmap m_pixmap;
     bool m_imageChanged = false;
+
+    // Display throttle: at most one repaint per screen refresh
+    QTimer* m_displayTimer = nullptr;
+
+    // Reused resize buffer (label-sized, not frame-sized)
+    cv::Mat m_scaled;
 };
 
 } // namespace VisionBox
@@ -5,8 +5,11 @@
 
 #include "DataExporterModel.h"
 #include "core/VisionDataTypes.h"
+#include "core/PerformanceMonitor.h"
+#include "core/ExportNaming.h"
 #include <opencv2/opencv.hpp>
 #include <QDir>
+#include <QFileInfo>
 #include <QDateTime>
 #include <QCoreApplication>
 
@@ -45,6 +48,8 @@ DataExporterModel::DataExporterModel()
     m_formatCombo = new QComboBox();
     m_formatCombo->addItem("CSV", static_cast<int>(CSV));
     m_formatCombo->addItem("JSON", static_cast<int>(JSON));
+    m_formatCombo->addItem("JSON Lines", static_cast<int>(JSONLines));
+    m_formatCombo->addItem("Binary Log (.vbdl)", static_cast<int>(BinaryLog));
     m_formatCombo->setCurrentIndex(0);
     m_formatCombo->setMinimumWidth(150);
     formatLayout->addWidget(m_formatCombo);
@@ -70,9 +75,43 @@ DataExporterModel::DataExporterModel()
 
     // Include timestamp
     m_includeTimestampCheck = new QCheckBox("Include Timestamp");
-    m_includeTimestampCheck->setToolTip("Add timestamp to filename (e.g., data_20250127_143000.csv)");
+    m_includeTimestampCheck->setToolTip("Add timestamp to filename (e.g., data_20250127_143000_123.csv)");
     layout->addWidget(m_includeTimestampCheck);
 
+    // Streaming (append one row per frame)
+    m_streamCheck = new QCheckBox("Stream Every Frame (append)");
+    m_streamCheck->setToolTip("Keep the file open and append one CSV row / JSON line per frame");
+    layout->addWidget(m_streamCheck);
+
+    auto* rotateLayout = new QHBoxLayout();
+    rotateLayout->addWidget(new QLabel("Rotate:"));
+    m_rotateSizeSpin = new QSpinBox();
+    m_rotateSizeSpin->setRange(0, 65536);
+    m_rotateSizeSpin->setValue(m_rotateSizeMB);
+    m_rotateSizeSpin->setSuffix(" MB");
+    m_rotateSizeSpin->setSpecialValueText("Off");
+    m_rotateSizeSpin->setToolTip("Start a new file after this size");
+    rotateLayout->addWidget(m_rotateSizeSpin);
+    m_rotateFramesSpin = new QSpinBox();
+    m_rotateFramesSpin->setRange(0, 100000000);
+    m_rotateFramesSpin->setValue(m_rotateFrames);
+    m_rotateFramesSpin->setSuffix(" frames");
+    m_rotateFramesSpin->setSpecialValueText("Off");
+    m_rotateFramesSpin->setToolTip("Start a new file after this many frames");
+    rotateLayout->addWidget(m_rotateFramesSpin);
+    layout->addLayout(rotateLayout);
+
+    auto* fsyncLayout = new QHBoxLayout();
+    fsyncLayout->addWidget(new QLabel("Fsync Every:"));
+    m_fsyncSpin = new QSpinBox();
+    m_fsyncSpin->setRange(0, 3600);
+    m_fsyncSpin->setValue(m_fsyncSeconds);
+    m_fsyncSpin->setSuffix(" s");
+    m_fsyncSpin->setSpecialValueText("Never");
+    m_fsyncSpin->setToolTip("Force written rows to disk at this interval");
+    fsyncLayout->addWidget(m_fsyncSpin);
+    layout->addLayout(fsyncLayout);
+
     // Export button
     m_exportBtn = new QPushButton("Export Data");
     m_exportBtn->setEnabled(false);
@@ -92,6 +131,10 @@ DataExporterModel::DataExporterModel()
 
     layout->setContentsMargins(5, 5, 5, 5);
 
+    // Streaming status refresh
+    m_streamTimer = new QTimer(this);
+    m_streamTimer->setInterval(500);
+
     // Connect signals
     connect(m_browseBtn, &QPushButton::clicked,
             this, &DataExporterModel::onBrowseClicked);
@@ -105,6 +148,27 @@ DataExporterModel::DataExporterModel()
             this, &DataExporterModel::onAutoIncrementChanged);
     connect(m_includeTimestampCheck, &QCheckBox::stateChanged,
             this, &DataExporterModel::onIncludeTimestampChanged);
+    connect(m_streamCheck, &QCheckBox::stateChanged,
+            this, &DataExporterModel::onStreamToggled);
+    connect(m_rotateSizeSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &DataExporterModel::onStreamOptionsChanged);
+    connect(m_rotateFramesSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &DataExporterModel::onStreamOptionsChanged);
+    connect(m_fsyncSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &DataExporterModel::onStreamOptionsChanged);
+    connect(m_streamTimer, &QTimer::timeout,
+            this, &DataExporterModel::updateStreamStatus);
+}
+
+DataExporterModel::~DataExporterModel()
+{
+    // Flush a partial BinaryLog block; the widgets may already be gone, so
+    // this does not go through stopStreaming()
+    if (m_streaming && m_logEncoder.pendingFrames() > 0)
+    {
+        m_writer.append(m_logEncoder.takeBlock());
+    }
+    m_writer.stop();
 }
 
 /*******************************************************************************
@@ -114,7 +178,7 @@ unsigned int DataExporterModel::nPorts(QtNodes::PortType portType) const
 {
     if (portType == QtNodes::PortType::In)
     {
-        return 1; // One input image (optional)
+        return 3; // Image, detections, keypoints (all optional)
     }
     else
     {
@@ -127,8 +191,16 @@ QtNodes::NodeDataType DataExporterModel::dataType(
     QtNodes::PortIndex portIndex) const
 {
     Q_UNUSED(portType);
-    Q_UNUSED(portIndex);
-    return ImageData().type();
+
+    switch (portIndex)
+    {
+        case 1:
+            return DetectionData().type();
+        case 2:
+            return KeypointData().type();
+        default:
+            return ImageData().type();
+    }
 }
 
 /*******************************************************************************
@@ -143,22 +215,50 @@ std::shared_ptr<QtNodes::NodeData> DataExporterModel::outData(QtNodes::PortIndex
 void DataExporterModel::setInData(std::shared_ptr<QtNodes::NodeData> data,
                                    QtNodes::PortIndex portIndex)
 {
-    Q_UNUSED(portIndex);
-    m_inputImage = std::dynamic_pointer_cast<ImageData>(data);
+    bool binaryLog = (m_formatIndex == static_cast<int>(BinaryLog));
 
-    // Collect data from image when available
-    if (m_inputImage)
+    if (portIndex == 1)
     {
-        collectDataFromImage();
-        m_hasImageData = true;
+        m_inputDetections = std::dynamic_pointer_cast<DetectionData>(data);
+        m_detectionsPending = static_cast<bool>(m_inputDetections);
+    }
+    else if (portIndex == 2)
+    {
+        m_inputKeypoints = std::dynamic_pointer_cast<KeypointData>(data);
+        if (m_streaming && binaryLog && m_inputKeypoints && !m_inputDetections)
+        {
+            logCurrentFrame();
+        }
     }
     else
     {
-        m_hasImageData = false;
+        m_inputImage = std::dynamic_pointer_cast<ImageData>(data);
+
+        // Collect data from image when available
+        if (m_inputImage)
+        {
+            collectDataFromImage();
+            m_hasImageData = true;
+        }
+        else
+        {
+            m_hasImageData = false;
+        }
+        m_imagePending = m_hasImageData;
+    }
+
+    if (m_streaming && portIndex != 2)
+    {
+        streamPairedFrame();
     }
 
     // Enable export button if we have data and path
-    m_exportBtn->setEnabled(m_hasImageData && !m_outputPath.isEmpty());
+    m_exportBtn->setEnabled(hasExportData() && !m_outputPath.isEmpty() && !m_streaming);
+}
+
+bool DataExporterModel::hasExportData() const
+{
+    return m_hasImageData || m_inputDetections || m_inputKeypoints;
 }
 
 /*******************************************************************************
@@ -184,13 +284,13 @@ void DataExporterModel::onBrowseClicked()
     {
         m_outputPath = dir;
         m_pathEdit->setText(dir);
-        m_exportBtn->setEnabled(m_hasImageData);
+        m_exportBtn->setEnabled(hasExportData() && !m_streaming);
     }
 }
 
 void DataExporterModel::onExportClicked()
 {
-    if (!m_hasImageData)
+    if (!hasExportData())
     {
         m_statusLabel->setText("Status: No data to export");
         return;
@@ -214,9 +314,10 @@ void DataExporterModel::onExportClicked()
     }
 
     // Export data
-    if (exportData())
+    QString fileName = generateFileName();
+    if (exportData(fileName))
     {
-        m_statusLabel->setText(QString("Status: Exported to %1").arg(generateFileName()));
+        m_statusLabel->setText(QString("Status: Exported to %1").arg(fileName));
 
         // Increment frame counter for next export
         if (m_autoIncrement)
@@ -256,12 +357,70 @@ void DataExporterModel::onIncludeTimestampChanged(int state)
     m_includeTimestamp = (state == Qt::Checked);
 }
 
+void DataExporterModel::onStreamToggled(int state)
+{
+    bool enable = (state == Qt::Checked);
+    if (enable == m_streaming)
+    {
+        return;
+    }
+
+    if (enable)
+    {
+        if (!startStreaming())
+        {
+            m_streamCheck->blockSignals(true);
+            m_streamCheck->setChecked(false);
+            m_streamCheck->blockSignals(false);
+        }
+    }
+    else
+    {
+        stopStreaming();
+    }
+}
+
+void DataExporterModel::onStreamOptionsChanged()
+{
+    m_rotateSizeMB = m_rotateSizeSpin->value();
+    m_rotateFrames = m_rotateFramesSpin->value();
+    m_fsyncSeconds = m_fsyncSpin->value();
+}
+
+void DataExporterModel::updateStreamStatus()
+{
+    if (!m_streaming)
+    {
+        return;
+    }
+
+    if (!m_writer.lastError().isEmpty())
+    {
+        QString error = m_writer.lastError();
+        stopStreaming();
+        m_statusLabel->setText(QString("Status: Streaming stopped - %1").arg(error));
+        return;
+    }
+
+    // Binary logs write whole blocks, so count frames as they are queued
+    double writtenMB = m_writer.bytesWritten() / (1024.0 * 1024.0);
+    qint64 rows = (m_formatIndex == static_cast<int>(BinaryLog)) ? m_streamFrame
+                                                                 : m_writer.recordsWritten();
+    m_statusLabel->setText(QString("Status: Streaming %1 rows (%2 MB) -> %3")
+                               .arg(rows)
+                               .arg(writtenMB, 0, 'f', 2)
+                               .arg(QFileInfo(m_writer.currentFilePath()).fileName()));
+
+    PerformanceMonitor::instance()->recordMetric(this, caption(), "queueDepth",
+                                                 m_writer.pendingRecords());
+    PerformanceMonitor::instance()->recordMetric(this, caption(), "writtenMB", writtenMB);
+}
+
 /*******************************************************************************
  * Data Export
  ******************************************************************************/
-bool DataExporterModel::exportData()
+bool DataExporterModel::exportData(const QString& fileName)
 {
-    QString fileName = generateFileName();
     QString filePath = QDir(m_outputPath).absoluteFilePath(fileName);
 
     if (m_formatIndex == static_cast<int>(CSV))
@@ -272,6 +431,22 @@ bool DataExporterModel::exportData()
     {
         return exportToJSON(filePath);
     }
+    else if (m_formatIndex == static_cast<int>(JSONLines))
+    {
+        // One compact line appended per export
+        QFile file(filePath);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Append))
+        {
+            m_statusLabel->setText("Status: Failed to open file");
+            return false;
+        }
+        file.write(QJsonDocument(streamRecord()).toJson(QJsonDocument::Compact) + '\n');
+        return true;
+    }
+    else if (m_formatIndex == static_cast<int>(BinaryLog))
+    {
+        return exportToBinaryLog(filePath);
+    }
 
     return false;
 }
@@ -323,10 +498,24 @@ bool DataExporterModel::exportToCSV(const QString& filePath)
         }
         else if (exportType == static_cast<int>(DetectionResults))
         {
-            // Detection results would be exported here
-            // Placeholder for future implementation
             out << "Frame,X,Y,Width,Height,Confidence,Class\n";
-            out << "No detection data available\n";
+            if (m_inputDetections)
+            {
+                qint64 frame = 0;
+                double timestampMs = 0.0;
+                currentFrameClock(frame, timestampMs);
+                for (const auto& detection : m_inputDetections->detections())
+                {
+                    out << QString("%1,%2,%3,%4,%5,%6,%7\n")
+                               .arg(frame)
+                               .arg(detection.bbox.x(), 0, 'f', 6)
+                               .arg(detection.bbox.y(), 0, 'f', 6)
+                               .arg(detection.bbox.width(), 0, 'f', 6)
+                               .arg(detection.bbox.height(), 0, 'f', 6)
+                               .arg(detection.confidence, 0, 'f', 4)
+                               .arg(detection.label);
+                }
+            }
         }
 
         file.close();
@@ -396,7 +585,20 @@ bool DataExporterModel::exportToJSON(const QString& filePath)
             root["frame_number"] = m_frameCount;
 
             QJsonArray detections;
-            // Placeholder for future detection data
+            if (m_inputDetections)
+            {
+                for (const auto& detection : m_inputDetections->detections())
+                {
+                    QJsonObject item;
+                    item["x"] = detection.bbox.x();
+                    item["y"] = detection.bbox.y();
+                    item["width"] = detection.bbox.width();
+                    item["height"] = detection.bbox.height();
+                    item["confidence"] = detection.confidence;
+                    item["label"] = detection.label;
+                    detections.append(item);
+                }
+            }
             root["detections"] = detections;
         }
 
@@ -413,24 +615,58 @@ bool DataExporterModel::exportToJSON(const QString& filePath)
     }
 }
 
+bool DataExporterModel::exportToBinaryLog(const QString& filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append))
+    {
+        m_statusLabel->setText("Status: Failed to open file");
+        return false;
+    }
+
+    qint64 frame = 0;
+    double timestampMs = 0.0;
+    currentFrameClock(frame, timestampMs);
+
+    DetectionLogEncoder encoder(1);
+    encoder.addFrame(frame, timestampMs,
+                     m_inputDetections ? m_inputDetections->detections()
+                                       : QVector<DetectionData::Detection>(),
+                     m_inputKeypoints ? m_inputKeypoints->keypoints()
+                                      : std::vector<cv::KeyPoint>());
+
+    if (file.size() == 0)
+    {
+        file.write(DetectionLogEncoder::fileHeader());
+    }
+    file.write(encoder.takeBlock());
+    return true;
+}
+
 QString DataExporterModel::generateFileName()
 {
     QString prefix = m_prefixEdit->text().isEmpty() ? "data" : m_prefixEdit->text();
-    QString extension = (m_formatIndex == static_cast<int>(CSV)) ? ".csv" : ".json";
+    QString extension = streamExtension();
 
     QString fileName = prefix;
 
     if (m_includeTimestamp)
     {
-        fileName += "_" + getCurrentTimestamp();
+        fileName += "_" + ExportNaming::timestamp();
     }
 
     if (m_autoIncrement)
     {
-        // Format: prefix_001.ext or prefix_20250127_143000_001.ext
+        // Format: prefix_001.ext or prefix_20250127_143000_123_001.ext
         fileName += QString("_%1").arg(m_frameCount, 3, 10, QChar('0'));
     }
 
+    if (m_includeTimestamp)
+    {
+        // Two exports within the same millisecond get distinct names
+        fileName = ExportNaming::uniqueStem(m_outputPath, fileName, extension);
+    }
+
     return fileName + extension;
 }
 
@@ -486,6 +722,253 @@ void DataExporterModel::collectDataFromImage()
     m_previewText->setText(preview);
 }
 
+/*******************************************************************************
+ * Streaming
+ ******************************************************************************/
+bool DataExporterModel::startStreaming()
+{
+    if (m_outputPath.isEmpty())
+    {
+        m_statusLabel->setText("Status: No output directory");
+        return false;
+    }
+
+    QString prefix = m_prefixEdit->text().isEmpty() ? "data" : m_prefixEdit->text();
+    if (m_includeTimestamp)
+    {
+        // A stream started in the same millisecond as another gets its own files
+        const bool rotating = m_rotateSizeMB > 0 || m_rotateFrames > 0;
+        prefix = ExportNaming::uniqueStem(m_outputPath, prefix + "_" + ExportNaming::timestamp(),
+                                          (rotating ? "_000" : "") + streamExtension());
+    }
+
+    StreamingFileWriter::Options options;
+    options.basePath = QDir(m_outputPath).absoluteFilePath(prefix);
+    options.extension = streamExtension();
+    options.rotateBytes = static_cast<qint64>(m_rotateSizeMB) * 1024 * 1024;
+    options.rotateRecords = m_rotateFrames;
+    options.fsyncIntervalMs = m_fsyncSeconds * 1000;
+    if (m_formatIndex == static_cast<int>(CSV))
+    {
+        options.header = streamFields().join(',').toUtf8() + '\n';
+    }
+    else if (m_formatIndex == static_cast<int>(BinaryLog))
+    {
+        // Records are blocks of frames; round the frame limit up to whole blocks
+        options.header = DetectionLogEncoder::fileHeader();
+        int blockFrames = m_logEncoder.framesPerBlock();
+        options.rotateRecords = (m_rotateFrames + blockFrames - 1) / blockFrames;
+        m_logEncoder = DetectionLogEncoder(blockFrames);
+    }
+
+    if (!m_writer.start(options))
+    {
+        m_statusLabel->setText(QString("Status: %1").arg(m_writer.lastError()));
+        return false;
+    }
+
+    m_streaming = true;
+    m_streamFrame = 0;
+    m_imagePending = false;
+    m_detectionsPending = false;
+    setOptionsEditable(false);
+    m_exportBtn->setEnabled(false);
+    m_streamTimer->start();
+    m_statusLabel->setText(QString("Status: Streaming to %1")
+                               .arg(QFileInfo(m_writer.currentFilePath()).fileName()));
+    return true;
+}
+
+void DataExporterModel::stopStreaming()
+{
+    m_streamTimer->stop();
+    if (m_logEncoder.pendingFrames() > 0)
+    {
+        m_writer.append(m_logEncoder.takeBlock());
+    }
+    m_writer.stop();
+    m_streaming = false;
+    setOptionsEditable(true);
+    m_exportBtn->setEnabled(hasExportData() && !m_outputPath.isEmpty());
+    m_statusLabel->setText(QString("Status: Stream closed, %1 rows written")
+                               .arg(m_writer.recordsWritten()));
+}
+
+void DataExporterModel::streamPairedFrame()
+{
+    // A frame's row waits for both its image and its detections, in
+    // whichever order they arrive, so counts never land on the wrong frame
+    bool ready = false;
+    if (m_formatIndex == static_cast<int>(BinaryLog))
+    {
+        ready = m_detectionsPending && (m_imagePending || !m_inputImage);
+    }
+    else
+    {
+        const bool pairDetections =
+            m_exportTypeIndex == static_cast<int>(DetectionResults) && m_inputDetections;
+        ready = m_imagePending && (m_detectionsPending || !pairDetections);
+    }
+
+    if (!ready)
+    {
+        return;
+    }
+    m_imagePending = false;
+    m_detectionsPending = false;
+
+    if (m_formatIndex == static_cast<int>(BinaryLog))
+    {
+        logCurrentFrame();
+    }
+    else
+    {
+        streamCurrentFrame();
+    }
+}
+
+void DataExporterModel::streamCurrentFrame()
+{
+    QByteArray line;
+    if (m_formatIndex == static_cast<int>(CSV))
+    {
+        QJsonObject record = streamRecord();
+        QStringList values;
+        for (const QString& field : streamFields())
+        {
+            values << record[field].toVariant().toString();
+        }
+        line = values.join(',').toUtf8();
+    }
+    else
+    {
+        line = QJsonDocument(streamRecord()).toJson(QJsonDocument::Compact);
+    }
+    line += '\n';
+
+    if (m_writer.append(std::move(line)))
+    {
+        m_streamFrame++;
+    }
+}
+
+void DataExporterModel::logCurrentFrame()
+{
+    qint64 frame = 0;
+    double timestampMs = 0.0;
+    currentFrameClock(frame, timestampMs);
+
+    bool blockFull = m_logEncoder.addFrame(
+        frame, timestampMs,
+        m_inputDetections ? m_inputDetections->detections()
+                          : QVector<DetectionData::Detection>(),
+        m_inputKeypoints ? m_inputKeypoints->keypoints() : std::vector<cv::KeyPoint>());
+    m_streamFrame++;
+
+    if (blockFull)
+    {
+        m_writer.append(m_logEncoder.takeBlock());
+    }
+}
+
+void DataExporterModel::currentFrameClock(qint64& frame, double& timestampMs) const
+{
+    // Prefer the source's own frame numbering and clock when it provides them
+    if (m_inputImage && m_inputImage->frameIndex() >= 0)
+    {
+        frame = m_inputImage->frameIndex();
+        timestampMs = m_inputImage->timestampMs();
+        return;
+    }
+
+    frame = m_streamFrame;
+    timestampMs = static_cast<double>(QDateTime::currentMSecsSinceEpoch());
+}
+
+QStringList DataExporterModel::streamFields() const
+{
+    QStringList fields = {"frame", "timestamp_ms"};
+
+    switch (m_exportTypeIndex)
+    {
+        case ImageInfo:
+            fields << "width" << "height" << "channels" << "depth"
+                   << "min_value" << "max_value";
+            break;
+        case Statistics:
+            fields << "width" << "height" << "channels" << "depth"
+                   << "min_value" << "max_value" << "mean" << "std_dev";
+            break;
+        case Histogram:
+            fields << "width" << "height" << "channels" << "mean";
+            break;
+        case DetectionResults:
+            fields << "detections";
+            break;
+    }
+
+    return fields;
+}
+
+QJsonObject DataExporterModel::streamRecord() const
+{
+    qint64 frame = 0;
+    double timestampMs = 0.0;
+    currentFrameClock(frame, timestampMs);
+
+    QJsonObject record;
+    record["frame"] = frame;
+    record["timestamp_ms"] = timestampMs;
+    record["width"] = m_imageInfo.width;
+    record["height"] = m_imageInfo.height;
+    record["channels"] = m_imageInfo.channels;
+    record["depth"] = m_imageInfo.depth;
+    record["min_value"] = m_imageInfo.minValue;
+    record["max_value"] = m_imageInfo.maxValue;
+    record["mean"] = m_imageInfo.meanValue;
+    record["std_dev"] = m_imageInfo.stdDev;
+    record["detections"] = m_inputDetections ? m_inputDetections->count() : 0;
+
+    // Keep only the columns of the selected export type
+    const QStringList fields = streamFields();
+    for (const QString& key : record.keys())
+    {
+        if (!fields.contains(key))
+        {
+            record.remove(key);
+        }
+    }
+
+    return record;
+}
+
+QString DataExporterModel::streamExtension() const
+{
+    switch (m_formatIndex)
+    {
+        case CSV:
+            return ".csv";
+        case JSONLines:
+            return ".jsonl";
+        case BinaryLog:
+            return ".vbdl";
+        default:
+            return ".json";
+    }
+}
+
+void DataExporterModel::setOptionsEditable(bool editable)
+{
+    m_browseBtn->setEnabled(editable);
+    m_prefixEdit->setEnabled(editable);
+    m_formatCombo->setEnabled(editable);
+    m_exportTypeCombo->setEnabled(editable);
+    m_includeTimestampCheck->setEnabled(editable);
+    m_rotateSizeSpin->setEnabled(editable);
+    m_rotateFramesSpin->setEnabled(editable);
+    m_fsyncSpin->setEnabled(editable);
+}
+
 /*******************************************************************************
  * Serialization
  ******************************************************************************/
@@ -499,6 +982,10 @@ QJsonObject DataExporterModel::save() const
     modelJson["autoIncrement"] = m_autoIncrement;
     modelJson["includeTimestamp"] = m_includeTimestamp;
     modelJson["frameCount"] = m_frameCount;
+    modelJson["streaming"] = m_streaming;
+    modelJson["rotateSizeMB"] = m_rotateSizeMB;
+    modelJson["rotateFrames"] = m_rotateFrames;
+    modelJson["fsyncSeconds"] = m_fsyncSeconds;
     return modelJson;
 }
 
@@ -569,6 +1056,34 @@ void DataExporterModel::load(QJsonObject const& model)
     {
         m_frameCount = frameCountJson.toInt();
     }
+
+    QJsonValue rotateSizeJson = model["rotateSizeMB"];
+    if (!rotateSizeJson.isUndefined())
+    {
+        m_rotateSizeMB = rotateSizeJson.toInt();
+        m_rotateSizeSpin->setValue(m_rotateSizeMB);
+    }
+
+    QJsonValue rotateFramesJson = model["rotateFrames"];
+    if (!rotateFramesJson.isUndefined())
+    {
+        m_rotateFrames = rotateFramesJson.toInt();
+        m_rotateFramesSpin->setValue(m_rotateFrames);
+    }
+
+    QJsonValue fsyncJson = model["fsyncSeconds"];
+    if (!fsyncJson.isUndefined())
+    {
+        m_fsyncSeconds = fsyncJson.toInt();
+        m_fsyncSpin->setValue(m_fsyncSeconds);
+    }
+
+    // Streaming resumes (appending) once all options are restored
+    QJsonValue streamingJson = model["streaming"];
+    if (!streamingJson.isUndefined())
+    {
+        m_streamCheck->setChecked(streamingJson.toBool());
+    }
 }
 
 } // namespace VisionBox
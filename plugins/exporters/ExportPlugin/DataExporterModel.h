@@ -7,6 +7,8 @@
 #define VISIONBOX_DATAEXPORTERMODEL_H
 
 #include "core/PluginInterface.h"
+#include "core/DetectionLog.h"
+#include "StreamingFileWriter.h"
 #include <QtNodes/NodeDelegateModel>
 #include <QWidget>
 #include <QVBoxLayout>
@@ -18,6 +20,8 @@
 #include <QComboBox>
 #include <QCheckBox>
 #include <QTextEdit>
+#include <QSpinBox>
+#include <QTimer>
 #include <QFile>
 #include <QTextStream>
 #include <QJsonDocument>
@@ -26,10 +30,17 @@
 
 namespace VisionBox {
 
-class ImageData;
-
 /*******************************************************************************
- * DataExporterModel - Export data to CSV/JSON files
+ * DataExporterModel - Export data to CSV/JSON/binary log files
+ *
+ * Inputs: image (statistics), detections and keypoints (all optional).
+ *
+ * Two modes:
+ *   - Single export: the button writes one CSV/JSON document per click
+ *   - Streaming: every incoming frame appends one CSV row or JSON line to a
+ *     file kept open by a background writer, with optional fsync and rotation.
+ *     The binary log format records one frame per incoming detection set
+ *     (or keypoint set when no detections are connected), see DetectionLog.h
  ******************************************************************************/
 class DataExporterModel : public QtNodes::NodeDelegateModel
 {
@@ -37,7 +48,7 @@ class DataExporterModel : public QtNodes::NodeDelegateModel
 
 public:
     DataExporterModel();
-    ~DataExporterModel() override = default;
+    ~DataExporterModel() override;
 
     QString caption() const override { return "Data Exporter"; }
     QString name() const override { return "DataExporterModel"; }
@@ -62,20 +73,39 @@ private slots:
     void onExportTypeChanged();
     void onAutoIncrementChanged(int state);
     void onIncludeTimestampChanged(int state);
+    void onStreamToggled(int state);
+    void onStreamOptionsChanged();
+    void updateStreamStatus();
 
 private:
-    bool exportData();
+    bool exportData(const QString& fileName);
     bool exportToCSV(const QString& filePath);
     bool exportToJSON(const QString& filePath);
+    bool exportToBinaryLog(const QString& filePath);
+    bool hasExportData() const;
+    void currentFrameClock(qint64& frame, double& timestampMs) const;
     QString generateFileName();
     void collectDataFromImage();
     QString getCurrentTimestamp() const;
 
+    // Streaming
+    bool startStreaming();
+    void stopStreaming();
+    void streamPairedFrame();
+    void streamCurrentFrame();
+    void logCurrentFrame();
+    QStringList streamFields() const;
+    QJsonObject streamRecord() const;
+    QString streamExtension() const;
+    void setOptionsEditable(bool editable);
+
 private:
     enum ExportFormat
     {
         CSV,
-        JSON
+        JSON,
+        JSONLines,
+        BinaryLog
     };
 
     enum ExportType
@@ -95,6 +125,15 @@ private:
     bool m_includeTimestamp = false; // Include timestamp in filename
     int m_frameCount = 0;            // Frame counter for auto-increment
 
+    // Streaming parameters
+    bool m_streaming = false;        // Append every incoming frame
+    int m_rotateSizeMB = 0;          // Rotate after this many MB (0 = off)
+    int m_rotateFrames = 0;          // Rotate after this many rows (0 = off)
+    int m_fsyncSeconds = 5;          // fsync interval (0 = never)
+    qint64 m_streamFrame = 0;        // Rows queued since streaming started
+    bool m_imagePending = false;     // Inputs received since the last row
+    bool m_detectionsPending = false;
+
     // Collected data
     struct ImageInfo
     {
@@ -112,6 +151,13 @@ private:
 
     // Data
     std::shared_ptr<ImageData> m_inputImage;
+    std::shared_ptr<DetectionData> m_inputDetections;
+    std::shared_ptr<KeypointData> m_inputKeypoints;
+
+    // Background writer for streaming mode
+    StreamingFileWriter m_writer;
+    DetectionLogEncoder m_logEncoder;
+    QTimer* m_streamTimer = nullptr;
 
     // UI
     QWidget* m_widget = nullptr;
@@ -122,6 +168,10 @@ private:
     QComboBox* m_exportTypeCombo = nullptr;
     QCheckBox* m_autoIncrementCheck = nullptr;
     QCheckBox* m_includeTimestampCheck = nullptr;
+    QCheckBox* m_streamCheck = nullptr;
+    QSpinBox* m_rotateSizeSpin = nullptr;
+    QSpinBox* m_rotateFramesSpin = nullptr;
+    QSpinBox* m_fsyncSpin = nullptr;
     QPushButton* m_exportBtn = nullptr;
     QLabel* m_statusLabel = nullptr;
     QTextEdit* m_previewText = nullptr;
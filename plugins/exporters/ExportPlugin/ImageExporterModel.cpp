@@ -5,18 +5,33 @@
 
 #include "ImageExporterModel.h"
 #include "core/VisionDataTypes.h"
+#include "core/PerformanceMonitor.h"
+#include "core/FrameCodec.h"
+#include "core/ExportNaming.h"
 #include <opencv2/opencv.hpp>
 #include <QDir>
+#include <QFile>
 #include <QFileInfo>
 #include <QDateTime>
+#include <QMutexLocker>
 
 namespace VisionBox {
 
 /*******************************************************************************
- * Constructor
+ * Constructor / Destructor
  ******************************************************************************/
 ImageExporterModel::ImageExporterModel()
+    : m_queue(32)
 {
+    m_threadCount = std::max(1, std::min(8, static_cast<int>(std::thread::hardware_concurrency())));
+    m_clock.start();
+
+    // Throughput report refresh (workers never touch the UI)
+    m_reportTimer = new QTimer(this);
+    m_reportTimer->setInterval(500);
+    connect(m_reportTimer, &QTimer::timeout,
+            this, &ImageExporterModel::updateThroughputReport);
+
     // Initialize format mappings
     m_formatExtensions[0] = ".png";
     m_formatExtensions[1] = ".jpg";
@@ -25,6 +40,7 @@ ImageExporterModel::ImageExporterModel()
     m_formatExtensions[4] = ".tiff";
     m_formatExtensions[5] = ".tif";
     m_formatExtensions[6] = ".webp";
+    m_formatExtensions[7] = ".vbf";
 
     // Create embedded widget
     m_widget = new QWidget();
@@ -59,6 +75,7 @@ ImageExporterModel::ImageExporterModel()
     m_formatCombo->addItem("TIFF", 4);
     m_formatCombo->addItem("TIFF", 5);
     m_formatCombo->addItem("WebP", 6);
+    m_formatCombo->addItem("VBF (fast lossless)", 7);
     m_formatCombo->setCurrentIndex(0);
     m_formatCombo->setMinimumWidth(150);
     formatLayout->addWidget(m_formatCombo);
@@ -73,11 +90,34 @@ ImageExporterModel::ImageExporterModel()
     qualityLayout->addWidget(m_qualitySpin);
     layout->addLayout(qualityLayout);
 
+    // Compression preset (PNG level/strategy, TIFF codec, JPEG optimize)
+    auto* presetLayout = new QHBoxLayout();
+    presetLayout->addWidget(new QLabel("Compression:"));
+    m_presetCombo = new QComboBox();
+    m_presetCombo->addItem("Fast", 0);
+    m_presetCombo->addItem("Balanced", 1);
+    m_presetCombo->addItem("Smallest", 2);
+    m_presetCombo->setToolTip("Fast: PNG level 1 + RLE, uncompressed TIFF\n"
+                              "Balanced: PNG level 3, LZW TIFF\n"
+                              "Smallest: PNG level 9, Deflate TIFF, optimized JPEG");
+    presetLayout->addWidget(m_presetCombo);
+    presetLayout->addWidget(new QLabel("Threads:"));
+    m_threadSpin = new QSpinBox();
+    m_threadSpin->setRange(1, 32);
+    m_threadSpin->setValue(m_threadCount);
+    presetLayout->addWidget(m_threadSpin);
+    layout->addLayout(presetLayout);
+
     // Auto-increment
     m_autoIncrementCheck = new QCheckBox("Auto-Increment Filename");
     m_autoIncrementCheck->setToolTip("Add frame number to filename (e.g., image_001.png)");
     layout->addWidget(m_autoIncrementCheck);
 
+    // Continuous dump
+    m_everyFrameCheck = new QCheckBox("Export Every Frame");
+    m_everyFrameCheck->setToolTip("Queue every incoming frame (numbered prefix_000000.ext)");
+    layout->addWidget(m_everyFrameCheck);
+
     // Export button
     m_exportBtn = new QPushButton("Export Image");
     m_exportBtn->setEnabled(false);
@@ -88,6 +128,12 @@ ImageExporterModel::ImageExporterModel()
     m_statusLabel->setStyleSheet("QLabel { padding: 5px; }");
     layout->addWidget(m_statusLabel);
 
+    // Per-format throughput
+    m_throughputLabel = new QLabel();
+    m_throughputLabel->setWordWrap(true);
+    m_throughputLabel->setStyleSheet("QLabel { padding: 5px; color: #888888; }");
+    layout->addWidget(m_throughputLabel);
+
     layout->setContentsMargins(5, 5, 5, 5);
 
     // Connect signals
@@ -101,6 +147,18 @@ ImageExporterModel::ImageExporterModel()
             this, &ImageExporterModel::onQualityChanged);
     connect(m_autoIncrementCheck, &QCheckBox::stateChanged,
             this, &ImageExporterModel::onAutoIncrementChanged);
+    connect(m_everyFrameCheck, &QCheckBox::stateChanged,
+            this, &ImageExporterModel::onExportEveryFrameChanged);
+    connect(m_presetCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &ImageExporterModel::onPresetChanged);
+    connect(m_threadSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &ImageExporterModel::onThreadCountChanged);
+}
+
+ImageExporterModel::~ImageExporterModel()
+{
+    // Finish queued encodes before the node goes away
+    stopPool();
 }
 
 /*******************************************************************************
@@ -144,6 +202,18 @@ void ImageExporterModel::setInData(std::shared_ptr<QtNodes::NodeData> data,
 
     // Enable export button if we have data
     m_exportBtn->setEnabled(m_inputImage != nullptr && !m_outputPath.isEmpty());
+
+    // Continuous dump: queue the frame (encoding happens on the pool)
+    if (m_exportEveryFrame && m_inputImage && !m_outputPath.isEmpty())
+    {
+        PerformanceTimer timer(this, caption());
+
+        cv::Mat image = m_inputImage->image();
+        if (!image.empty() && QDir().mkpath(m_outputPath))
+        {
+            exportImage(image);
+        }
+    }
 }
 
 /*******************************************************************************
@@ -205,16 +275,11 @@ void ImageExporterModel::onExportClicked()
         }
     }
 
-    // Export image
-    if (exportImage(image))
+    // Export image (queued; the status reports the file name it will get)
+    QString fileName = exportImage(image);
+    if (!fileName.isEmpty())
     {
-        m_statusLabel->setText(QString("Status: Exported to %1").arg(generateFileName()));
-
-        // Increment frame counter for next export
-        if (m_autoIncrement)
-        {
-            m_frameCount++;
-        }
+        m_statusLabel->setText(QString("Status: Exporting %1").arg(fileName));
     }
 }
 
@@ -241,57 +306,282 @@ void ImageExporterModel::onAutoIncrementChanged(int state)
     }
 }
 
+void ImageExporterModel::onExportEveryFrameChanged(int state)
+{
+    m_exportEveryFrame = (state == Qt::Checked);
+    m_frameCount = 0;
+
+    if (!m_exportEveryFrame)
+    {
+        // Flush everything queued so far
+        stopPool();
+        updateThroughputReport();
+    }
+}
+
+void ImageExporterModel::onPresetChanged(int index)
+{
+    Q_UNUSED(index);
+    m_preset = m_presetCombo->currentData().toInt();
+}
+
+void ImageExporterModel::onThreadCountChanged(int value)
+{
+    m_threadCount = value;
+
+    // Restart the pool with the new size (drains queued work first)
+    if (!m_workers.empty())
+    {
+        stopPool();
+        startPool();
+    }
+}
+
+void ImageExporterModel::updateThroughputReport()
+{
+    QStringList lines;
+    {
+        QMutexLocker locker(&m_statsMutex);
+        for (auto it = m_throughput.constBegin(); it != m_throughput.constEnd(); ++it)
+        {
+            const FormatThroughput& t = it.value();
+            if (t.frames == 0)
+            {
+                continue;
+            }
+
+            double wallSec = std::max<qint64>(1, t.lastEndMs - t.firstStartMs) / 1000.0;
+            double fps = t.frames / wallSec;
+            double mbps = t.bytes / (1024.0 * 1024.0) / wallSec;
+            double msPerFrame = t.encodeUs / 1000.0 / t.frames;
+
+            lines << QString("%1: %2 frames | %3 fps | %4 MB/s | %5 ms/frame")
+                         .arg(it.key().mid(1).toUpper())
+                         .arg(t.frames)
+                         .arg(fps, 0, 'f', 1)
+                         .arg(mbps, 0, 'f', 1)
+                         .arg(msPerFrame, 0, 'f', 1);
+
+            PerformanceMonitor::instance()->recordMetric(this, caption(), it.key().mid(1) + " fps", fps);
+            PerformanceMonitor::instance()->recordMetric(this, caption(), it.key().mid(1) + " MB/s", mbps);
+        }
+
+        if (m_failed.load() > 0)
+        {
+            lines << QString("%1 failed (last: %2)").arg(m_failed.load()).arg(m_lastError);
+        }
+    }
+
+    PerformanceMonitor::instance()->recordMetric(this, caption(), "queueDepth", m_queue.size());
+
+    if (m_pending.load() > 0)
+    {
+        lines.prepend(QString("Encoding: %1 pending on %2 threads")
+                          .arg(m_pending.load())
+                          .arg(static_cast<int>(m_workers.size())));
+    }
+    else if (!m_exportEveryFrame)
+    {
+        m_reportTimer->stop();
+    }
+
+    m_throughputLabel->setText(lines.join("\n"));
+}
+
 /*******************************************************************************
  * Image Export
  ******************************************************************************/
-bool ImageExporterModel::exportImage(const cv::Mat& image)
+QString ImageExporterModel::exportImage(const cv::Mat& image)
 {
-    QString fileName = generateFileName();
-    QString filePath = QDir(m_outputPath).absoluteFilePath(fileName);
+    if (m_workers.empty())
+    {
+        startPool();
+    }
+
+    const QString extension = m_formatExtensions.value(m_formatIndex, ".png");
+    if (m_exportEveryFrame && m_frameCount == 0)
+    {
+        // A new dump never overwrites an earlier one (or another node's)
+        QString prefix = m_prefixEdit->text().isEmpty() ? "image" : m_prefixEdit->text();
+        m_runPrefix = ExportNaming::uniqueStem(m_outputPath, prefix, "_000000" + extension);
+    }
 
-    std::vector<int> compression_params;
+    const QString fileName = generateFileName();
 
-    // Try to save with appropriate parameters
-    try
+    ExportJob job;
+    job.image = image;   // Shared buffer; upstream nodes emit a new Mat per frame
+    job.filePath = QDir(m_outputPath).absoluteFilePath(fileName);
+    job.extension = extension;
+    job.params = encodeParams();
+    if (m_formatIndex == 7)
     {
-        switch (m_formatIndex)
-        {
-            case 0: // PNG
-                // PNG doesn't use quality parameter
-                cv::imwrite(filePath.toStdString(), image);
-                break;
+        // Fast skips the delta filter; it rarely pays off on noisy content
+        job.frameFilters = (m_preset == 0)
+                               ? FrameCodec::ShuffleFilter
+                               : FrameCodec::DeltaFilter | FrameCodec::ShuffleFilter;
+    }
 
-            case 1: // JPEG
-            case 2: // JPEG
-                compression_params.push_back(cv::IMWRITE_JPEG_QUALITY);
-                compression_params.push_back(m_quality);
-                cv::imwrite(filePath.toStdString(), image, compression_params);
-                break;
+    // Numbering is fixed here, before any worker picks the job up
+    if (m_autoIncrement || m_exportEveryFrame)
+    {
+        m_frameCount++;
+    }
 
-            case 3: // BMP
-                cv::imwrite(filePath.toStdString(), image);
-                break;
+    m_pending++;
+    if (!m_queue.push(std::move(job)))
+    {
+        m_pending--;
+        m_statusLabel->setText("Status: Export queue closed");
+        return QString();
+    }
 
-            case 4: // TIFF
-            case 5: // TIFF
-                compression_params.push_back(cv::IMWRITE_TIFF_COMPRESSION);
-                compression_params.push_back(1); // LZW compression
-                cv::imwrite(filePath.toStdString(), image, compression_params);
-                break;
+    if (!m_reportTimer->isActive())
+    {
+        m_reportTimer->start();
+    }
+    return fileName;
+}
 
-            case 6: // WebP
-                compression_params.push_back(cv::IMWRITE_WEBP_QUALITY);
-                compression_params.push_back(m_quality);
-                cv::imwrite(filePath.toStdString(), image, compression_params);
-                break;
+std::vector<int> ImageExporterModel::encodeParams() const
+{
+    std::vector<int> params;
+
+    switch (m_formatIndex)
+    {
+        case 0: // PNG
+        {
+            static const int levels[] = {1, 3, 9};
+            params = {cv::IMWRITE_PNG_COMPRESSION, levels[m_preset]};
+            if (m_preset == 0)
+            {
+                // Run-length only: much faster on synthetic and flat content
+                params.insert(params.end(), {cv::IMWRITE_PNG_STRATEGY, cv::IMWRITE_PNG_STRATEGY_RLE});
+            }
+            break;
+        }
+
+        case 1: // JPEG
+        case 2: // JPEG
+            params = {cv::IMWRITE_JPEG_QUALITY, m_quality,
+                      cv::IMWRITE_JPEG_OPTIMIZE, m_preset == 2 ? 1 : 0};
+            break;
+
+        case 3: // BMP
+            break;
+
+        case 4: // TIFF
+        case 5: // TIFF
+        {
+            // 1 = none, 5 = LZW, 8 = Adobe Deflate
+            static const int codecs[] = {1, 5, 8};
+            params = {cv::IMWRITE_TIFF_COMPRESSION, codecs[m_preset]};
+            break;
         }
 
-        return true;
+        case 6: // WebP
+            params = {cv::IMWRITE_WEBP_QUALITY, m_quality};
+            break;
+    }
+
+    return params;
+}
+
+/*******************************************************************************
+ * Encode Pool
+ ******************************************************************************/
+void ImageExporterModel::startPool()
+{
+    m_queue.reopen();
+    for (int i = 0; i < m_threadCount; ++i)
+    {
+        m_workers.emplace_back(&ImageExporterModel::workerLoop, this);
+    }
+}
+
+void ImageExporterModel::stopPool()
+{
+    // Workers drain the queue before pop() reports closed
+    m_queue.close();
+    for (std::thread& worker : m_workers)
+    {
+        worker.join();
     }
-    catch (const cv::Exception& e)
+    m_workers.clear();
+}
+
+void ImageExporterModel::workerLoop()
+{
+    ExportJob job;
+    while (m_queue.pop(job))
     {
-        m_statusLabel->setText(QString("Status: Export failed - %1").arg(e.what()));
-        return false;
+        qint64 startMs = m_clock.elapsed();
+        QElapsedTimer timer;
+        timer.start();
+
+        std::vector<uchar> buffer;
+        QByteArray frame;
+        QString error;
+        try
+        {
+            if (job.frameFilters >= 0)
+            {
+                // Any depth and channel count, no conversion needed
+                frame = FrameCodec::encode(job.image, job.frameFilters);
+                if (frame.isEmpty())
+                {
+                    error = "Encoder rejected image";
+                }
+            }
+            else if (!cv::imencode(job.extension.toStdString(), job.image, buffer, job.params))
+            {
+                error = "Encoder rejected image";
+            }
+        }
+        catch (const cv::Exception& e)
+        {
+            error = QString::fromStdString(e.what());
+        }
+
+        const char* bytes = frame.isEmpty() ? reinterpret_cast<const char*>(buffer.data())
+                                            : frame.constData();
+        const qint64 byteCount = frame.isEmpty() ? static_cast<qint64>(buffer.size())
+                                                 : static_cast<qint64>(frame.size());
+
+        if (error.isEmpty())
+        {
+            QFile file(job.filePath);
+            if (!file.open(QIODevice::WriteOnly) ||
+                file.write(bytes, byteCount) != byteCount)
+            {
+                error = file.errorString();
+            }
+        }
+
+        qint64 elapsedUs = timer.nsecsElapsed() / 1000;
+
+        {
+            QMutexLocker locker(&m_statsMutex);
+            if (error.isEmpty())
+            {
+                FormatThroughput& t = m_throughput[job.extension];
+                if (t.firstStartMs < 0)
+                {
+                    t.firstStartMs = startMs;
+                }
+                t.frames++;
+                t.bytes += byteCount;
+                t.encodeUs += elapsedUs;
+                t.lastEndMs = m_clock.elapsed();
+            }
+            else
+            {
+                m_failed++;
+                m_lastError = QFileInfo(job.filePath).fileName() + ": " + error;
+            }
+        }
+
+        job = ExportJob();
+        m_pending--;
     }
 }
 
@@ -300,7 +590,16 @@ QString ImageExporterModel::generateFileName()
     QString prefix = m_prefixEdit->text().isEmpty() ? "image" : m_prefixEdit->text();
     QString extension = m_formatExtensions.value(m_formatIndex, ".png");
 
-    if (m_autoIncrement)
+    if (m_exportEveryFrame)
+    {
+        // Format: prefix_000000.ext (fixed width keeps long dumps sortable);
+        // prefix_2_000000.ext etc. when an earlier dump used the prefix
+        return QString("%1_%2%3")
+            .arg(m_runPrefix.isEmpty() ? prefix : m_runPrefix)
+            .arg(m_frameCount, 6, 10, QChar('0'))
+            .arg(extension);
+    }
+    else if (m_autoIncrement)
     {
         // Format: prefix_001.ext, prefix_002.ext, etc.
         return QString("%1_%2%3")
@@ -327,6 +626,10 @@ QJsonObject ImageExporterModel::save() const
     modelJson["quality"] = m_quality;
     modelJson["autoIncrement"] = m_autoIncrement;
     modelJson["frameCount"] = m_frameCount;
+    modelJson["exportEveryFrame"] = m_exportEveryFrame;
+    modelJson["runPrefix"] = m_runPrefix;
+    modelJson["preset"] = m_preset;
+    modelJson["threadCount"] = m_threadCount;
     return modelJson;
 }
 
@@ -377,11 +680,48 @@ void ImageExporterModel::load(QJsonObject const& model)
         m_autoIncrementCheck->setChecked(m_autoIncrement);
     }
 
+    QJsonValue presetJson = model["preset"];
+    if (!presetJson.isUndefined())
+    {
+        m_preset = qBound(0, presetJson.toInt(), 2);
+        for (int i = 0; i < m_presetCombo->count(); ++i)
+        {
+            if (m_presetCombo->itemData(i).toInt() == m_preset)
+            {
+                m_presetCombo->blockSignals(true);
+                m_presetCombo->setCurrentIndex(i);
+                m_presetCombo->blockSignals(false);
+                break;
+            }
+        }
+    }
+
+    QJsonValue threadCountJson = model["threadCount"];
+    if (!threadCountJson.isUndefined())
+    {
+        m_threadCount = threadCountJson.toInt();
+        m_threadSpin->setValue(m_threadCount);
+    }
+
+    QJsonValue everyFrameJson = model["exportEveryFrame"];
+    if (!everyFrameJson.isUndefined())
+    {
+        m_everyFrameCheck->setChecked(everyFrameJson.toBool());
+    }
+
+    // After the checkboxes, which reset the counter when toggled
     QJsonValue frameCountJson = model["frameCount"];
     if (!frameCountJson.isUndefined())
     {
         m_frameCount = frameCountJson.toInt();
     }
+
+    // A dump resumed after reloading keeps writing under its own prefix
+    QJsonValue runPrefixJson = model["runPrefix"];
+    if (!runPrefixJson.isUndefined())
+    {
+        m_runPrefix = runPrefixJson.toString();
+    }
 }
 
 } // namespace VisionBox
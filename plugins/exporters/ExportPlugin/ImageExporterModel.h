@@ -7,6 +7,7 @@
 #define VISIONBOX_IMAGEEXPORTERMODEL_H
 
 #include "core/PluginInterface.h"
+#include "core/BoundedQueue.h"
 #include <QtNodes/NodeDelegateModel>
 #include <QWidget>
 #include <QVBoxLayout>
@@ -18,7 +19,13 @@
 #include <QComboBox>
 #include <QCheckBox>
 #include <QSpinBox>
+#include <QTimer>
+#include <QMutex>
+#include <QElapsedTimer>
 #include <opencv2/opencv.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 namespace VisionBox {
 
@@ -26,6 +33,10 @@ class ImageData;
 
 /*******************************************************************************
  * ImageExporterModel - Save images to disk
+ *
+ * Encoding runs on a small thread pool fed by a bounded queue. File names
+ * (and frame numbers) are assigned when a frame is queued, so numbering is
+ * deterministic no matter which worker finishes first.
  ******************************************************************************/
 class ImageExporterModel : public QtNodes::NodeDelegateModel
 {
@@ -33,7 +44,7 @@ class ImageExporterModel : public QtNodes::NodeDelegateModel
 
 public:
     ImageExporterModel();
-    ~ImageExporterModel() override = default;
+    ~ImageExporterModel() override;
 
     QString caption() const override { return "Image Exporter"; }
     QString name() const override { return "ImageExporterModel"; }
@@ -57,10 +68,38 @@ private slots:
     void onFormatChanged();
     void onQualityChanged(int value);
     void onAutoIncrementChanged(int state);
+    void onExportEveryFrameChanged(int state);
+    void onPresetChanged(int index);
+    void onThreadCountChanged(int value);
+    void updateThroughputReport();
 
 private:
-    bool exportImage(const cv::Mat& image);
+    // Encode job, fully resolved on the GUI thread
+    struct ExportJob
+    {
+        cv::Mat image;
+        QString filePath;
+        QString extension;
+        std::vector<int> params;
+        int frameFilters = -1;   // FrameCodec filters for .vbf, -1 otherwise
+    };
+
+    // Accumulated throughput for one format
+    struct FormatThroughput
+    {
+        qint64 frames = 0;
+        qint64 bytes = 0;
+        qint64 encodeUs = 0;     // Sum of encode + write time across workers
+        qint64 firstStartMs = -1;
+        qint64 lastEndMs = 0;
+    };
+
+    QString exportImage(const cv::Mat& image);   // Queued file name; empty on failure
     QString generateFileName();
+    std::vector<int> encodeParams() const;
+    void startPool();
+    void stopPool();
+    void workerLoop();
 
 private:
     // Export parameters
@@ -70,6 +109,21 @@ private:
     int m_quality = 95;              // JPEG quality (1-100)
     bool m_autoIncrement = false;     // Auto-increment filename
     int m_frameCount = 0;            // Frame counter for auto-increment
+    bool m_exportEveryFrame = false;  // Queue every incoming frame
+    QString m_runPrefix;             // Unique prefix of the current every-frame dump
+    int m_preset = 0;                // 0=Fast, 1=Balanced, 2=Smallest
+    int m_threadCount = 4;           // Encoder threads
+
+    // Encode pool
+    BoundedQueue<ExportJob> m_queue;
+    std::vector<std::thread> m_workers;
+    std::atomic<int> m_pending{0};   // Queued or in-flight jobs
+    std::atomic<int> m_failed{0};
+    mutable QMutex m_statsMutex;
+    QMap<QString, FormatThroughput> m_throughput;  // Guarded by m_statsMutex
+    QString m_lastError;                           // Guarded by m_statsMutex
+    QElapsedTimer m_clock;
+    QTimer* m_reportTimer = nullptr;
 
     // Format mappings
     QMap<int, QString> m_formatExtensions;
@@ -85,6 +139,10 @@ private:
     QComboBox* m_formatCombo = nullptr;
     QSpinBox* m_qualitySpin = nullptr;
     QCheckBox* m_autoIncrementCheck = nullptr;
+    QCheckBox* m_everyFrameCheck = nullptr;
+    QComboBox* m_presetCombo = nullptr;
+    QSpinBox* m_threadSpin = nullptr;
+    QLabel* m_throughputLabel = nullptr;
     QPushButton* m_exportBtn = nullptr;
     QLabel* m_statusLabel = nullptr;
 };
@@ -0,0 +1,232 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Streaming Append-Only File Writer Implementation
+ ******************************************************************************/
+
+#include "StreamingFileWriter.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QMutexLocker>
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace VisionBox {
+
+/*******************************************************************************
+ * Lifecycle
+ ******************************************************************************/
+StreamingFileWriter::~StreamingFileWriter()
+{
+    stop();
+}
+
+bool StreamingFileWriter::start(const Options& options)
+{
+    stop();
+
+    m_options = options;
+    m_recordsWritten = 0;
+    m_bytesWritten = 0;
+    m_failed = false;
+    {
+        QMutexLocker locker(&m_statusMutex);
+        m_lastError.clear();
+    }
+
+    QDir().mkpath(QFileInfo(m_options.basePath).absolutePath());
+
+    // Continue an existing rotation set instead of growing its first file
+    int index = 0;
+    if (!openFile(index))
+    {
+        return false;
+    }
+    while (m_options.rotateBytes > 0 && m_fileBytes >= m_options.rotateBytes)
+    {
+        if (!openFile(++index))
+        {
+            return false;
+        }
+    }
+
+    m_queue.reopen();
+    m_queue.setCapacity(m_options.queueCapacity);
+    m_queue.setPolicy(QueueOverflowPolicy::Block);
+    m_thread = std::thread(&StreamingFileWriter::writerLoop, this);
+    return true;
+}
+
+bool StreamingFileWriter::append(QByteArray record)
+{
+    if (m_failed || !isRunning())
+    {
+        return false;
+    }
+    return m_queue.push(std::move(record));
+}
+
+void StreamingFileWriter::stop()
+{
+    m_queue.close();
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+    if (m_file)
+    {
+        syncFile();
+        m_file->close();
+        m_file.reset();
+    }
+}
+
+/*******************************************************************************
+ * Status
+ ******************************************************************************/
+QString StreamingFileWriter::currentFilePath() const
+{
+    QMutexLocker locker(&m_statusMutex);
+    return m_currentPath;
+}
+
+QString StreamingFileWriter::lastError() const
+{
+    QMutexLocker locker(&m_statusMutex);
+    return m_lastError;
+}
+
+void StreamingFileWriter::setError(const QString& error)
+{
+    QMutexLocker locker(&m_statusMutex);
+    m_lastError = error;
+    m_failed = true;
+}
+
+/*******************************************************************************
+ * File Handling
+ ******************************************************************************/
+QString StreamingFileWriter::filePathFor(int index) const
+{
+    bool rotating = m_options.rotateBytes > 0 || m_options.rotateRecords > 0;
+    if (!rotating)
+    {
+        return m_options.basePath + m_options.extension;
+    }
+    return QString("%1_%2%3")
+        .arg(m_options.basePath)
+        .arg(index, 3, 10, QChar('0'))
+        .arg(m_options.extension);
+}
+
+bool StreamingFileWriter::openFile(int index)
+{
+    if (m_file)
+    {
+        syncFile();
+        m_file->close();
+    }
+
+    const QString path = filePathFor(index);
+    m_file = std::make_unique<QFile>(path);
+    if (!m_file->open(QIODevice::WriteOnly | QIODevice::Append))
+    {
+        setError(QString("Cannot open %1: %2").arg(path, m_file->errorString()));
+        m_file.reset();
+        return false;
+    }
+
+    m_fileBytes = m_file->size();
+    m_fileRecords = 0;
+    m_fileIndex = index;
+    {
+        QMutexLocker locker(&m_statusMutex);
+        m_currentPath = path;
+    }
+
+    if (m_fileBytes == 0 && !m_options.header.isEmpty())
+    {
+        if (m_file->write(m_options.header) != m_options.header.size())
+        {
+            setError(QString("Write failed on %1: %2").arg(path, m_file->errorString()));
+            return false;
+        }
+        m_fileBytes += m_options.header.size();
+    }
+
+    return true;
+}
+
+void StreamingFileWriter::syncFile()
+{
+    if (!m_file || !m_file->isOpen())
+    {
+        return;
+    }
+
+    m_file->flush();
+#ifdef Q_OS_WIN
+    _commit(m_file->handle());
+#else
+    ::fsync(m_file->handle());
+#endif
+}
+
+/*******************************************************************************
+ * Writer Thread
+ ******************************************************************************/
+void StreamingFileWriter::writerLoop()
+{
+    QElapsedTimer syncTimer;
+    syncTimer.start();
+
+    QByteArray record;
+    while (m_queue.pop(record))
+    {
+        bool rotate = m_fileRecords > 0 &&
+                      ((m_options.rotateBytes > 0 && m_fileBytes >= m_options.rotateBytes) ||
+                       (m_options.rotateRecords > 0 && m_fileRecords >= m_options.rotateRecords));
+        if (rotate && !openFile(m_fileIndex + 1))
+        {
+            break;
+        }
+
+        if (m_file->write(record) != record.size())
+        {
+            setError(QString("Write failed: %1").arg(m_file->errorString()));
+            break;
+        }
+
+        m_fileBytes += record.size();
+        m_fileRecords++;
+        m_bytesWritten += record.size();
+        m_recordsWritten++;
+
+        // Hand buffered rows to the OS once the producer has caught up
+        if (m_queue.size() == 0)
+        {
+            m_file->flush();
+        }
+
+        if (m_options.fsyncIntervalMs > 0 && syncTimer.elapsed() >= m_options.fsyncIntervalMs)
+        {
+            syncFile();
+            syncTimer.restart();
+        }
+    }
+
+    if (m_failed)
+    {
+        // Unblock the producer; remaining records are lost
+        m_queue.close();
+        m_queue.clear();
+    }
+}
+
+} // namespace VisionBox
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Streaming Append-Only File Writer
+ ******************************************************************************/
+
+#ifndef VISIONBOX_STREAMINGFILEWRITER_H
+#define VISIONBOX_STREAMINGFILEWRITER_H
+
+#include "core/BoundedQueue.h"
+#include <QString>
+#include <QByteArray>
+#include <QMutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+class QFile;
+
+namespace VisionBox {
+
+/*******************************************************************************
+ * StreamingFileWriter - Appends records to a log file on a background thread
+ *
+ * Records (already formatted, newline-terminated) are queued by the caller
+ * and written through a buffered QFile that stays open for the whole run.
+ * The buffer is flushed whenever the queue drains. Optional periodic fsync
+ * bounds data loss on power failure; optional rotation starts a new file
+ * (<base>_000<ext>, <base>_001<ext>, ...) after a size or record limit.
+ * A header (e.g. a CSV column line) is written at the top of each new file.
+ ******************************************************************************/
+class StreamingFileWriter
+{
+public:
+    struct Options
+    {
+        QString basePath;           // Directory + file prefix, without extension
+        QString extension;          // Including the dot, e.g. ".jsonl"
+        QByteArray header;          // Written to every new (empty) file
+        qint64 rotateBytes = 0;     // Start a new file after this size (0 = off)
+        qint64 rotateRecords = 0;   // Start a new file after this many records (0 = off)
+        int fsyncIntervalMs = 0;    // Force data to disk this often (0 = never)
+        int queueCapacity = 1024;   // Pending records before append() blocks
+    };
+
+    StreamingFileWriter() = default;
+    ~StreamingFileWriter();
+
+    // Open the first file and start the writer thread
+    bool start(const Options& options);
+
+    // Queue one record; returns false if the writer is stopped or failed
+    bool append(QByteArray record);
+
+    // Drain the queue, sync and close the file, join the thread
+    void stop();
+
+    bool isRunning() const { return m_thread.joinable(); }
+
+    qint64 recordsWritten() const { return m_recordsWritten.load(); }
+    qint64 bytesWritten() const { return m_bytesWritten.load(); }
+    int pendingRecords() const { return m_queue.size(); }
+    int fileIndex() const { return m_fileIndex.load(); }
+    QString currentFilePath() const;
+    QString lastError() const;
+
+private:
+    void writerLoop();
+    bool openFile(int index);
+    void syncFile();
+    void setError(const QString& error);
+    QString filePathFor(int index) const;
+
+private:
+    Options m_options;
+    BoundedQueue<QByteArray> m_queue;
+    std::thread m_thread;
+
+    // Owned by the writer thread while running
+    std::unique_ptr<QFile> m_file;
+    qint64 m_fileBytes = 0;
+    qint64 m_fileRecords = 0;
+
+    std::atomic<qint64> m_recordsWritten{0};
+    std::atomic<qint64> m_bytesWritten{0};
+    std::atomic<int> m_fileIndex{0};
+    std::atomic<bool> m_failed{false};
+
+    mutable QMutex m_statusMutex;
+    QString m_currentPath;
+    QString m_lastError;
+
+    // Prevent copy
+    StreamingFileWriter(const StreamingFileWriter&) = delete;
+    StreamingFileWriter& operator=(const StreamingFileWriter&) = delete;
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_STREAMINGFILEWRITER_H
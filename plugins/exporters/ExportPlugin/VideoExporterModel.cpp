@@ -5,10 +5,13 @@
 
 #include "VideoExporterModel.h"
 #include "core/VisionDataTypes.h"
+#include "core/PerformanceMonitor.h"
 #include <opencv2/opencv.hpp>
 #include <opencv2/videoio.hpp>
 #include <QFileInfo>
 #include <QDir>
+#include <QElapsedTimer>
+#include <QMutexLocker>
 
 namespace VisionBox {
 
@@ -17,8 +20,13 @@ namespace VisionBox {
  ******************************************************************************/
 VideoExporterModel::VideoExporterModel()
     : m_frameSize(0)
-    , m_frameCount(0)
 {
+    // Periodic status refresh while recording (the writer thread never touches the UI)
+    m_statusTimer = new QTimer(this);
+    m_statusTimer->setInterval(250);
+    connect(m_statusTimer, &QTimer::timeout,
+            this, &VideoExporterModel::updateRecordingStatus);
+
     // Create embedded widget
     m_widget = new QWidget();
     auto* layout = new QVBoxLayout(m_widget);
@@ -67,6 +75,23 @@ VideoExporterModel::VideoExporterModel()
     qualityLayout->addWidget(m_qualitySpin);
     layout->addLayout(qualityLayout);
 
+    // Writer queue
+    auto* queueLayout = new QHBoxLayout();
+    queueLayout->addWidget(new QLabel("When Full:"));
+    m_policyCombo = new QComboBox();
+    m_policyCombo->addItem("Block", static_cast<int>(QueueOverflowPolicy::Block));
+    m_policyCombo->addItem("Drop Oldest", static_cast<int>(QueueOverflowPolicy::DropOldest));
+    m_policyCombo->addItem("Drop Newest", static_cast<int>(QueueOverflowPolicy::DropNewest));
+    m_policyCombo->setToolTip("What to do when the encoder falls behind");
+    queueLayout->addWidget(m_policyCombo);
+    queueLayout->addWidget(new QLabel("Queue:"));
+    m_queueSizeSpin = new QSpinBox();
+    m_queueSizeSpin->setRange(1, 256);
+    m_queueSizeSpin->setValue(m_queueSize);
+    m_queueSizeSpin->setSuffix(" frames");
+    queueLayout->addWidget(m_queueSizeSpin);
+    layout->addLayout(queueLayout);
+
     // Record button
     m_recordBtn = new QPushButton("Start Recording");
     m_recordBtn->setEnabled(false);
@@ -90,14 +115,16 @@ VideoExporterModel::VideoExporterModel()
             this, &VideoExporterModel::onFpsChanged);
     connect(m_qualitySpin, QOverload<int>::of(&QSpinBox::valueChanged),
             this, &VideoExporterModel::onQualityChanged);
+    connect(m_policyCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &VideoExporterModel::onQueuePolicyChanged);
+    connect(m_queueSizeSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &VideoExporterModel::onQueueSizeChanged);
 }
 
 VideoExporterModel::~VideoExporterModel()
 {
-    if (m_writer.isOpened())
-    {
-        m_writer.release();
-    }
+    // Flushes queued frames and joins the writer thread
+    finalizeWriter();
 }
 
 /*******************************************************************************
@@ -143,9 +170,11 @@ void VideoExporterModel::setInData(std::shared_ptr<QtNodes::NodeData> data,
     bool canRecord = m_inputImage != nullptr && !m_outputPath.isEmpty();
     m_recordBtn->setEnabled(canRecord);
 
-    // Auto-write frame if recording
+    // Auto-write frame if recording (only queues the frame)
     if (m_state == Recording && m_inputImage)
     {
+        PerformanceTimer timer(this, caption());
+
         cv::Mat image = m_inputImage->image();
         if (!image.empty())
         {
@@ -191,24 +220,61 @@ void VideoExporterModel::onToggleRecording()
     {
         // Start recording
         initializeWriter();
-        if (m_writer.isOpened())
+        if (m_writerThread.joinable())
         {
             m_state = Recording;
             m_recordBtn->setText("Stop Recording");
             m_statusLabel->setText("Status: Recording...");
+            m_statusTimer->start();
         }
     }
     else if (m_state == Recording)
     {
-        // Stop recording
-        finalizeWriter();
-        m_state = Idle;
-        m_recordBtn->setText("Start Recording");
-        m_statusLabel->setText(QString("Status: Saved %1 frames").arg(m_frameCount));
-        m_frameCount = 0;
+        // Stop recording (waits for queued frames to be encoded)
+        stopRecording(QString());
     }
 }
 
+void VideoExporterModel::stopRecording(const QString& status)
+{
+    m_statusTimer->stop();
+    qint64 dropped = m_queue.droppedCount();
+    finalizeWriter();
+    m_state = Idle;
+    m_recordBtn->setText("Start Recording");
+
+    QString text = status;
+    if (text.isEmpty())
+    {
+        text = QString("Status: Saved %1 frames").arg(m_encodedFrames.load());
+        if (dropped > 0)
+        {
+            text += QString(" (%1 dropped)").arg(dropped);
+        }
+    }
+    m_statusLabel->setText(text);
+}
+
+void VideoExporterModel::updateRecordingStatus()
+{
+    if (m_writeFailed.load())
+    {
+        QString error;
+        {
+            QMutexLocker locker(&m_errorMutex);
+            error = m_writeError;
+        }
+        stopRecording(QString("Status: Write error - %1").arg(error));
+        return;
+    }
+
+    m_statusLabel->setText(QString("Status: Recording... (%1 frames, queue %2/%3, dropped %4)")
+                               .arg(m_encodedFrames.load())
+                               .arg(m_queue.size())
+                               .arg(m_queue.capacity())
+                               .arg(m_queue.droppedCount()));
+}
+
 void VideoExporterModel::onFormatChanged()
 {
     m_formatIndex = m_formatCombo->currentData().toInt();
@@ -224,6 +290,19 @@ void VideoExporterModel::onQualityChanged(int value)
     m_quality = value;
 }
 
+void VideoExporterModel::onQueuePolicyChanged(int index)
+{
+    Q_UNUSED(index);
+    m_queuePolicy = m_policyCombo->currentData().toInt();
+    m_queue.setPolicy(static_cast<QueueOverflowPolicy>(m_queuePolicy));
+}
+
+void VideoExporterModel::onQueueSizeChanged(int value)
+{
+    m_queueSize = value;
+    m_queue.setCapacity(m_queueSize);
+}
+
 /*******************************************************************************
  * Video Recording
  ******************************************************************************/
@@ -271,6 +350,14 @@ void VideoExporterModel::initializeWriter()
             return;
         }
 
+        // Start the writer thread on a fresh queue
+        m_queue.reopen();
+        m_queue.setCapacity(m_queueSize);
+        m_queue.setPolicy(static_cast<QueueOverflowPolicy>(m_queuePolicy));
+        m_encodedFrames = 0;
+        m_writeFailed = false;
+        m_writerThread = std::thread(&VideoExporterModel::writerLoop, this);
+
         // Write first frame
         writeFrame(image);
     }
@@ -284,6 +371,13 @@ void VideoExporterModel::initializeWriter()
 
 void VideoExporterModel::finalizeWriter()
 {
+    // Close the queue; the writer drains what is left, then exits
+    m_queue.close();
+    if (m_writerThread.joinable())
+    {
+        m_writerThread.join();
+    }
+
     if (m_writer.isOpened())
     {
         m_writer.release();
@@ -292,23 +386,49 @@ void VideoExporterModel::finalizeWriter()
 
 void VideoExporterModel::writeFrame(const cv::Mat& frame)
 {
-    if (!m_writer.isOpened() || frame.empty())
+    if (!m_writerThread.joinable() || frame.empty())
     {
         return;
     }
 
-    try
-    {
-        m_writer.write(frame);
-        m_frameCount++;
-        m_statusLabel->setText(QString("Status: Recording... (%1 frames)").arg(m_frameCount));
-    }
-    catch (const cv::Exception& e)
+    // Frames are shared, not copied: upstream nodes emit new buffers per frame
+    m_queue.push(frame);
+
+    PerformanceMonitor::instance()->recordMetric(this, caption(), "queueDepth", m_queue.size());
+    PerformanceMonitor::instance()->recordMetric(this, caption(), "droppedFrames",
+                                                 static_cast<double>(m_queue.droppedCount()));
+}
+
+void VideoExporterModel::writerLoop()
+{
+    cv::Mat frame;
+    while (m_queue.pop(frame))
     {
-        m_statusLabel->setText(QString("Status: Write error - %1").arg(e.what()));
-        finalizeWriter();
-        m_state = Idle;
-        m_recordBtn->setText("Start Recording");
+        QElapsedTimer encodeTimer;
+        encodeTimer.start();
+
+        try
+        {
+            m_writer.write(frame);
+        }
+        catch (const cv::Exception& e)
+        {
+            {
+                QMutexLocker locker(&m_errorMutex);
+                m_writeError = QString::fromStdString(e.what());
+            }
+            m_writeFailed = true;
+
+            // Unblock producers; remaining frames are discarded
+            m_queue.close();
+            m_queue.clear();
+            return;
+        }
+
+        m_encodedFrames++;
+        PerformanceMonitor::instance()->recordMetric(this, caption(), "encodeMs",
+                                                     encodeTimer.nsecsElapsed() / 1.0e6);
+        PerformanceMonitor::instance()->recordMetric(this, caption(), "queueDepth", m_queue.size());
     }
 }
 
@@ -322,6 +442,8 @@ QJsonObject VideoExporterModel::save() const
     modelJson["formatIndex"] = m_formatIndex;
     modelJson["fps"] = m_fps;
     modelJson["quality"] = m_quality;
+    modelJson["queuePolicy"] = m_queuePolicy;
+    modelJson["queueSize"] = m_queueSize;
     return modelJson;
 }
 
@@ -363,6 +485,29 @@ void VideoExporterModel::load(QJsonObject const& model)
         m_quality = qualityJson.toInt();
         m_qualitySpin->setValue(m_quality);
     }
+
+    QJsonValue policyJson = model["queuePolicy"];
+    if (!policyJson.isUndefined())
+    {
+        m_queuePolicy = policyJson.toInt();
+        for (int i = 0; i < m_policyCombo->count(); ++i)
+        {
+            if (m_policyCombo->itemData(i).toInt() == m_queuePolicy)
+            {
+                m_policyCombo->blockSignals(true);
+                m_policyCombo->setCurrentIndex(i);
+                m_policyCombo->blockSignals(false);
+                break;
+            }
+        }
+    }
+
+    QJsonValue queueSizeJson = model["queueSize"];
+    if (!queueSizeJson.isUndefined())
+    {
+        m_queueSize = queueSizeJson.toInt();
+        m_queueSizeSpin->setValue(m_queueSize);
+    }
 }
 
 } // namespace VisionBox
@@ -7,6 +7,7 @@
 #define VISIONBOX_VIDEOEXPORTERMODEL_H
 
 #include "core/PluginInterface.h"
+#include "core/BoundedQueue.h"
 #include <QtNodes/NodeDelegateModel>
 #include <QWidget>
 #include <QVBoxLayout>
@@ -19,8 +20,12 @@
 #include <QSpinBox>
 #include <QDoubleSpinBox>
 #include <QCheckBox>
+#include <QTimer>
+#include <QMutex>
 #include <opencv2/opencv.hpp>
 #include <opencv2/videoio.hpp>
+#include <atomic>
+#include <thread>
 
 namespace VisionBox {
 
@@ -28,6 +33,11 @@ class ImageData;
 
 /*******************************************************************************
  * VideoExporterModel - Save videos to disk
+ *
+ * Frames are queued and encoded on a dedicated writer thread, so encoder
+ * stalls do not block the data-flow path. When the queue is full the
+ * configured policy either blocks the producer or drops a frame. Stopping
+ * the recording drains the queue before the file is finalized.
  ******************************************************************************/
 class VideoExporterModel : public QtNodes::NodeDelegateModel
 {
@@ -59,11 +69,16 @@ private slots:
     void onFormatChanged();
     void onFpsChanged(double value);
     void onQualityChanged(int value);
+    void onQueuePolicyChanged(int index);
+    void onQueueSizeChanged(int value);
+    void updateRecordingStatus();
 
 private:
     void initializeWriter();
     void finalizeWriter();
     void writeFrame(const cv::Mat& frame);
+    void writerLoop();
+    void stopRecording(const QString& status);
 
 private:
     enum State
@@ -82,8 +97,18 @@ private:
 
     // Recording state
     State m_state = Idle;
-    int m_frameCount = 0;
-    cv::VideoWriter m_writer;
+    cv::VideoWriter m_writer;        // Owned by the writer thread while recording
+
+    // Asynchronous writer
+    BoundedQueue<cv::Mat> m_queue;
+    std::thread m_writerThread;
+    std::atomic<int> m_encodedFrames{0};
+    std::atomic<bool> m_writeFailed{false};
+    QMutex m_errorMutex;
+    QString m_writeError;            // Guarded by m_errorMutex
+    int m_queuePolicy = 0;           // QueueOverflowPolicy
+    int m_queueSize = 16;            // Queue capacity (frames)
+    QTimer* m_statusTimer = nullptr;
 
     // Data
     std::shared_ptr<ImageData> m_inputImage;
@@ -95,6 +120,8 @@ private:
     QComboBox* m_formatCombo = nullptr;
     QDoubleSpinBox* m_fpsSpin = nullptr;
     QSpinBox* m_qualitySpin = nullptr;
+    QComboBox* m_policyCombo = nullptr;
+    QSpinBox* m_queueSizeSpin = nullptr;
     QPushButton* m_recordBtn = nullptr;
     QLabel* m_statusLabel = nullptr;
 };
@@ -5,10 +5,12 @@
 
 #include "DNNInferenceModel.h"
 #include "core/VisionDataTypes.h"
+#include "core/PerformanceMonitor.h"
 #include <opencv2/opencv.hpp>
 #include <opencv2/dnn.hpp>
 #include <fstream>
 #include <sstream>
+#include <algorithm>
 
 namespace VisionBox {
 
@@ -19,9 +21,6 @@ DNNInferenceModel::DNNInferenceModel()
     : m_outputImage(nullptr)
     , m_net(nullptr)
 {
-    // Initialize empty network
-    // m_net = cv::dnn::readNetFromONNX("");
-
     // Create embedded widget
     m_widget = new QWidget();
     auto* layout = new QVBoxLayout(m_widget);
@@ -117,11 +116,66 @@ DNNInferenceModel::DNNInferenceModel()
     m_swapRBCheck->setChecked(true);
     layout->addWidget(m_swapRBCheck);
 
+    // Letterbox
+    m_letterboxCheck = new QCheckBox("Letterbox (keep aspect ratio)");
+    m_letterboxCheck->setChecked(m_letterbox);
+    m_letterboxCheck->setToolTip("Scale uniformly and pad instead of stretching to the input size");
+    layout->addWidget(m_letterboxCheck);
+
+    // Warm-up inferences after loading
+    auto* warmupLayout = new QHBoxLayout();
+    warmupLayout->addWidget(new QLabel("Warm-up Runs:"));
+    m_warmupSpin = new QSpinBox();
+    m_warmupSpin->setRange(0, 10);
+    m_warmupSpin->setValue(m_warmupRuns);
+    m_warmupSpin->setToolTip("Dummy inferences run after loading so the first frame is not slow");
+    warmupLayout->addWidget(m_warmupSpin);
+    layout->addLayout(warmupLayout);
+
+    // Pipelined inference (overlaps consecutive frames on worker threads)
+    auto* pipelineLayout = new QHBoxLayout();
+    m_pipelinedCheck = new QCheckBox("Pipelined Inference");
+    m_pipelinedCheck->setChecked(m_pipelined);
+    m_pipelinedCheck->setToolTip("Preprocess, forward and postprocess consecutive frames in parallel.\n"
+                                 "Raises throughput on streams; results arrive one frame later.");
+    pipelineLayout->addWidget(m_pipelinedCheck);
+    pipelineLayout->addWidget(new QLabel("Workers:"));
+    m_workersSpin = new QSpinBox();
+    m_workersSpin->setRange(1, 4);
+    m_workersSpin->setValue(m_inferenceWorkers);
+    m_workersSpin->setToolTip("Concurrent forward passes (each uses its own network context)");
+    pipelineLayout->addWidget(m_workersSpin);
+    layout->addLayout(pipelineLayout);
+
+    // Batching (pipelined mode only)
+    auto* batchLayout = new QHBoxLayout();
+    batchLayout->addWidget(new QLabel("Batch Size:"));
+    m_batchSpin = new QSpinBox();
+    m_batchSpin->setRange(1, 16);
+    m_batchSpin->setValue(m_batchSize);
+    m_batchSpin->setToolTip("Frames per forward pass in pipelined mode, gathered from this node\n"
+                            "and other nodes running the same model (1 = no batching)");
+    batchLayout->addWidget(m_batchSpin);
+    batchLayout->addWidget(new QLabel("Max Wait:"));
+    m_batchWaitSpin = new QSpinBox();
+    m_batchWaitSpin->setRange(0, 200);
+    m_batchWaitSpin->setSuffix(" ms");
+    m_batchWaitSpin->setValue(m_batchWaitMs);
+    m_batchWaitSpin->setToolTip("Longest a frame waits for its batch to fill");
+    batchLayout->addWidget(m_batchWaitSpin);
+    layout->addLayout(batchLayout);
+
     // Status label
     m_statusLabel = new QLabel("Status: No model loaded");
     m_statusLabel->setStyleSheet("QLabel { padding: 5px; }");
     layout->addWidget(m_statusLabel);
 
+    // Load progress (visible while loading)
+    m_loadProgress = new QProgressBar();
+    m_loadProgress->setRange(0, 100);
+    m_loadProgress->setVisible(false);
+    layout->addWidget(m_loadProgress);
+
     layout->setContentsMargins(5, 5, 5, 5);
 
     // Connect signals
@@ -143,10 +197,95 @@ DNNInferenceModel::DNNInferenceModel()
             this, [this]() { m_nmsThreshold = m_nmsSpin->value(); runInference(); });
     connect(m_swapRBCheck, &QCheckBox::stateChanged,
             this, &DNNInferenceModel::onSwapRBChanged);
+    connect(m_letterboxCheck, &QCheckBox::stateChanged,
+            this, &DNNInferenceModel::onLetterboxChanged);
+    connect(m_warmupSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, [this](int value) { m_warmupRuns = value; });
+    connect(m_pipelinedCheck, &QCheckBox::stateChanged,
+            this, &DNNInferenceModel::onPipelinedChanged);
+    connect(m_workersSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &DNNInferenceModel::onInferenceWorkersChanged);
+    connect(m_batchSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &DNNInferenceModel::onBatchSizeChanged);
+    connect(m_batchWaitSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &DNNInferenceModel::onBatchWaitChanged);
+
+    // A restart drains every queued frame, so spinbox steps restart the
+    // pipeline once, after the value settles
+    m_restartTimer = new QTimer(this);
+    m_restartTimer->setSingleShot(true);
+    m_restartTimer->setInterval(300);
+    connect(m_restartTimer, &QTimer::timeout, this,
+            [this]()
+            {
+                if (m_pipeline->isRunning())
+                {
+                    startPipeline();
+                }
+            });
+
+    // Models are parsed and warmed up off the GUI thread
+    m_loader = new DnnModelLoader(this);
+    connect(m_loader, &DnnModelLoader::progress,
+            this, &DNNInferenceModel::onLoadProgress);
+    connect(m_loader, &DnnModelLoader::loaded,
+            this, &DNNInferenceModel::onModelLoaded);
+
+    // Stages run on pipeline threads and only read per-frame parameters,
+    // settings fixed at construction and the snapshot taken in startPipeline()
+    m_pipeline = new InferencePipeline(
+        [this](InferenceFrame& frame)
+        {
+            const BlobPreprocessor::Params params =
+                blobParams(frame.inputSize, m_pipelineSwapRB, m_pipelineLetterbox);
+
+            // Batched frames are written into the batch blob by the batcher
+            if (m_pipelineBatch.maxBatchSize > 1)
+            {
+                frame.transform = BlobPreprocessor::transformFor(frame.image.size(), params);
+                return;
+            }
+            frame.blob = m_preprocessor.process(frame.image, params, &frame.transform);
+        },
+        [this](InferenceFrame& frame)
+        {
+            if (m_pipelineBatch.maxBatchSize > 1)
+            {
+                frame.outputs = m_batcher->infer(
+                    frame.image,
+                    blobParams(frame.inputSize, m_pipelineSwapRB, m_pipelineLetterbox),
+                    m_pipelineBatch);
+                return;
+            }
+
+            SharedDnnNet::Lease lease = m_net->lease();
+            lease.net().setInput(frame.blob);
+
+            std::vector<cv::Mat> outs;
+            lease.net().forward(outs);
+
+            // The next forward() on this context overwrites its output buffers
+            frame.outputs.reserve(outs.size());
+            for (const cv::Mat& out : outs)
+            {
+                frame.outputs.push_back(out.clone());
+            }
+        },
+        [this](InferenceFrame& frame)
+        {
+            decodeDetections(frame.outputs, frame.transform,
+                             frame.scoreThreshold, frame.nmsThreshold, m_pipelineCandidates,
+                             frame.boxes, frame.scores, frame.classIds);
+        },
+        this);
+    connect(m_pipeline, &InferencePipeline::resultsReady,
+            this, &DNNInferenceModel::onPipelineResults);
 }
 
 DNNInferenceModel::~DNNInferenceModel()
 {
+    // The stages use members of this node: join them before those go away
+    stopPipeline();
     m_net = nullptr;
 }
 
@@ -161,7 +300,7 @@ unsigned int DNNInferenceModel::nPorts(QtNodes::PortType portType) const
     }
     else
     {
-        return 1; // One output image (with detections)
+        return 2; // Annotated image, detections
     }
 }
 
@@ -169,8 +308,10 @@ QtNodes::NodeDataType DNNInferenceModel::dataType(
     QtNodes::PortType portType,
     QtNodes::PortIndex portIndex) const
 {
-    Q_UNUSED(portType);
-    Q_UNUSED(portIndex);
+    if (portType == QtNodes::PortType::Out && portIndex == 1)
+    {
+        return DetectionData().type();
+    }
     return ImageData().type();
 }
 
@@ -179,7 +320,10 @@ QtNodes::NodeDataType DNNInferenceModel::dataType(
  ******************************************************************************/
 std::shared_ptr<QtNodes::NodeData> DNNInferenceModel::outData(QtNodes::PortIndex port)
 {
-    Q_UNUSED(port);
+    if (port == 1)
+    {
+        return m_detectionData;
+    }
     return m_outputImage;
 }
 
@@ -192,6 +336,38 @@ void DNNInferenceModel::setInData(std::shared_ptr<QtNodes::NodeData> data,
     runInference();
 }
 
+/*******************************************************************************
+ * Connections
+ ******************************************************************************/
+void DNNInferenceModel::outputConnectionCreated(QtNodes::ConnectionId const& connectionId)
+{
+    if (connectionId.outPortIndex != 0)
+    {
+        return;
+    }
+
+    // The graph pulls outData() right after this, so render the last
+    // detections now instead of waiting for the next frame
+    if (++m_imageConnections == 1)
+    {
+        renderOutputImage();
+    }
+}
+
+void DNNInferenceModel::outputConnectionDeleted(QtNodes::ConnectionId const& connectionId)
+{
+    if (connectionId.outPortIndex != 0)
+    {
+        return;
+    }
+
+    m_imageConnections = std::max(0, m_imageConnections - 1);
+    if (m_imageConnections == 0)
+    {
+        m_outputImage = nullptr;
+    }
+}
+
 /*******************************************************************************
  * Widget
  ******************************************************************************/
@@ -262,10 +438,10 @@ void DNNInferenceModel::onBackendChanged()
 {
     m_backend = m_backendCombo->currentData().toInt();
 
+    // Backend is part of the network identity: switch to the matching one
     if (m_modelLoaded)
     {
-        m_net->setPreferableBackend(m_backend);
-        runInference();
+        loadModelFiles();
     }
 }
 
@@ -275,8 +451,7 @@ void DNNInferenceModel::onTargetChanged()
 
     if (m_modelLoaded)
     {
-        m_net->setPreferableTarget(m_target);
-        runInference();
+        loadModelFiles();
     }
 }
 
@@ -289,6 +464,64 @@ void DNNInferenceModel::onConfidenceChanged(double value)
 void DNNInferenceModel::onSwapRBChanged(int state)
 {
     m_swapRB = (state == Qt::Checked);
+    if (m_pipeline->isRunning())
+    {
+        startPipeline();
+    }
+    runInference();
+}
+
+void DNNInferenceModel::onLetterboxChanged(int state)
+{
+    m_letterbox = (state == Qt::Checked);
+    if (m_pipeline->isRunning())
+    {
+        startPipeline();
+    }
+    runInference();
+}
+
+void DNNInferenceModel::onLoadProgress(const QString& stage, int percent)
+{
+    m_statusLabel->setText(QString("Status: %1").arg(stage));
+    m_loadProgress->setValue(percent);
+}
+
+void DNNInferenceModel::onModelLoaded(const DnnModelLoader::Result& result)
+{
+    m_loadProgress->setVisible(false);
+    m_loadBtn->setEnabled(true);
+
+    if (!result.error.isEmpty())
+    {
+        m_statusLabel->setText(QString("Status: Error - %1").arg(result.error));
+        m_net = nullptr;
+        m_modelLoaded = false;
+        return;
+    }
+
+    m_net = result.network;
+    m_modelLoaded = true;
+    if (m_pipelined)
+    {
+        startPipeline();
+    }
+
+    QString status = QString("Status: Model loaded (%1 classes, %2 ms)")
+                         .arg(m_classes.size())
+                         .arg(result.loadMs);
+    if (!result.warning.isEmpty())
+    {
+        status += QString("\nWarning: %1").arg(result.warning);
+    }
+    else if (m_warmupRuns > 0)
+    {
+        status += QString("\nWarm-up: first %1 ms, steady %2 ms")
+                      .arg(result.firstRunMs, 0, 'f', 1)
+                      .arg(result.steadyRunMs, 0, 'f', 1);
+    }
+    m_statusLabel->setText(status);
+
     runInference();
 }
 
@@ -297,105 +530,101 @@ void DNNInferenceModel::onSwapRBChanged(int state)
  ******************************************************************************/
 void DNNInferenceModel::loadModelFiles()
 {
-    try
+    // Check the model format (the cache picks the importer by extension)
+    QString configPath;
+    if (m_modelPath.endsWith(".onnx", Qt::CaseInsensitive))
     {
-        // Load model based on file extension
-        cv::dnn::Net net;
-        if (m_modelPath.endsWith(".onnx", Qt::CaseInsensitive))
-        {
-            net = cv::dnn::readNetFromONNX(m_modelPath.toStdString());
-        }
-        else if (m_modelPath.endsWith(".pb", Qt::CaseInsensitive))
-        {
-            if (!m_configPath.isEmpty())
-            {
-                net = cv::dnn::readNetFromTensorflow(m_configPath.toStdString(),
-                                                       m_modelPath.toStdString());
-            }
-            else
-            {
-                net = cv::dnn::readNetFromTensorflow(m_modelPath.toStdString());
-            }
-        }
-        else if (m_modelPath.endsWith(".caffemodel", Qt::CaseInsensitive))
-        {
-            if (!m_configPath.isEmpty())
-            {
-                net = cv::dnn::readNetFromCaffe(m_configPath.toStdString(),
-                                                  m_modelPath.toStdString());
-            }
-            else
-            {
-                m_statusLabel->setText("Status: Caffe models require config file");
-                m_modelLoaded = false;
-                return;
-            }
-        }
-        else
-        {
-            m_statusLabel->setText("Status: Unsupported model format");
-            m_modelLoaded = false;
-            return;
-        }
-
-        m_net = cv::makePtr<cv::dnn::Net>(net);
-
-        if (m_net->empty())
+        // Self-contained
+    }
+    else if (m_modelPath.endsWith(".pb", Qt::CaseInsensitive))
+    {
+        configPath = m_configPath;   // Optional text graph
+    }
+    else if (m_modelPath.endsWith(".caffemodel", Qt::CaseInsensitive))
+    {
+        if (m_configPath.isEmpty())
         {
-            m_statusLabel->setText("Status: Failed to load model");
+            m_statusLabel->setText("Status: Caffe models require config file");
+            m_net = nullptr;
             m_modelLoaded = false;
             return;
         }
+        configPath = m_configPath;
+    }
+    else
+    {
+        m_statusLabel->setText("Status: Unsupported model format");
+        m_net = nullptr;
+        m_modelLoaded = false;
+        return;
+    }
 
-        // Set backend and target
-        m_net->setPreferableBackend(m_backend);
-        m_net->setPreferableTarget(m_target);
-
-        // Load class names if provided
-        if (!m_classesPath.isEmpty())
+    // Load class names if provided
+    if (!m_classesPath.isEmpty())
+    {
+        std::ifstream ifs(m_classesPath.toStdString());
+        std::string line;
+        m_classes.clear();
+        while (std::getline(ifs, line))
         {
-            std::ifstream ifs(m_classesPath.toStdString());
-            std::string line;
-            m_classes.clear();
-            while (std::getline(ifs, line))
+            if (!line.empty())
             {
-                if (!line.empty())
-                {
-                    m_classes.push_back(line);
-                }
+                m_classes.push_back(line);
             }
         }
+    }
 
-        m_modelLoaded = true;
-        m_statusLabel->setText(QString("Status: Model loaded (%1 classes)")
-                               .arg(m_classes.size()));
+    // Shared with every other node using the same model, backend and target;
+    // parsed and warmed up in the background, frames are skipped meanwhile
+    DnnModelLoader::Request request;
+    request.modelPath = m_modelPath;
+    request.configPath = configPath;
+    request.backend = m_backend;
+    request.target = m_target;
+    request.inputSize = m_inputSize;
+    request.warmupRuns = m_warmupRuns;
+
+    stopPipeline();
+    m_batcher = nullptr;
+    m_net = nullptr;
+    m_modelLoaded = false;
+    m_loadBtn->setEnabled(false);
+    m_loadProgress->setValue(0);
+    m_loadProgress->setVisible(true);
+    m_statusLabel->setText("Status: Loading model...");
 
-        runInference();
-    }
-    catch (const cv::Exception& e)
-    {
-        m_statusLabel->setText(QString("Status: Error - %1").arg(e.what()));
-        m_modelLoaded = false;
-    }
+    m_loader->load(request);
 }
 
-void DNNInferenceModel::preprocessImage(const cv::Mat& image, cv::Mat& blob,
-                                        cv::Size& inputSize)
+cv::Mat DNNInferenceModel::preprocessImage(const cv::Mat& image, LetterboxTransform& transform)
 {
-    // Default input size
-    inputSize = cv::Size(640, 640);
+    // Resize (or letterbox), normalize and convert to NCHW in one pass into
+    // a reused buffer
+    return m_preprocessor.process(image, blobParams(m_inputSize, m_swapRB, m_letterbox),
+                                  &transform);
+}
 
-    // Create blob from image
-    blob = cv::dnn::blobFromImage(image, m_scale, inputSize, m_mean,
-                                   m_swapRB, false, CV_32F);
+BlobPreprocessor::Params DNNInferenceModel::blobParams(const cv::Size& inputSize, bool swapRB,
+                                                       bool letterbox) const
+{
+    BlobPreprocessor::Params params;
+    params.inputSize = inputSize;
+    params.scale = m_scale;
+    params.mean = m_mean;
+    params.swapRB = swapRB;
+    params.letterbox = letterbox;
+    return params;
 }
 
 void DNNInferenceModel::runInference()
 {
     if (!m_inputImage || !m_modelLoaded)
     {
+        m_frameImage.release();
         m_outputImage = nullptr;
+        m_detectionData = nullptr;
         Q_EMIT dataUpdated(0);
+        Q_EMIT dataUpdated(1);
         return;
     }
 
@@ -403,59 +632,299 @@ void DNNInferenceModel::runInference()
 
     if (input.empty())
     {
+        m_frameImage.release();
         m_outputImage = nullptr;
+        m_detectionData = nullptr;
         Q_EMIT dataUpdated(0);
+        Q_EMIT dataUpdated(1);
+        return;
+    }
+
+    // Pipelined: results are published by onPipelineResults()
+    if (m_pipeline->isRunning())
+    {
+        InferenceFrame frame;
+        frame.image = input;
+        frame.inputSize = m_inputSize;
+        frame.scoreThreshold = static_cast<float>(m_confidenceThreshold);
+        frame.nmsThreshold = static_cast<float>(m_nmsThreshold);
+        m_pipeline->submit(std::move(frame));
         return;
     }
 
     try
     {
         // Preprocess image
-        cv::Mat blob;
-        cv::Size inputSize;
-        preprocessImage(input, blob, inputSize);
+        LetterboxTransform transform;
+        cv::Mat blob = preprocessImage(input, transform);
+
+        // Borrow an inference context; outputs stay valid while it is held
+        SharedDnnNet::Lease lease = m_net->lease();
 
         // Set input to the network
-        m_net->setInput(blob);
+        lease.net().setInput(blob);
 
         // Forward pass
         std::vector<cv::Mat> outs;
-        m_net->forward(outs);
+        lease.net().forward(outs);
 
-        // Visualize detections
-        cv::Mat output = visualizeDetections(input, outs);
+        // Decode detections
+        decodeDetections(outs, transform,
+                         static_cast<float>(m_confidenceThreshold),
+                         static_cast<float>(m_nmsThreshold),
+                         m_candidates, m_keptBoxes, m_keptScores, m_keptClassIds);
+        publishDetections(input, m_keptBoxes, m_keptScores, m_keptClassIds);
 
-        m_outputImage = std::make_shared<ImageData>(output);
         Q_EMIT dataUpdated(0);
+        Q_EMIT dataUpdated(1);
     }
     catch (const cv::Exception& e)
     {
+        m_frameImage.release();
         m_outputImage = nullptr;
+        m_detectionData = nullptr;
         Q_EMIT dataUpdated(0);
+        Q_EMIT dataUpdated(1);
+    }
+}
+
+void DNNInferenceModel::decodeDetections(const std::vector<cv::Mat>& outs,
+                                         const LetterboxTransform& transform,
+                                         float scoreThreshold,
+                                         float nmsThreshold,
+                                         YoloCandidates& candidates,
+                                         std::vector<cv::Rect>& boxes,
+                                         std::vector<float>& scores,
+                                         std::vector<int>& classIds)
+{
+    candidates.clear();
+    boxes.clear();
+    scores.clear();
+    classIds.clear();
+
+    // Only YOLO-style heads are decoded: [1, num_detections, 5 + classes]
+    // with boxes in network input pixels. Other models publish no detections.
+    cv::Mat out = outs.empty() ? cv::Mat() : outs[0];
+    const bool yoloLayout = out.dims == 3 && out.size[2] > 5 && out.size[1] > out.size[2];
+    if (!yoloLayout)
+    {
+        return;
+    }
+
+    YoloDecoder::Params params;
+    params.scoreThreshold = scoreThreshold;
+    params.multiplyObjectness = true;
+    params.scaleX = 1.0f / transform.scaleX();
+    params.scaleY = 1.0f / transform.scaleY();
+    params.offsetX = static_cast<float>(transform.content.x);
+    params.offsetY = static_cast<float>(transform.content.y);
+    params.clipWidth = transform.imageSize.width;
+    params.clipHeight = transform.imageSize.height;
+    YoloDecoder::decode(out, params, candidates);
+
+    // Class-aware: boxes only suppress boxes of their own class
+    BoxNms::Params nms;
+    nms.scoreThreshold = scoreThreshold;
+    nms.iouThreshold = nmsThreshold;
+
+    std::vector<int> indices;
+    BoxNms::run(candidates, nms, indices, scores);
+
+    boxes.reserve(indices.size());
+    classIds.reserve(indices.size());
+    for (int idx : indices)
+    {
+        boxes.push_back(candidates.rect(idx));
+        classIds.push_back(candidates.classId[idx]);
+    }
+}
+
+void DNNInferenceModel::publishDetections(const cv::Mat& image,
+                                          const std::vector<cv::Rect>& boxes,
+                                          const std::vector<float>& scores,
+                                          const std::vector<int>& classIds)
+{
+    m_frameImage = image;
+
+    const double invWidth = 1.0 / image.cols;
+    const double invHeight = 1.0 / image.rows;
+    QVector<DetectionData::Detection> detections;
+    detections.reserve(static_cast<int>(boxes.size()));
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        const int classId = classIds[i];
+        QString label = classId < static_cast<int>(m_classes.size())
+                            ? QString::fromStdString(m_classes[classId])
+                            : QString("Class_%1").arg(classId);
+
+        const cv::Rect& box = boxes[i];
+        detections.append(DetectionData::Detection(
+            QRectF(box.x * invWidth, box.y * invHeight,
+                   box.width * invWidth, box.height * invHeight),
+            label, scores[i]));
+    }
+
+    m_detectionData = std::make_shared<DetectionData>(detections);
+
+    // Drawing is only done for a connected image port
+    renderOutputImage();
+}
+
+void DNNInferenceModel::renderOutputImage()
+{
+    // Nobody consumes the image: skip the copy and the drawing entirely
+    if (m_imageConnections == 0 || m_frameImage.empty())
+    {
+        m_outputImage = nullptr;
+        return;
+    }
+
+    cv::Mat result = m_frameImage.clone();
+
+    if (m_detectionData)
+    {
+        const cv::Scalar color(0, 255, 0);
+        for (const DetectionData::Detection& det : m_detectionData->detections())
+        {
+            cv::Rect box(cvRound(det.bbox.x() * result.cols),
+                         cvRound(det.bbox.y() * result.rows),
+                         cvRound(det.bbox.width() * result.cols),
+                         cvRound(det.bbox.height() * result.rows));
+            cv::rectangle(result, box, color, 2);
+
+            std::string label = det.label.toStdString() + ": " +
+                                std::to_string(static_cast<int>(det.confidence * 100)) + "%";
+            cv::putText(result, label, cv::Point(box.x, std::max(box.y - 4, 12)),
+                       cv::FONT_HERSHEY_SIMPLEX, 0.5, color, 1);
+        }
+    }
+
+    m_outputImage = std::make_shared<ImageData>(result);
+}
+
+/*******************************************************************************
+ * Pipelined Inference
+ ******************************************************************************/
+void DNNInferenceModel::startPipeline()
+{
+    if (!m_net)
+    {
+        return;
+    }
+
+    // Restarts with the current settings when already running
+    m_restartTimer->stop();
+    m_pipeline->stop();
+    m_pipelineSwapRB = m_swapRB;
+    m_pipelineLetterbox = m_letterbox;
+    m_pipelineBatch.maxBatchSize = m_batchSize;
+    m_pipelineBatch.maxWaitMs = m_batchWaitMs;
+    m_batcher = DnnBatcher::forNetwork(m_net);
+
+    // A batch fills from frames waiting in concurrent inference workers
+    InferencePipeline::Config config;
+    config.inferenceWorkers = std::max(m_inferenceWorkers, m_batchSize);
+    config.queueDepth = std::max(config.queueDepth, m_batchSize);
+    m_pipeline->start(config);
+}
+
+void DNNInferenceModel::stopPipeline()
+{
+    m_restartTimer->stop();
+    if (m_pipeline)
+    {
+        m_pipeline->stop();
+    }
+}
+
+void DNNInferenceModel::onPipelinedChanged(int state)
+{
+    m_pipelined = (state == Qt::Checked);
+    if (m_pipelined && m_modelLoaded)
+    {
+        startPipeline();
+    }
+    else
+    {
+        stopPipeline();
     }
 }
 
-cv::Mat DNNInferenceModel::visualizeDetections(const cv::Mat& image,
-                                              const std::vector<cv::Mat>& outs)
+void DNNInferenceModel::onInferenceWorkersChanged(int value)
 {
-    cv::Mat result = image.clone();
+    m_inferenceWorkers = value;
+    if (m_pipeline->isRunning())
+    {
+        m_restartTimer->start();
+    }
+}
+
+void DNNInferenceModel::onBatchSizeChanged(int value)
+{
+    m_batchSize = value;
+    if (m_pipeline->isRunning())
+    {
+        m_restartTimer->start();
+    }
+}
 
-    // For object detection models (like YOLO), outputs typically have shape:
-    // [1, num_detections, 85] where 85 = (x, y, w, h, confidence, class_scores...)
+void DNNInferenceModel::onBatchWaitChanged(int value)
+{
+    m_batchWaitMs = value;
+    if (m_pipeline->isRunning())
+    {
+        m_restartTimer->start();
+    }
+}
 
-    // This is a simplified visualization - real implementation depends on model type
-    // For now, just return the original image with a note
-    cv::putText(result, "DNN Inference Complete", cv::Point(10, 30),
-               cv::FONT_HERSHEY_SIMPLEX, 0.7, cv::Scalar(0, 255, 0), 2);
+void DNNInferenceModel::onPipelineResults()
+{
+    std::vector<InferenceFrame> results = m_pipeline->takeResults();
+    if (results.empty())
+    {
+        return;
+    }
 
-    if (!m_classes.empty())
+    // In submission order, one update per frame
+    for (const InferenceFrame& frame : results)
     {
-        cv::putText(result, QString("Classes: %1").arg(m_classes.size()).toStdString(),
-                   cv::Point(10, 60), cv::FONT_HERSHEY_SIMPLEX, 0.7,
-                   cv::Scalar(0, 255, 0), 2);
+        if (!frame.error.isEmpty())
+        {
+            m_frameImage.release();
+            m_outputImage = nullptr;
+            m_detectionData = nullptr;
+        }
+        else
+        {
+            publishDetections(frame.image, frame.boxes, frame.scores, frame.classIds);
+        }
+        Q_EMIT dataUpdated(0);
+        Q_EMIT dataUpdated(1);
     }
 
-    return result;
+    const InferencePipelineStats stats = m_pipeline->stats();
+    m_statusLabel->setText(QString("Status: Pipelined - pre %1 ms, forward %2 ms, post %3 ms\n"
+                                   "%4 fps, latency %5 ms, %6 dropped")
+                               .arg(stats.preprocessMs, 0, 'f', 1)
+                               .arg(stats.inferenceMs, 0, 'f', 1)
+                               .arg(stats.postprocessMs, 0, 'f', 1)
+                               .arg(stats.throughputFps, 0, 'f', 1)
+                               .arg(stats.latencyMs, 0, 'f', 1)
+                               .arg(stats.dropped));
+
+    PerformanceMonitor* monitor = PerformanceMonitor::instance();
+    if (m_pipelineBatch.maxBatchSize > 1)
+    {
+        const double batchSize = m_batcher->stats().averageBatchSize();
+        m_statusLabel->setText(m_statusLabel->text() +
+                               QString(", batch %1").arg(batchSize, 0, 'f', 1));
+        monitor->recordMetric(this, caption(), "batchSize", batchSize);
+    }
+    monitor->recordMetric(this, caption(), "preprocessMs", stats.preprocessMs);
+    monitor->recordMetric(this, caption(), "inferenceMs", stats.inferenceMs);
+    monitor->recordMetric(this, caption(), "postprocessMs", stats.postprocessMs);
+    monitor->recordMetric(this, caption(), "pipelineFps", stats.throughputFps);
+    monitor->recordMetric(this, caption(), "droppedFrames", static_cast<double>(stats.dropped));
 }
 
 /*******************************************************************************
@@ -472,6 +941,12 @@ QJsonObject DNNInferenceModel::save() const
     modelJson["confidenceThreshold"] = m_confidenceThreshold;
     modelJson["nmsThreshold"] = m_nmsThreshold;
     modelJson["swapRB"] = m_swapRB;
+    modelJson["letterbox"] = m_letterbox;
+    modelJson["warmupRuns"] = m_warmupRuns;
+    modelJson["pipelined"] = m_pipelined;
+    modelJson["inferenceWorkers"] = m_inferenceWorkers;
+    modelJson["batchSize"] = m_batchSize;
+    modelJson["batchWaitMs"] = m_batchWaitMs;
     return modelJson;
 }
 
@@ -552,6 +1027,48 @@ void DNNInferenceModel::load(QJsonObject const& model)
         m_swapRBCheck->setChecked(m_swapRB);
     }
 
+    QJsonValue letterboxJson = model["letterbox"];
+    if (!letterboxJson.isUndefined())
+    {
+        m_letterbox = letterboxJson.toBool();
+        m_letterboxCheck->setChecked(m_letterbox);
+    }
+
+    QJsonValue warmupJson = model["warmupRuns"];
+    if (!warmupJson.isUndefined())
+    {
+        m_warmupRuns = warmupJson.toInt();
+        m_warmupSpin->setValue(m_warmupRuns);
+    }
+
+    QJsonValue workersJson = model["inferenceWorkers"];
+    if (!workersJson.isUndefined())
+    {
+        m_inferenceWorkers = workersJson.toInt();
+        m_workersSpin->setValue(m_inferenceWorkers);
+    }
+
+    QJsonValue batchJson = model["batchSize"];
+    if (!batchJson.isUndefined())
+    {
+        m_batchSize = batchJson.toInt();
+        m_batchSpin->setValue(m_batchSize);
+    }
+
+    QJsonValue batchWaitJson = model["batchWaitMs"];
+    if (!batchWaitJson.isUndefined())
+    {
+        m_batchWaitMs = batchWaitJson.toInt();
+        m_batchWaitSpin->setValue(m_batchWaitMs);
+    }
+
+    QJsonValue pipelinedJson = model["pipelined"];
+    if (!pipelinedJson.isUndefined())
+    {
+        m_pipelined = pipelinedJson.toBool();
+        m_pipelinedCheck->setChecked(m_pipelined);
+    }
+
     // Auto-load model if path is set
     if (!m_modelPath.isEmpty())
     {
@@ -7,6 +7,13 @@
 #define VISIONBOX_DNNINFERENCEMODEL_H
 
 #include "core/PluginInterface.h"
+#include "core/YoloDecoder.h"
+#include "core/DnnNetCache.h"
+#include "core/DnnModelLoader.h"
+#include "core/InferencePipeline.h"
+#include "core/DnnBatcher.h"
+#include "core/BlobPreprocessor.h"
+#include "core/BoxNms.h"
 #include <QtNodes/NodeDelegateModel>
 #include <QWidget>
 #include <QVBoxLayout>
@@ -19,12 +26,15 @@
 #include <QFileDialog>
 #include <QSpinBox>
 #include <QDoubleSpinBox>
+#include <QProgressBar>
+#include <QTimer>
 #include <opencv2/opencv.hpp>
 #include <opencv2/dnn.hpp>
 
 namespace VisionBox {
 
 class ImageData;
+class DetectionData;
 
 /*******************************************************************************
  * DNNInferenceModel - Deep Neural Network inference
@@ -53,6 +63,10 @@ public:
     QJsonObject save() const override;
     void load(QJsonObject const& model) override;
 
+public slots:
+    void outputConnectionCreated(QtNodes::ConnectionId const& connectionId) override;
+    void outputConnectionDeleted(QtNodes::ConnectionId const& connectionId) override;
+
 private slots:
     void onBrowseModel();
     void onBrowseConfig();
@@ -62,12 +76,39 @@ private slots:
     void onTargetChanged();
     void onConfidenceChanged(double value);
     void onSwapRBChanged(int state);
+    void onLetterboxChanged(int state);
+    void onLoadProgress(const QString& stage, int percent);
+    void onModelLoaded(const DnnModelLoader::Result& result);
+    void onPipelinedChanged(int state);
+    void onInferenceWorkersChanged(int value);
+    void onBatchSizeChanged(int value);
+    void onBatchWaitChanged(int value);
+    void onPipelineResults();
     void runInference();
 
 private:
     void loadModelFiles();
-    void preprocessImage(const cv::Mat& image, cv::Mat& blob, cv::Size& inputSize);
-    cv::Mat visualizeDetections(const cv::Mat& image, const std::vector<cv::Mat>& outs);
+    cv::Mat preprocessImage(const cv::Mat& image, LetterboxTransform& transform);
+    BlobPreprocessor::Params blobParams(const cv::Size& inputSize, bool swapRB,
+                                        bool letterbox) const;
+    void publishDetections(const cv::Mat& image,
+                           const std::vector<cv::Rect>& boxes,
+                           const std::vector<float>& scores,
+                           const std::vector<int>& classIds);
+    void renderOutputImage();
+    void startPipeline();
+    void stopPipeline();
+
+    // YOLO-style decode + NMS; touches only its arguments, so it also runs
+    // on the pipeline's postprocess thread
+    static void decodeDetections(const std::vector<cv::Mat>& outs,
+                                 const LetterboxTransform& transform,
+                                 float scoreThreshold,
+                                 float nmsThreshold,
+                                 YoloCandidates& candidates,
+                                 std::vector<cv::Rect>& boxes,
+                                 std::vector<float>& scores,
+                                 std::vector<int>& classIds);
 
 private:
     // Model files
@@ -83,20 +124,48 @@ private:
     double m_confidenceThreshold = 0.5;  // Confidence threshold for detections
     double m_nmsThreshold = 0.4;         // Non-maximum suppression threshold
     bool m_swapRB = true;                // Swap Red and Blue channels
+    bool m_letterbox = false;            // Keep aspect ratio, pad to input size
     cv::Scalar m_mean = cv::Scalar(0, 0, 0, 0);
     double m_scale = 1.0;
     cv::Size m_inputSize = cv::Size(640, 640);
+    int m_warmupRuns = 2;                // Dummy inferences after loading
 
     // Network
-    cv::Ptr<cv::dnn::Net> m_net;
+    std::shared_ptr<SharedDnnNet> m_net;
     bool m_modelLoaded = false;
+    DnnModelLoader* m_loader = nullptr;
+
+    // Pipelined mode: preprocess, forward and postprocess of consecutive
+    // frames overlap on worker threads; m_net only changes while stopped
+    bool m_pipelined = false;
+    int m_inferenceWorkers = 1;
+    InferencePipeline* m_pipeline = nullptr;
+    bool m_pipelineSwapRB = true;                  // Snapshots read by the stages
+    bool m_pipelineLetterbox = false;
+    YoloCandidates m_pipelineCandidates;           // Postprocess thread only
+
+    // Batching (pipelined mode): inference workers of this node and of other
+    // nodes running the same network share forward passes
+    int m_batchSize = 1;                           // 1 disables batching
+    int m_batchWaitMs = 5;
+    std::shared_ptr<DnnBatcher> m_batcher;
+    QTimer* m_restartTimer = nullptr;              // Debounces pipeline restarts
+    DnnBatcher::Limits m_pipelineBatch;            // Snapshot read by the stages
 
     // Class names
     std::vector<std::string> m_classes;
 
     // Data
     std::shared_ptr<ImageData> m_inputImage;
-    std::shared_ptr<ImageData> m_outputImage;
+    cv::Mat m_frameImage;                           // Frame the current detections belong to
+    std::shared_ptr<ImageData> m_outputImage;       // Only rendered while port 0 is connected
+    std::shared_ptr<DetectionData> m_detectionData;
+    YoloCandidates m_candidates;                    // Reused decode buffers
+    BlobPreprocessor m_preprocessor;                // Reusable blob buffers (thread-safe)
+    std::vector<cv::Rect> m_keptBoxes;
+    std::vector<float> m_keptScores;
+    std::vector<int> m_keptClassIds;
+    int m_imageConnections = 0;
 
     // UI
     QWidget* m_widget = nullptr;
@@ -112,7 +181,14 @@ private:
     QDoubleSpinBox* m_confidenceSpin = nullptr;
     QDoubleSpinBox* m_nmsSpin = nullptr;
     QCheckBox* m_swapRBCheck = nullptr;
+    QCheckBox* m_letterboxCheck = nullptr;
+    QSpinBox* m_warmupSpin = nullptr;
+    QCheckBox* m_pipelinedCheck = nullptr;
+    QSpinBox* m_workersSpin = nullptr;
+    QSpinBox* m_batchSpin = nullptr;
+    QSpinBox* m_batchWaitSpin = nullptr;
     QLabel* m_statusLabel = nullptr;
+    QProgressBar* m_loadProgress = nullptr;
 };
 
 } // namespace VisionBox
@@ -0,0 +1,360 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Detection Log Source Node Model Implementation
+ ******************************************************************************/
+
+#include "DetectionLogSourceModel.h"
+#include <QFile>
+#include <QTimer>
+#include <QJsonObject>
+
+namespace VisionBox {
+
+/*******************************************************************************
+ * Constructor / Destructor
+ ******************************************************************************/
+DetectionLogSourceModel::DetectionLogSourceModel()
+{
+    // Create playback timer
+    m_playbackTimer = new QTimer(this);
+    m_playbackTimer->setInterval(33); // ~30 FPS default
+    connect(m_playbackTimer, &QTimer::timeout,
+            this, &DetectionLogSourceModel::updateFrame);
+
+    // Create embedded widget
+    m_widget = new QWidget();
+    auto* layout = new QVBoxLayout(m_widget);
+
+    // File path label
+    m_pathLabel = new QLabel("No log loaded");
+    m_pathLabel->setWordWrap(true);
+    m_pathLabel->setStyleSheet("QLabel { padding: 5px; }");
+
+    // Browse button
+    m_browseButton = new QPushButton("Browse...");
+    m_browseButton->setStyleSheet("QPushButton { padding: 5px; }");
+
+    // Log summary
+    m_summaryLabel = new QLabel("Detections: -");
+    m_summaryLabel->setStyleSheet("QLabel { padding: 5px; }");
+
+    m_frameLabel = new QLabel("Frame: 0 / 0");
+    m_frameLabel->setStyleSheet("QLabel { padding: 5px; }");
+
+    // Playback controls
+    auto* controlLayout = new QHBoxLayout();
+
+    m_playPauseButton = new QPushButton("Play");
+    m_playPauseButton->setEnabled(false);
+    m_playPauseButton->setStyleSheet("QPushButton { padding: 5px; }");
+
+    m_frameSlider = new QSlider(Qt::Horizontal);
+    m_frameSlider->setEnabled(false);
+    m_frameSlider->setRange(0, 0);
+
+    m_frameSpin = new QSpinBox();
+    m_frameSpin->setEnabled(false);
+    m_frameSpin->setRange(0, 0);
+    m_frameSpin->setMinimumWidth(80);
+
+    controlLayout->addWidget(m_playPauseButton);
+    controlLayout->addWidget(m_frameSlider);
+    controlLayout->addWidget(m_frameSpin);
+
+    // Playback rate
+    auto* fpsLayout = new QHBoxLayout();
+    fpsLayout->addWidget(new QLabel("FPS:"));
+    m_fpsSpin = new QDoubleSpinBox();
+    m_fpsSpin->setRange(1.0, 10000.0);
+    m_fpsSpin->setValue(m_fps);
+    m_fpsSpin->setDecimals(1);
+    fpsLayout->addWidget(m_fpsSpin);
+
+    layout->addWidget(m_pathLabel);
+    layout->addWidget(m_browseButton);
+    layout->addWidget(m_summaryLabel);
+    layout->addWidget(m_frameLabel);
+    layout->addLayout(controlLayout);
+    layout->addLayout(fpsLayout);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    // Connect signals
+    connect(m_browseButton, &QPushButton::clicked,
+            this, &DetectionLogSourceModel::onBrowseClicked);
+    connect(m_playPauseButton, &QPushButton::clicked,
+            this, &DetectionLogSourceModel::onPlayPauseClicked);
+    connect(m_frameSlider, &QSlider::valueChanged,
+            this, &DetectionLogSourceModel::onFrameChanged);
+    connect(m_frameSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &DetectionLogSourceModel::onFrameChanged);
+    connect(m_fpsSpin, QOverload<double>::of(&QDoubleSpinBox::valueChanged),
+            this, &DetectionLogSourceModel::onFpsChanged);
+}
+
+DetectionLogSourceModel::~DetectionLogSourceModel()
+{
+    closeFile();
+}
+
+/*******************************************************************************
+ * Port Configuration
+ ******************************************************************************/
+unsigned int DetectionLogSourceModel::nPorts(QtNodes::PortType portType) const
+{
+    if (portType == QtNodes::PortType::In)
+    {
+        return 0; // No input ports
+    }
+    else
+    {
+        return 2; // Detections and keypoints of the current frame
+    }
+}
+
+QtNodes::NodeDataType DetectionLogSourceModel::dataType(
+    QtNodes::PortType portType,
+    QtNodes::PortIndex portIndex) const
+{
+    Q_UNUSED(portType);
+    if (portIndex == 1)
+    {
+        return KeypointData().type();
+    }
+    return DetectionData().type();
+}
+
+/*******************************************************************************
+ * Data Flow
+ ******************************************************************************/
+std::shared_ptr<QtNodes::NodeData> DetectionLogSourceModel::outData(QtNodes::PortIndex port)
+{
+    if (port == 1)
+    {
+        return m_keypointData;
+    }
+    return m_detectionData;
+}
+
+/*******************************************************************************
+ * Widget
+ ******************************************************************************/
+QWidget* DetectionLogSourceModel::embeddedWidget()
+{
+    return m_widget;
+}
+
+/*******************************************************************************
+ * Slots
+ ******************************************************************************/
+void DetectionLogSourceModel::onBrowseClicked()
+{
+    QString filePath = QFileDialog::getOpenFileName(
+        nullptr,
+        "Open Detection Log",
+        "",
+        "Detection Logs (*.vbdl);;All Files (*.*)"
+    );
+
+    if (!filePath.isEmpty())
+    {
+        openFile(filePath);
+    }
+}
+
+void DetectionLogSourceModel::onPlayPauseClicked()
+{
+    if (!m_reader.isOpen())
+    {
+        return;
+    }
+
+    m_isPlaying = !m_isPlaying;
+
+    if (m_isPlaying)
+    {
+        m_playPauseButton->setText("Pause");
+        m_playbackTimer->setInterval(static_cast<int>(1000.0 / m_fps));
+        m_playbackTimer->start();
+    }
+    else
+    {
+        m_playPauseButton->setText("Play");
+        m_playbackTimer->stop();
+    }
+}
+
+void DetectionLogSourceModel::onFrameChanged(int frame)
+{
+    showFrame(frame);
+}
+
+void DetectionLogSourceModel::onFpsChanged(double fps)
+{
+    m_fps = fps;
+    m_playbackTimer->setInterval(static_cast<int>(1000.0 / m_fps));
+}
+
+void DetectionLogSourceModel::updateFrame()
+{
+    if (!m_reader.isOpen())
+    {
+        return;
+    }
+
+    // Loop back to the first frame at the end of the log
+    int next = m_currentFrame + 1;
+    if (next >= m_totalFrames)
+    {
+        next = 0;
+    }
+    showFrame(next);
+}
+
+/*******************************************************************************
+ * File Operations
+ ******************************************************************************/
+void DetectionLogSourceModel::openFile(const QString& filePath)
+{
+    closeFile();
+    m_filePath = filePath;
+
+    QString error;
+    if (!m_reader.open(filePath))
+    {
+        error = m_reader.errorString();
+    }
+    else if (m_reader.frameCount() <= 0)
+    {
+        error = "Log holds no complete frame";
+        m_reader.close();
+    }
+
+    if (!error.isEmpty())
+    {
+        m_pathLabel->setText("Failed to load: " + QFileInfo(filePath).fileName() + " (" + error + ")");
+        m_summaryLabel->setText("Detections: -");
+        m_playPauseButton->setEnabled(false);
+        m_frameSlider->setEnabled(false);
+        m_frameSpin->setEnabled(false);
+        updateUI();
+        Q_EMIT dataUpdated(0);
+        Q_EMIT dataUpdated(1);
+        return;
+    }
+
+    m_totalFrames = m_reader.frameCount();
+
+    m_pathLabel->setText("Loaded: " + QFileInfo(filePath).fileName());
+    m_summaryLabel->setText(QString("Detections: %1, Keypoints: %2, Labels: %3")
+                                .arg(m_reader.totalDetections())
+                                .arg(m_reader.totalKeypoints())
+                                .arg(m_reader.labels().size()));
+
+    m_playPauseButton->setEnabled(true);
+    m_playPauseButton->setText("Play");
+
+    m_frameSlider->blockSignals(true);
+    m_frameSpin->blockSignals(true);
+    m_frameSlider->setEnabled(true);
+    m_frameSlider->setRange(0, m_totalFrames - 1);
+    m_frameSpin->setEnabled(true);
+    m_frameSpin->setRange(0, m_totalFrames - 1);
+    m_frameSlider->blockSignals(false);
+    m_frameSpin->blockSignals(false);
+
+    showFrame(0);
+}
+
+void DetectionLogSourceModel::closeFile()
+{
+    m_playbackTimer->stop();
+    m_isPlaying = false;
+
+    // Emitted data holds copies, so the mapping can go away immediately
+    m_reader.close();
+    m_detectionData = nullptr;
+    m_keypointData = nullptr;
+    m_totalFrames = 0;
+    m_currentFrame = 0;
+}
+
+void DetectionLogSourceModel::showFrame(int frameIndex)
+{
+    if (!m_reader.isOpen())
+    {
+        return;
+    }
+
+    frameIndex = qBound(0, frameIndex, m_totalFrames - 1);
+
+    m_currentFrame = frameIndex;
+    m_detectionData = std::make_shared<DetectionData>(m_reader.detections(frameIndex));
+    m_keypointData = std::make_shared<KeypointData>(m_reader.keypoints(frameIndex));
+    updateUI();
+    Q_EMIT dataUpdated(0);
+    Q_EMIT dataUpdated(1);
+}
+
+void DetectionLogSourceModel::updateUI()
+{
+    QString frameText = QString("Frame: %1 / %2")
+                            .arg(m_totalFrames > 0 ? m_currentFrame + 1 : 0)
+                            .arg(m_totalFrames);
+    if (m_totalFrames > 0)
+    {
+        frameText += QString(" (#%1, %2 detections)")
+                         .arg(m_reader.frameIndex(m_currentFrame))
+                         .arg(m_reader.detectionCount(m_currentFrame));
+    }
+    m_frameLabel->setText(frameText);
+
+    // Block signals to prevent feedback loop
+    m_frameSlider->blockSignals(true);
+    m_frameSpin->blockSignals(true);
+
+    m_frameSlider->setValue(m_currentFrame);
+    m_frameSpin->setValue(m_currentFrame);
+
+    m_frameSlider->blockSignals(false);
+    m_frameSpin->blockSignals(false);
+}
+
+/*******************************************************************************
+ * Serialization
+ ******************************************************************************/
+QJsonObject DetectionLogSourceModel::save() const
+{
+    QJsonObject modelJson;
+    modelJson["filePath"] = m_filePath;
+    modelJson["currentFrame"] = m_currentFrame;
+    modelJson["fps"] = m_fps;
+    return modelJson;
+}
+
+void DetectionLogSourceModel::load(QJsonObject const& model)
+{
+    QJsonValue fpsJson = model["fps"];
+    if (!fpsJson.isUndefined())
+    {
+        m_fpsSpin->setValue(fpsJson.toDouble(30.0));
+    }
+
+    QJsonValue filePathJson = model["filePath"];
+    if (!filePathJson.isUndefined())
+    {
+        QString filePath = filePathJson.toString();
+        if (!filePath.isEmpty() && QFile::exists(filePath))
+        {
+            openFile(filePath);
+
+            // Restore frame position
+            QJsonValue frameJson = model["currentFrame"];
+            if (!frameJson.isUndefined())
+            {
+                showFrame(frameJson.toInt());
+            }
+        }
+    }
+}
+
+} // namespace VisionBox
@@ -7,16 +7,32 @@
 #include "core/VisionDataTypes.h"
 #include "core/PerformanceMonitor.h"
 #include <opencv2/opencv.hpp>
-#include <QRandomGenerator>
 #include <QTimer>
+#include <algorithm>
+#include <climits>
+#include <cmath>
 
 namespace VisionBox {
 
+namespace {
+
+// Memory budget of the frame bank (the frame count is cut to fit)
+constexpr qint64 kMaxBankBytes = 512LL * 1024 * 1024;
+
+// Timer interval for a target rate (0 fps = as fast as possible)
+int streamInterval(double fps)
+{
+    return fps > 0.0 ? std::max(1, static_cast<int>(std::lround(1000.0 / fps))) : 0;
+}
+
+} // namespace
+
 /*******************************************************************************
  * Constructor / Destructor
  ******************************************************************************/
 ImageGeneratorModel::ImageGeneratorModel()
-    : m_imageData(nullptr)
+    : m_streamTimer(new QTimer(this))
+    , m_imageData(nullptr)
     , m_generateTimer(new QTimer(this))
 {
     // Setup debounce timer (50ms delay to prevent excessive updates)
@@ -25,6 +41,11 @@ ImageGeneratorModel::ImageGeneratorModel()
     connect(m_generateTimer, &QTimer::timeout,
             this, &ImageGeneratorModel::performGenerate);
 
+    // Streaming timer (interval 0 = run on every event loop pass)
+    m_streamTimer->setTimerType(Qt::PreciseTimer);
+    connect(m_streamTimer, &QTimer::timeout,
+            this, &ImageGeneratorModel::onStreamTick);
+
     // Create embedded widget
     m_widget = new QWidget();
     auto* layout = new QVBoxLayout(m_widget);
@@ -33,17 +54,17 @@ ImageGeneratorModel::ImageGeneratorModel()
     auto* patternLayout = new QHBoxLayout();
     patternLayout->addWidget(new QLabel("Pattern:"));
     m_patternCombo = new QComboBox();
-    m_patternCombo->addItem("Solid Color", SolidColor);
-    m_patternCombo->addItem("Gradient (Horizontal)", GradientHorizontal);
-    m_patternCombo->addItem("Gradient (Vertical)", GradientVertical);
-    m_patternCombo->addItem("Gradient (Diagonal)", GradientDiagonal);
-    m_patternCombo->addItem("Checkerboard", Checkerboard);
-    m_patternCombo->addItem("Grid", Grid);
-    m_patternCombo->addItem("Circles", Circles);
-    m_patternCombo->addItem("Rectangles", Rectangles);
-    m_patternCombo->addItem("Lines", Lines);
-    m_patternCombo->addItem("Gaussian Noise", GaussianNoise);
-    m_patternCombo->addItem("Uniform Noise", UniformNoise);
+    m_patternCombo->addItem("Solid Color", PatternGenerator::SolidColor);
+    m_patternCombo->addItem("Gradient (Horizontal)", PatternGenerator::GradientHorizontal);
+    m_patternCombo->addItem("Gradient (Vertical)", PatternGenerator::GradientVertical);
+    m_patternCombo->addItem("Gradient (Diagonal)", PatternGenerator::GradientDiagonal);
+    m_patternCombo->addItem("Checkerboard", PatternGenerator::Checkerboard);
+    m_patternCombo->addItem("Grid", PatternGenerator::Grid);
+    m_patternCombo->addItem("Circles", PatternGenerator::Circles);
+    m_patternCombo->addItem("Rectangles", PatternGenerator::Rectangles);
+    m_patternCombo->addItem("Lines", PatternGenerator::Lines);
+    m_patternCombo->addItem("Gaussian Noise", PatternGenerator::GaussianNoise);
+    m_patternCombo->addItem("Uniform Noise", PatternGenerator::UniformNoise);
     m_patternCombo->setMinimumWidth(150);
     patternLayout->addWidget(m_patternCombo);
     layout->addLayout(patternLayout);
@@ -105,6 +126,43 @@ ImageGeneratorModel::ImageGeneratorModel()
     m_randomCheck = new QCheckBox("Random Colors");
     layout->addWidget(m_randomCheck);
 
+    // Streaming
+    m_streamCheck = new QCheckBox("Stream (animated)");
+    layout->addWidget(m_streamCheck);
+
+    auto* fpsLayout = new QHBoxLayout();
+    fpsLayout->addWidget(new QLabel("FPS:"));
+    m_fpsSpin = new QDoubleSpinBox();
+    m_fpsSpin->setRange(0, 1000);
+    m_fpsSpin->setValue(30);
+    m_fpsSpin->setDecimals(1);
+    m_fpsSpin->setSpecialValueText("Max");
+    m_fpsSpin->setToolTip("Target frame rate (0 = as fast as possible)");
+    m_fpsSpin->setMinimumWidth(80);
+    fpsLayout->addWidget(m_fpsSpin);
+
+    fpsLayout->addWidget(new QLabel("Seed:"));
+    m_seedSpin = new QSpinBox();
+    m_seedSpin->setRange(0, INT_MAX);
+    m_seedSpin->setValue(0);
+    m_seedSpin->setMinimumWidth(80);
+    fpsLayout->addWidget(m_seedSpin);
+    layout->addLayout(fpsLayout);
+
+    auto* bankLayout = new QHBoxLayout();
+    bankLayout->addWidget(new QLabel("Frame Bank:"));
+    m_bankSpin = new QSpinBox();
+    m_bankSpin->setRange(0, 256);
+    m_bankSpin->setValue(0);
+    m_bankSpin->setSpecialValueText("Off");
+    m_bankSpin->setToolTip("Pre-render this many frames (at most 512 MB) and loop them while streaming");
+    m_bankSpin->setMinimumWidth(80);
+    bankLayout->addWidget(m_bankSpin);
+    layout->addLayout(bankLayout);
+
+    m_streamStatusLabel = new QLabel("Static | Seed: 0");
+    layout->addWidget(m_streamStatusLabel);
+
     layout->setContentsMargins(5, 5, 5, 5);
 
     // Connect signals
@@ -122,11 +180,28 @@ ImageGeneratorModel::ImageGeneratorModel()
             this, &ImageGeneratorModel::onParamChanged);
     connect(m_randomCheck, &QCheckBox::stateChanged,
             this, &ImageGeneratorModel::onParamChanged);
+    connect(m_streamCheck, &QCheckBox::toggled,
+            this, &ImageGeneratorModel::onStreamingToggled);
+    connect(m_fpsSpin, QOverload<double>::of(&QDoubleSpinBox::valueChanged),
+            this, &ImageGeneratorModel::onStreamParamChanged);
+    connect(m_seedSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &ImageGeneratorModel::onStreamParamChanged);
+    connect(m_bankSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &ImageGeneratorModel::onStreamParamChanged);
 
     // Generate initial image
     onPatternChanged();
 }
 
+ImageGeneratorModel::~ImageGeneratorModel()
+{
+    m_bankCancel = true;
+    if (m_bankWorker.joinable())
+    {
+        m_bankWorker.join();
+    }
+}
+
 /*******************************************************************************
  * Port Configuration
  ******************************************************************************/
@@ -179,7 +254,7 @@ void ImageGeneratorModel::onPatternChanged()
     // Update labels based on pattern
     switch (m_pattern)
     {
-        case SolidColor:
+        case PatternGenerator::SolidColor:
             m_value1Label->setText("Intensity (0-255):");
             m_value1Spin->setRange(0, 255);
             m_value1Spin->setValue(128);
@@ -188,9 +263,9 @@ void ImageGeneratorModel::onPatternChanged()
             m_randomCheck->setEnabled(true);
             break;
 
-        case GradientHorizontal:
-        case GradientVertical:
-        case GradientDiagonal:
+        case PatternGenerator::GradientHorizontal:
+        case PatternGenerator::GradientVertical:
+        case PatternGenerator::GradientDiagonal:
             m_value1Label->setText("Start Intensity:");
             m_value1Spin->setRange(0, 255);
             m_value1Spin->setValue(0);
@@ -201,7 +276,7 @@ void ImageGeneratorModel::onPatternChanged()
             m_randomCheck->setEnabled(false);
             break;
 
-        case Checkerboard:
+        case PatternGenerator::Checkerboard:
             m_value1Label->setText("Square Size:");
             m_value1Spin->setRange(2, 200);
             m_value1Spin->setValue(32);
@@ -210,7 +285,7 @@ void ImageGeneratorModel::onPatternChanged()
             m_randomCheck->setEnabled(false);
             break;
 
-        case Grid:
+        case PatternGenerator::Grid:
             m_value1Label->setText("Grid Size:");
             m_value1Spin->setRange(10, 200);
             m_value1Spin->setValue(64);
@@ -221,7 +296,7 @@ void ImageGeneratorModel::onPatternChanged()
             m_randomCheck->setEnabled(false);
             break;
 
-        case Circles:
+        case PatternGenerator::Circles:
             m_value1Label->setText("Count:");
             m_value1Spin->setRange(1, 100);
             m_value1Spin->setValue(10);
@@ -232,7 +307,7 @@ void ImageGeneratorModel::onPatternChanged()
             m_randomCheck->setEnabled(true);
             break;
 
-        case Rectangles:
+        case PatternGenerator::Rectangles:
             m_value1Label->setText("Count:");
             m_value1Spin->setRange(1, 100);
             m_value1Spin->setValue(10);
@@ -243,7 +318,7 @@ void ImageGeneratorModel::onPatternChanged()
             m_randomCheck->setEnabled(true);
             break;
 
-        case Lines:
+        case PatternGenerator::Lines:
             m_value1Label->setText("Count:");
             m_value1Spin->setRange(1, 100);
             m_value1Spin->setValue(20);
@@ -254,7 +329,7 @@ void ImageGeneratorModel::onPatternChanged()
             m_randomCheck->setEnabled(true);
             break;
 
-        case GaussianNoise:
+        case PatternGenerator::GaussianNoise:
             m_value1Label->setText("Mean:");
             m_value1Spin->setRange(0, 255);
             m_value1Spin->setValue(128);
@@ -265,7 +340,7 @@ void ImageGeneratorModel::onPatternChanged()
             m_randomCheck->setEnabled(false);
             break;
 
-        case UniformNoise:
+        case PatternGenerator::UniformNoise:
             m_value1Label->setText("Min:");
             m_value1Spin->setRange(0, 254);
             m_value1Spin->setValue(0);
@@ -299,371 +374,208 @@ void ImageGeneratorModel::onParamChanged()
  ******************************************************************************/
 void ImageGeneratorModel::performGenerate()
 {
+    invalidateFrameBank();
+
+    // While streaming the next tick picks up the new parameters
+    if (m_streaming)
+    {
+        return;
+    }
+
     generateImage();
 }
 
 /*******************************************************************************
- * Image Generation
+ * Streaming
  ******************************************************************************/
-void ImageGeneratorModel::generateImage()
+void ImageGeneratorModel::onStreamingToggled(bool enabled)
 {
-    // Start performance timer
-    PerformanceTimer timer(this, caption());
+    m_streaming = enabled;
+    m_frameIndex = 0;
+    invalidateFrameBank();
 
-    cv::Mat image;
-
-    switch (m_pattern)
+    if (m_streaming)
     {
-        case SolidColor:
-            image = generateSolidColor();
-            break;
-        case GradientHorizontal:
-        case GradientVertical:
-        case GradientDiagonal:
-            image = generateGradient();
-            break;
-        case Checkerboard:
-            image = generateCheckerboard();
-            break;
-        case Grid:
-            image = generateGrid();
-            break;
-        case Circles:
-            image = generateCircles();
-            break;
-        case Rectangles:
-            image = generateRectangles();
-            break;
-        case Lines:
-            image = generateLines();
-            break;
-        case GaussianNoise:
-        case UniformNoise:
-            image = generateNoise();
-            break;
+        m_streamClock.start();
+        m_rateClock.start();
+        m_rateFrames = 0;
+        m_measuredFps = 0.0;
+        m_streamTimer->start(streamInterval(m_fps));
     }
+    else
+    {
+        m_streamTimer->stop();
+        m_measuredFps = 0.0;
 
-    m_imageData = std::make_shared<ImageData>(image);
-    Q_EMIT dataUpdated(0);
+        // Fall back to the static (phase 0) image
+        generateImage();
+    }
+
+    updateStreamStatus();
 }
 
-cv::Mat ImageGeneratorModel::generateSolidColor()
+void ImageGeneratorModel::onStreamParamChanged()
 {
-    int type = (m_channels == 1) ? CV_8UC1 : CV_8UC3;
-    cv::Mat image(m_height, m_width, type);
+    m_fps = m_fpsSpin->value();
+    m_seed = m_seedSpin->value();
+    m_bankSize = m_bankSpin->value();
+    invalidateFrameBank();
 
-    if (m_random)
+    if (m_streaming)
     {
-        // Random color
-        cv::Scalar color;
-        if (m_channels == 1)
-        {
-            color = cv::Scalar(QRandomGenerator::global()->bounded(256));
-        }
-        else
-        {
-            color = cv::Scalar(QRandomGenerator::global()->bounded(256),
-                              QRandomGenerator::global()->bounded(256),
-                              QRandomGenerator::global()->bounded(256));
-        }
-        image.setTo(color);
+        m_streamTimer->setInterval(streamInterval(m_fps));
     }
     else
     {
-        cv::Scalar value = (m_channels == 1) ?
-            cv::Scalar(m_value1) :
-            cv::Scalar(m_value1, m_value1, m_value1);
-        image.setTo(value);
+        // The seed also defines the static image
+        m_generateTimer->start();
     }
-
-    return image;
 }
 
-cv::Mat ImageGeneratorModel::generateGradient()
+void ImageGeneratorModel::onStreamTick()
 {
-    int type = (m_channels == 1) ? CV_8UC1 : CV_8UC3;
-    cv::Mat image(m_height, m_width, type);
-
-    double startVal = m_value1;
-    double endVal = m_value2;
+    generateImage();
+    m_frameIndex++;
 
-    for (int y = 0; y < m_height; ++y)
+    // Measured rate over ~0.5 s windows (label updates are not free at high rates)
+    m_rateFrames++;
+    qint64 elapsed = m_rateClock.elapsed();
+    if (elapsed >= 500)
     {
-        for (int x = 0; x < m_width; ++x)
-        {
-            double t = 0.0;
-
-            switch (m_pattern)
-            {
-                case GradientHorizontal:
-                    t = static_cast<double>(x) / (m_width - 1);
-                    break;
-                case GradientVertical:
-                    t = static_cast<double>(y) / (m_height - 1);
-                    break;
-                case GradientDiagonal:
-                    t = (x + y) / (m_width + m_height - 2.0);
-                    break;
-                default:
-                    t = 0.0;
-                    break;
-            }
-
-            double value = startVal + t * (endVal - startVal);
-            value = std::max(0.0, std::min(255.0, value));
-
-            if (m_channels == 1)
-            {
-                image.at<uchar>(y, x) = static_cast<uchar>(value);
-            }
-            else
-            {
-                image.at<cv::Vec3b>(y, x) = cv::Vec3b::all(static_cast<uchar>(value));
-            }
-        }
+        m_measuredFps = m_rateFrames * 1000.0 / elapsed;
+        m_rateFrames = 0;
+        m_rateClock.restart();
+        updateStreamStatus();
     }
-
-    return image;
 }
 
-cv::Mat ImageGeneratorModel::generateCheckerboard()
+void ImageGeneratorModel::updateStreamStatus()
 {
-    int type = (m_channels == 1) ? CV_8UC1 : CV_8UC3;
-    cv::Mat image(m_height, m_width, type);
-    int squareSize = static_cast<int>(m_value1);
-
-    for (int y = 0; y < m_height; ++y)
+    if (!m_streaming)
     {
-        for (int x = 0; x < m_width; ++x)
-        {
-            bool whiteSquare = ((x / squareSize) + (y / squareSize)) % 2 == 0;
-
-            if (m_channels == 1)
-            {
-                image.at<uchar>(y, x) = whiteSquare ? 255 : 0;
-            }
-            else
-            {
-                image.at<cv::Vec3b>(y, x) = whiteSquare ?
-                    cv::Vec3b(255, 255, 255) :
-                    cv::Vec3b(0, 0, 0);
-            }
-        }
+        m_streamStatusLabel->setText(QString("Static | Seed: %1").arg(m_seed));
+        return;
     }
 
-    return image;
-}
-
-cv::Mat ImageGeneratorModel::generateGrid()
-{
-    int type = (m_channels == 1) ? CV_8UC1 : CV_8UC3;
-    cv::Mat image(m_height, m_width, type, cv::Scalar::all(0));
-
-    int gridSize = static_cast<int>(m_value1);
-    int thickness = static_cast<int>(m_value2);
-    cv::Scalar gridColor = (m_channels == 1) ?
-        cv::Scalar(255) :
-        cv::Scalar(255, 255, 255);
-
-    // Draw vertical lines
-    for (int x = gridSize; x < m_width; x += gridSize)
+    QString bank;
+    if (!m_frameBank.isEmpty())
     {
-        cv::line(image, cv::Point(x, 0), cv::Point(x, m_height - 1), gridColor, thickness);
+        bank = QString(" | Bank: %1").arg(m_frameBank.size());
     }
-
-    // Draw horizontal lines
-    for (int y = gridSize; y < m_height; y += gridSize)
+    else if (m_bankSize > 0)
     {
-        cv::line(image, cv::Point(0, y), cv::Point(m_width - 1, y), gridColor, thickness);
+        bank = " | Bank: building";
     }
-
-    return image;
+    m_streamStatusLabel->setText(QString("Frame: %1 | %2 fps%3")
+                                     .arg(m_frameIndex)
+                                     .arg(m_measuredFps, 0, 'f', 1)
+                                     .arg(bank));
 }
 
-cv::Mat ImageGeneratorModel::generateCircles()
+void ImageGeneratorModel::startFrameBank()
 {
-    int type = (m_channels == 1) ? CV_8UC1 : CV_8UC3;
-    cv::Mat image(m_height, m_width, type, cv::Scalar::all(0));
-
-    int count = static_cast<int>(m_value1);
-    int radius = static_cast<int>(m_value2);
-
-    for (int i = 0; i < count; ++i)
+    if (m_bankWorker.joinable())
     {
-        cv::Point center(
-            QRandomGenerator::global()->bounded(m_width),
-            QRandomGenerator::global()->bounded(m_height)
-        );
+        // A cancelled build stops after its current frame
+        m_bankWorker.join();
+    }
 
-        cv::Scalar color;
-        if (m_random)
-        {
-            if (m_channels == 1)
-            {
-                color = cv::Scalar(QRandomGenerator::global()->bounded(256));
-            }
-            else
-            {
-                color = cv::Scalar(QRandomGenerator::global()->bounded(256),
-                                  QRandomGenerator::global()->bounded(256),
-                                  QRandomGenerator::global()->bounded(256));
-            }
-        }
-        else
+    // As many frames as asked for, within the memory budget
+    const PatternGenerator::Params params = patternParams();
+    const qint64 frameBytes = static_cast<qint64>(params.width) * params.height *
+                              (params.channels == 1 ? 1 : 3);
+    const int count = static_cast<int>(std::max<qint64>(
+        1, std::min<qint64>(m_bankSize, kMaxBankBytes / std::max<qint64>(1, frameBytes))));
+    const int generation = m_bankGeneration;
+
+    m_bankCancel = false;
+    m_bankBuilding = true;
+    m_bankWorker = std::thread([this, params, count, generation]()
+    {
+        QVector<cv::Mat> frames;
+        frames.reserve(count);
+        for (int i = 0; i < count && !m_bankCancel; ++i)
         {
-            color = (m_channels == 1) ?
-                cv::Scalar(255) :
-                cv::Scalar(255, 255, 255);
+            frames.append(PatternGenerator::render(params, i));
         }
 
-        int actualRadius = radius;
-        if (m_random)
+        // Hand the frames to the owning thread
+        QMetaObject::invokeMethod(this, [this, generation, frames]()
         {
-            actualRadius = QRandomGenerator::global()->bounded(10, radius + 1);
-        }
-
-        cv::circle(image, center, actualRadius, color, -1);
-    }
-
-    return image;
+            onFrameBankBuilt(generation, frames);
+        }, Qt::QueuedConnection);
+    });
 }
 
-cv::Mat ImageGeneratorModel::generateRectangles()
+void ImageGeneratorModel::invalidateFrameBank()
 {
-    int type = (m_channels == 1) ? CV_8UC1 : CV_8UC3;
-    cv::Mat image(m_height, m_width, type, cv::Scalar::all(0));
-
-    int count = static_cast<int>(m_value1);
-    int maxSize = static_cast<int>(m_value2);
-
-    for (int i = 0; i < count; ++i)
-    {
-        int w = QRandomGenerator::global()->bounded(10, maxSize + 1);
-        int h = QRandomGenerator::global()->bounded(10, maxSize + 1);
-        int x = QRandomGenerator::global()->bounded(m_width - w);
-        int y = QRandomGenerator::global()->bounded(m_height - h);
-
-        cv::Scalar color;
-        if (m_random)
-        {
-            if (m_channels == 1)
-            {
-                color = cv::Scalar(QRandomGenerator::global()->bounded(256));
-            }
-            else
-            {
-                color = cv::Scalar(QRandomGenerator::global()->bounded(256),
-                                  QRandomGenerator::global()->bounded(256),
-                                  QRandomGenerator::global()->bounded(256));
-            }
-        }
-        else
-        {
-            color = (m_channels == 1) ?
-                cv::Scalar(255) :
-                cv::Scalar(255, 255, 255);
-        }
-
-        cv::rectangle(image, cv::Point(x, y), cv::Point(x + w, y + h), color, -1);
-    }
-
-    return image;
+    m_frameBank.clear();
+    m_bankGeneration++;
+    m_bankCancel = true;
+    m_bankBuilding = false;
 }
 
-cv::Mat ImageGeneratorModel::generateLines()
+void ImageGeneratorModel::onFrameBankBuilt(int generation, const QVector<cv::Mat>& frames)
 {
-    int type = (m_channels == 1) ? CV_8UC1 : CV_8UC3;
-    cv::Mat image(m_height, m_width, type, cv::Scalar::all(0));
-
-    int count = static_cast<int>(m_value1);
-    int thickness = static_cast<int>(m_value2);
-
-    for (int i = 0; i < count; ++i)
+    if (generation != m_bankGeneration)
     {
-        cv::Point pt1(QRandomGenerator::global()->bounded(m_width),
-                     QRandomGenerator::global()->bounded(m_height));
-        cv::Point pt2(QRandomGenerator::global()->bounded(m_width),
-                     QRandomGenerator::global()->bounded(m_height));
-
-        cv::Scalar color;
-        if (m_random)
-        {
-            if (m_channels == 1)
-            {
-                color = cv::Scalar(QRandomGenerator::global()->bounded(256));
-            }
-            else
-            {
-                color = cv::Scalar(QRandomGenerator::global()->bounded(256),
-                                  QRandomGenerator::global()->bounded(256),
-                                  QRandomGenerator::global()->bounded(256));
-            }
-        }
-        else
-        {
-            color = (m_channels == 1) ?
-                cv::Scalar(255) :
-                cv::Scalar(255, 255, 255);
-        }
-
-        cv::line(image, pt1, pt2, color, thickness);
+        // Parameters changed while building: drop the stale frames
+        return;
     }
 
-    return image;
+    m_bankBuilding = false;
+    m_frameBank = frames;
+    updateStreamStatus();
 }
 
-cv::Mat ImageGeneratorModel::generateNoise()
+/*******************************************************************************
+ * Image Generation
+ ******************************************************************************/
+void ImageGeneratorModel::generateImage()
 {
-    int type = (m_channels == 1) ? CV_8UC1 : CV_8UC3;
-    cv::Mat image(m_height, m_width, type);
+    // Start performance timer
+    PerformanceTimer timer(this, caption());
 
-    if (m_pattern == GaussianNoise)
+    cv::Mat image;
+    if (m_streaming && m_bankSize > 0 && m_frameBank.isEmpty() && !m_bankBuilding)
     {
-        cv::Mat noise(m_height, m_width, type);
-        double mean = m_value1;
-        double stddev = m_value2;
-
-        cv::randn(noise, cv::Scalar::all(mean), cv::Scalar::all(stddev));
+        startFrameBank();
+    }
 
-        if (m_channels == 1)
-        {
-            for (int y = 0; y < m_height; ++y)
-            {
-                for (int x = 0; x < m_width; ++x)
-                {
-                    double val = noise.at<uchar>(y, x);
-                    val = std::max(0.0, std::min(255.0, val));
-                    image.at<uchar>(y, x) = static_cast<uchar>(val);
-                }
-            }
-        }
-        else
-        {
-            for (int y = 0; y < m_height; ++y)
-            {
-                for (int x = 0; x < m_width; ++x)
-                {
-                    for (int c = 0; c < 3; ++c)
-                    {
-                        double val = noise.at<cv::Vec3b>(y, x)[c];
-                        val = std::max(0.0, std::min(255.0, val));
-                        image.at<cv::Vec3b>(y, x)[c] = static_cast<uchar>(val);
-                    }
-                }
-            }
-        }
+    if (m_streaming && !m_frameBank.isEmpty())
+    {
+        image = m_frameBank[static_cast<int>(m_frameIndex % m_frameBank.size())];
     }
-    else // Uniform noise
+    else
     {
-        double minVal = m_value1;
-        double maxVal = m_value2;
+        image = PatternGenerator::render(patternParams(), m_streaming ? m_frameIndex : 0);
+    }
 
-        cv::Mat noise(m_height, m_width, type);
-        cv::randu(noise, cv::Scalar::all(minVal), cv::Scalar::all(maxVal));
-        noise.convertTo(image, CV_8U);
+    auto imageData = std::make_shared<ImageData>(image);
+    if (m_streaming)
+    {
+        imageData->setFrameIndex(m_frameIndex);
+        // Nominal stream time at a fixed rate, wall-clock time otherwise
+        imageData->setTimestampMs(m_fps > 0.0 ? m_frameIndex * 1000.0 / m_fps
+                                              : static_cast<double>(m_streamClock.elapsed()));
     }
 
-    return image;
+    m_imageData = imageData;
+    Q_EMIT dataUpdated(0);
+}
+
+PatternGenerator::Params ImageGeneratorModel::patternParams() const
+{
+    PatternGenerator::Params params;
+    params.pattern = m_pattern;
+    params.width = m_width;
+    params.height = m_height;
+    params.channels = m_channels;
+    params.value1 = m_value1;
+    params.value2 = m_value2;
+    params.random = m_random;
+    params.seed = m_seed;
+    return params;
 }
 
 /*******************************************************************************
@@ -679,6 +591,10 @@ QJsonObject ImageGeneratorModel::save() const
     modelJson["value1"] = m_value1;
     modelJson["value2"] = m_value2;
     modelJson["random"] = m_random;
+    modelJson["streaming"] = m_streaming;
+    modelJson["fps"] = m_fps;
+    modelJson["seed"] = m_seed;
+    modelJson["bankSize"] = m_bankSize;
     return modelJson;
 }
 
@@ -779,7 +695,45 @@ void ImageGeneratorModel::load(QJsonObject const& model)
         std::fflush(stderr);
     }
 
+    // Streaming parameters (applied before streaming is restored)
+    QJsonValue fpsJson = model["fps"];
+    if (!fpsJson.isUndefined())
+    {
+        m_fps = fpsJson.toDouble();
+        m_fpsSpin->blockSignals(true);
+        m_fpsSpin->setValue(m_fps);
+        m_fpsSpin->blockSignals(false);
+    }
+
+    QJsonValue seedJson = model["seed"];
+    if (!seedJson.isUndefined())
+    {
+        m_seed = seedJson.toInt();
+        m_seedSpin->blockSignals(true);
+        m_seedSpin->setValue(m_seed);
+        m_seedSpin->blockSignals(false);
+    }
+
+    QJsonValue bankJson = model["bankSize"];
+    if (!bankJson.isUndefined())
+    {
+        m_bankSize = bankJson.toInt();
+        m_bankSpin->blockSignals(true);
+        m_bankSpin->setValue(m_bankSize);
+        m_bankSpin->blockSignals(false);
+    }
+
+    QJsonValue streamingJson = model["streaming"];
+    if (!streamingJson.isUndefined() && streamingJson.toBool() != m_streaming)
+    {
+        // Starts (or stops) the stream timer through onStreamingToggled
+        m_streamCheck->setChecked(streamingJson.toBool());
+    }
+
+    updateStreamStatus();
+
     std::fflush(stderr);
+    invalidateFrameBank();
     generateImage();
 
     // Emit signal to trigger downstream nodes
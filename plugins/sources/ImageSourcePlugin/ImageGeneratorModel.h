@@ -6,6 +6,7 @@
 #ifndef VISIONBOX_IMAGEGENERATORMODEL_H
 #define VISIONBOX_IMAGEGENERATORMODEL_H
 
+#include "core/PatternGenerator.h"
 #include <QtNodes/NodeDelegateModel>
 #include <QtNodes/NodeData>
 #include <QObject>
@@ -18,7 +19,11 @@
 #include <QDoubleSpinBox>
 #include <QCheckBox>
 #include <QTimer>
+#include <QElapsedTimer>
+#include <QVector>
 #include <opencv2/opencv.hpp>
+#include <atomic>
+#include <thread>
 
 namespace VisionBox {
 
@@ -26,6 +31,13 @@ class ImageData;
 
 /*******************************************************************************
  * ImageGeneratorModel - Generates test patterns and synthetic images
+ *
+ * In streaming mode the node emits an animated sequence at a fixed rate
+ * (or as fast as the event loop allows). Every frame is a pure function of
+ * (parameters, seed, frame index), so runs are reproducible. An optional
+ * frame bank pre-renders a loop of frames to take generation cost out of
+ * pipeline benchmarks; it is built on a worker thread (frames are rendered
+ * live until it is ready) and capped by memory, not just frame count.
  ******************************************************************************/
 class ImageGeneratorModel : public QtNodes::NodeDelegateModel
 {
@@ -33,7 +45,7 @@ class ImageGeneratorModel : public QtNodes::NodeDelegateModel
 
 public:
     ImageGeneratorModel();
-    ~ImageGeneratorModel() override = default;
+    ~ImageGeneratorModel() override;   // Waits for a running bank build
 
     // Node identification
     QString caption() const override { return "Image Generator"; }
@@ -60,36 +72,23 @@ private slots:
     void onPatternChanged();
     void onParamChanged();
     void performGenerate();  // Debounced image generation
+    void onStreamingToggled(bool enabled);
+    void onStreamParamChanged();
+    void onStreamTick();
 
 private:
     void generateImage();
-    cv::Mat generateSolidColor();
-    cv::Mat generateGradient();
-    cv::Mat generateCheckerboard();
-    cv::Mat generateGrid();
-    cv::Mat generateCircles();
-    cv::Mat generateRectangles();
-    cv::Mat generateNoise();
-    cv::Mat generateLines();
+    PatternGenerator::Params patternParams() const;
+    void startFrameBank();
+    void invalidateFrameBank();
+    void onFrameBankBuilt(int generation, const QVector<cv::Mat>& frames);
+    void updateStreamStatus();
 
 private:
-    enum PatternType
-    {
-        SolidColor = 0,
-        GradientHorizontal,
-        GradientVertical,
-        GradientDiagonal,
-        Checkerboard,
-        Grid,
-        Circles,
-        Rectangles,
-        Lines,
-        GaussianNoise,
-        UniformNoise
-    };
+    using PatternType = PatternGenerator::Pattern;
 
     // Parameters
-    PatternType m_pattern = SolidColor;
+    PatternType m_pattern = PatternGenerator::SolidColor;
     int m_width = 640;
     int m_height = 480;
     int m_channels = 3;  // 1 = grayscale, 3 = BGR
@@ -97,6 +96,23 @@ private:
     double m_value2 = 30.0;   // For noise std, checkerboard size, etc.
     bool m_random = false;    // Random colors
 
+    // Streaming
+    bool m_streaming = false;     // Emit an animated frame sequence
+    double m_fps = 30.0;          // Target rate (0 = as fast as possible)
+    int m_seed = 0;               // Seed for all random content
+    int m_bankSize = 0;           // Pre-rendered frames to loop (0 = off)
+    qint64 m_frameIndex = 0;      // Index of the frame being generated
+    QVector<cv::Mat> m_frameBank; // Pre-rendered frames (empty when stale)
+    std::thread m_bankWorker;     // Renders the frame bank
+    std::atomic<bool> m_bankCancel{false};
+    int m_bankGeneration = 0;     // Bumped when the bank goes stale
+    bool m_bankBuilding = false;
+    QTimer* m_streamTimer = nullptr;
+    QElapsedTimer m_streamClock;  // Time since streaming started
+    QElapsedTimer m_rateClock;    // Window for the measured frame rate
+    int m_rateFrames = 0;
+    double m_measuredFps = 0.0;
+
     // Data
     std::shared_ptr<ImageData> m_imageData;
 
@@ -114,6 +130,11 @@ private:
     QCheckBox* m_randomCheck = nullptr;
     QLabel* m_value1Label = nullptr;
     QLabel* m_value2Label = nullptr;
+    QCheckBox* m_streamCheck = nullptr;
+    QDoubleSpinBox* m_fpsSpin = nullptr;
+    QSpinBox* m_seedSpin = nullptr;
+    QSpinBox* m_bankSpin = nullptr;
+    QLabel* m_streamStatusLabel = nullptr;
 };
 
 } // namespace VisionBox
@@ -5,6 +5,7 @@
 
 #include "ImageLoaderModel.h"
 #include "core/VisionDataTypes.h"
+#include "core/ImageCache.h"
 #include <opencv2/opencv.hpp>
 
 namespace VisionBox {
@@ -84,7 +85,7 @@ void ImageLoaderModel::onBrowseClicked()
         nullptr,
         "Open Image",
         "",
-        "Image Files (*.png *.jpg *.jpeg *.bmp *.tif *.tiff *.webp);;All Files (*.*)"
+        "Image Files (*.png *.jpg *.jpeg *.bmp *.tif *.tiff *.webp *.vbf);;All Files (*.*)"
     );
 
     if (!filePath.isEmpty())
@@ -97,8 +98,8 @@ void ImageLoaderModel::loadImage(const QString& filePath)
 {
     m_filePath = filePath;
 
-    // Load image using OpenCV
-    cv::Mat image = cv::imread(filePath.toStdString());
+    // Load image through the shared cache (decoded once per file version)
+    cv::Mat image = ImageCache::instance()->imread(filePath, cv::IMREAD_COLOR);
     if (image.empty())
     {
         m_pathLabel->setText("Failed to load: " + filePath);
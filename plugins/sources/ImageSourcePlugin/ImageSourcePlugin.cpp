@@ -8,6 +8,8 @@
 #include "VideoLoaderModel.h"
 #include "CameraSourceModel.h"
 #include "ImageGeneratorModel.h"
+#include "RawFrameSourceModel.h"
+#include "DetectionLogSourceModel.h"
 
 namespace VisionBox {
 
@@ -29,6 +31,12 @@ std::vector<std::unique_ptr<::QtNodes::NodeDelegateModel>> ImageSourcePlugin::cr
 
     // Add ImageGeneratorModel (Phase 13)
     models.push_back(std::unique_ptr<ImageGeneratorModel>(new ImageGeneratorModel()));
+
+    // Add RawFrameSourceModel (memory-mapped raw / NPY recordings)
+    models.push_back(std::unique_ptr<RawFrameSourceModel>(new RawFrameSourceModel()));
+
+    // Add DetectionLogSourceModel (memory-mapped binary detection logs)
+    models.push_back(std::unique_ptr<DetectionLogSourceModel>(new DetectionLogSourceModel()));
     return std::move(models);
 }
 
@@ -0,0 +1,462 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Raw Frame Source Node Model Implementation
+ ******************************************************************************/
+
+#include "RawFrameSourceModel.h"
+#include "core/RawFrameFormat.h"
+#include "core/VisionDataTypes.h"
+#include <QFile>
+#include <QTimer>
+#include <QJsonObject>
+
+namespace VisionBox {
+
+/*******************************************************************************
+ * MappedFrameFile - Open file, mapping and frame layout
+ ******************************************************************************/
+struct MappedFrameFile : RawFrameLayout
+{
+    QFile file;                 // Must stay open while mapped
+    uchar* base = nullptr;      // Start of the mapping
+    qint64 size = 0;            // Mapped bytes
+
+    ~MappedFrameFile()
+    {
+        if (base)
+        {
+            file.unmap(base);
+        }
+    }
+};
+
+namespace {
+
+/*******************************************************************************
+ * Allocator tying each frame's lifetime to its mapping
+ *
+ * Frames reference a shared_ptr<MappedFrameFile> through UMatData::userdata,
+ * so the mapping outlives the node if a downstream node still holds a frame.
+ * Reallocation (e.g. create() with another size) falls back to the standard
+ * allocator.
+ ******************************************************************************/
+class MappedFrameAllocator : public cv::MatAllocator
+{
+public:
+    cv::UMatData* allocate(int dims, const int* sizes, int type, void* data,
+                           size_t* step, cv::AccessFlag flags,
+                           cv::UMatUsageFlags usageFlags) const override
+    {
+        return cv::Mat::getStdAllocator()->allocate(dims, sizes, type, data, step,
+                                                    flags, usageFlags);
+    }
+
+    bool allocate(cv::UMatData* data, cv::AccessFlag accessFlags,
+                  cv::UMatUsageFlags usageFlags) const override
+    {
+        return cv::Mat::getStdAllocator()->allocate(data, accessFlags, usageFlags);
+    }
+
+    void deallocate(cv::UMatData* u) const override
+    {
+        if (!u)
+        {
+            return;
+        }
+        delete static_cast<std::shared_ptr<MappedFrameFile>*>(u->userdata);
+        u->userdata = nullptr;
+        delete u;
+    }
+};
+
+MappedFrameAllocator* mappedFrameAllocator()
+{
+    static MappedFrameAllocator allocator;
+    return &allocator;
+}
+
+} // namespace
+
+/*******************************************************************************
+ * Constructor / Destructor
+ ******************************************************************************/
+RawFrameSourceModel::RawFrameSourceModel()
+    : m_imageData(nullptr)
+{
+    // Create playback timer
+    m_playbackTimer = new QTimer(this);
+    m_playbackTimer->setInterval(33); // ~30 FPS default
+    connect(m_playbackTimer, &QTimer::timeout,
+            this, &RawFrameSourceModel::updateFrame);
+
+    // Create embedded widget
+    m_widget = new QWidget();
+    auto* layout = new QVBoxLayout(m_widget);
+
+    // File path label
+    m_pathLabel = new QLabel("No recording loaded");
+    m_pathLabel->setWordWrap(true);
+    m_pathLabel->setStyleSheet("QLabel { padding: 5px; }");
+
+    // Browse button
+    m_browseButton = new QPushButton("Browse...");
+    m_browseButton->setStyleSheet("QPushButton { padding: 5px; }");
+
+    // Layout info
+    m_formatLabel = new QLabel("Format: -");
+    m_formatLabel->setStyleSheet("QLabel { padding: 5px; }");
+
+    m_frameLabel = new QLabel("Frame: 0 / 0");
+    m_frameLabel->setStyleSheet("QLabel { padding: 5px; }");
+
+    // Playback controls
+    auto* controlLayout = new QHBoxLayout();
+
+    m_playPauseButton = new QPushButton("Play");
+    m_playPauseButton->setEnabled(false);
+    m_playPauseButton->setStyleSheet("QPushButton { padding: 5px; }");
+
+    m_frameSlider = new QSlider(Qt::Horizontal);
+    m_frameSlider->setEnabled(false);
+    m_frameSlider->setRange(0, 0);
+
+    m_frameSpin = new QSpinBox();
+    m_frameSpin->setEnabled(false);
+    m_frameSpin->setRange(0, 0);
+    m_frameSpin->setMinimumWidth(80);
+
+    controlLayout->addWidget(m_playPauseButton);
+    controlLayout->addWidget(m_frameSlider);
+    controlLayout->addWidget(m_frameSpin);
+
+    // Playback rate
+    auto* fpsLayout = new QHBoxLayout();
+    fpsLayout->addWidget(new QLabel("FPS:"));
+    m_fpsSpin = new QDoubleSpinBox();
+    m_fpsSpin->setRange(1.0, 1000.0);
+    m_fpsSpin->setValue(m_fps);
+    m_fpsSpin->setDecimals(1);
+    fpsLayout->addWidget(m_fpsSpin);
+
+    layout->addWidget(m_pathLabel);
+    layout->addWidget(m_browseButton);
+    layout->addWidget(m_formatLabel);
+    layout->addWidget(m_frameLabel);
+    layout->addLayout(controlLayout);
+    layout->addLayout(fpsLayout);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    // Connect signals
+    connect(m_browseButton, &QPushButton::clicked,
+            this, &RawFrameSourceModel::onBrowseClicked);
+    connect(m_playPauseButton, &QPushButton::clicked,
+            this, &RawFrameSourceModel::onPlayPauseClicked);
+    connect(m_frameSlider, &QSlider::valueChanged,
+            this, &RawFrameSourceModel::onFrameChanged);
+    connect(m_frameSpin, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &RawFrameSourceModel::onFrameChanged);
+    connect(m_fpsSpin, QOverload<double>::of(&QDoubleSpinBox::valueChanged),
+            this, &RawFrameSourceModel::onFpsChanged);
+}
+
+RawFrameSourceModel::~RawFrameSourceModel()
+{
+    closeFile();
+}
+
+/*******************************************************************************
+ * Port Configuration
+ ******************************************************************************/
+unsigned int RawFrameSourceModel::nPorts(QtNodes::PortType portType) const
+{
+    if (portType == QtNodes::PortType::In)
+    {
+        return 0; // No input ports
+    }
+    else
+    {
+        return 1; // One output port for the current frame
+    }
+}
+
+QtNodes::NodeDataType RawFrameSourceModel::dataType(
+    QtNodes::PortType portType,
+    QtNodes::PortIndex portIndex) const
+{
+    Q_UNUSED(portType);
+    Q_UNUSED(portIndex);
+    return ImageData().type(); // "opencv_image"
+}
+
+/*******************************************************************************
+ * Data Flow
+ ******************************************************************************/
+std::shared_ptr<QtNodes::NodeData> RawFrameSourceModel::outData(QtNodes::PortIndex port)
+{
+    Q_UNUSED(port);
+    return m_imageData;
+}
+
+/*******************************************************************************
+ * Widget
+ ******************************************************************************/
+QWidget* RawFrameSourceModel::embeddedWidget()
+{
+    return m_widget;
+}
+
+/*******************************************************************************
+ * Slots
+ ******************************************************************************/
+void RawFrameSourceModel::onBrowseClicked()
+{
+    QString filePath = QFileDialog::getOpenFileName(
+        nullptr,
+        "Open Raw Recording",
+        "",
+        "Raw Frames (*.npy *.raw *.bin);;All Files (*.*)"
+    );
+
+    if (!filePath.isEmpty())
+    {
+        openFile(filePath);
+    }
+}
+
+void RawFrameSourceModel::onPlayPauseClicked()
+{
+    if (!m_file)
+    {
+        return;
+    }
+
+    m_isPlaying = !m_isPlaying;
+
+    if (m_isPlaying)
+    {
+        m_playPauseButton->setText("Pause");
+        m_playbackTimer->setInterval(static_cast<int>(1000.0 / m_fps));
+        m_playbackTimer->start();
+    }
+    else
+    {
+        m_playPauseButton->setText("Play");
+        m_playbackTimer->stop();
+    }
+}
+
+void RawFrameSourceModel::onFrameChanged(int frame)
+{
+    showFrame(frame);
+}
+
+void RawFrameSourceModel::onFpsChanged(double fps)
+{
+    m_fps = fps;
+    m_playbackTimer->setInterval(static_cast<int>(1000.0 / m_fps));
+}
+
+void RawFrameSourceModel::updateFrame()
+{
+    if (!m_file)
+    {
+        return;
+    }
+
+    // Loop back to the first frame at the end of the recording
+    int next = m_currentFrame + 1;
+    if (next >= m_totalFrames)
+    {
+        next = 0;
+    }
+    showFrame(next);
+}
+
+/*******************************************************************************
+ * File Operations
+ ******************************************************************************/
+void RawFrameSourceModel::openFile(const QString& filePath)
+{
+    closeFile();
+    m_filePath = filePath;
+
+    auto file = std::make_shared<MappedFrameFile>();
+    file->file.setFileName(filePath);
+
+    QString error;
+    if (!file->file.open(QIODevice::ReadOnly))
+    {
+        error = file->file.errorString();
+    }
+    else
+    {
+        file->size = file->file.size();
+        // Private (copy-on-write) mapping: in-place edits downstream never touch the file
+        file->base = file->size > 0
+                         ? file->file.map(0, file->size, QFileDevice::MapPrivateOption)
+                         : nullptr;
+        if (!file->base)
+        {
+            error = "Failed to map file";
+        }
+        else if (filePath.endsWith(".npy", Qt::CaseInsensitive))
+        {
+            RawFrameFormat::parseNpyHeader(file->base, file->size, *file, error);
+        }
+        else
+        {
+            const QJsonObject sidecar = RawFrameFormat::readSidecar(filePath);
+            if (sidecar.isEmpty())
+            {
+                error = "Missing sidecar (" + QFileInfo(filePath).fileName() + ".json)";
+            }
+            else
+            {
+                RawFrameFormat::parseRawSidecar(sidecar, file->size, *file, error);
+            }
+        }
+
+        if (error.isEmpty() && file->frameCount <= 0)
+        {
+            error = "File holds no complete frame";
+        }
+    }
+
+    if (!error.isEmpty())
+    {
+        m_pathLabel->setText("Failed to load: " + QFileInfo(filePath).fileName() + " (" + error + ")");
+        m_formatLabel->setText("Format: -");
+        m_playPauseButton->setEnabled(false);
+        m_frameSlider->setEnabled(false);
+        m_frameSpin->setEnabled(false);
+        updateUI();
+        Q_EMIT dataUpdated(0);
+        return;
+    }
+
+    m_file = file;
+    m_totalFrames = m_file->frameCount;
+
+    m_pathLabel->setText("Loaded: " + QFileInfo(filePath).fileName());
+    m_formatLabel->setText(QString("Format: %1 %2x%3 %4")
+                               .arg(m_file->formatName)
+                               .arg(m_file->width)
+                               .arg(m_file->height)
+                               .arg(RawFrameFormat::typeName(m_file->type)));
+
+    m_playPauseButton->setEnabled(true);
+    m_playPauseButton->setText("Play");
+
+    m_frameSlider->blockSignals(true);
+    m_frameSpin->blockSignals(true);
+    m_frameSlider->setEnabled(true);
+    m_frameSlider->setRange(0, m_totalFrames - 1);
+    m_frameSpin->setEnabled(true);
+    m_frameSpin->setRange(0, m_totalFrames - 1);
+    m_frameSlider->blockSignals(false);
+    m_frameSpin->blockSignals(false);
+
+    showFrame(0);
+}
+
+void RawFrameSourceModel::closeFile()
+{
+    m_playbackTimer->stop();
+    m_isPlaying = false;
+
+    // Frames still held downstream keep the mapping alive on their own
+    m_file.reset();
+    m_imageData = nullptr;
+    m_totalFrames = 0;
+    m_currentFrame = 0;
+}
+
+void RawFrameSourceModel::showFrame(int frameIndex)
+{
+    if (!m_file)
+    {
+        return;
+    }
+
+    frameIndex = qBound(0, frameIndex, m_totalFrames - 1);
+
+    uchar* data = m_file->base + m_file->headerBytes + frameIndex * m_file->frameBytes;
+    const size_t rowBytes = static_cast<size_t>(m_file->width) * CV_ELEM_SIZE(m_file->type);
+
+    // Zero-copy view; the UMatData keeps the mapping referenced
+    cv::Mat frame(m_file->height, m_file->width, m_file->type, data, rowBytes);
+
+    MappedFrameAllocator* allocator = mappedFrameAllocator();
+    auto* u = new cv::UMatData(allocator);
+    u->data = u->origdata = data;
+    u->size = rowBytes * m_file->height;
+    u->refcount = 1;
+    u->flags = cv::UMatData::USER_ALLOCATED;
+    u->userdata = new std::shared_ptr<MappedFrameFile>(m_file);
+    frame.u = u;
+    frame.allocator = allocator;
+
+    m_currentFrame = frameIndex;
+    m_imageData = std::make_shared<ImageData>(frame);
+    m_imageData->setFrameIndex(frameIndex);
+    m_imageData->setTimestampMs(frameIndex * 1000.0 / m_fps);
+    updateUI();
+    Q_EMIT dataUpdated(0);
+}
+
+void RawFrameSourceModel::updateUI()
+{
+    m_frameLabel->setText(QString("Frame: %1 / %2")
+                              .arg(m_totalFrames > 0 ? m_currentFrame + 1 : 0)
+                              .arg(m_totalFrames));
+
+    // Block signals to prevent feedback loop
+    m_frameSlider->blockSignals(true);
+    m_frameSpin->blockSignals(true);
+
+    m_frameSlider->setValue(m_currentFrame);
+    m_frameSpin->setValue(m_currentFrame);
+
+    m_frameSlider->blockSignals(false);
+    m_frameSpin->blockSignals(false);
+}
+
+/*******************************************************************************
+ * Serialization
+ ******************************************************************************/
+QJsonObject RawFrameSourceModel::save() const
+{
+    QJsonObject modelJson;
+    modelJson["filePath"] = m_filePath;
+    modelJson["currentFrame"] = m_currentFrame;
+    modelJson["fps"] = m_fps;
+    return modelJson;
+}
+
+void RawFrameSourceModel::load(QJsonObject const& model)
+{
+    QJsonValue fpsJson = model["fps"];
+    if (!fpsJson.isUndefined())
+    {
+        m_fpsSpin->setValue(fpsJson.toDouble(30.0));
+    }
+
+    QJsonValue filePathJson = model["filePath"];
+    if (!filePathJson.isUndefined())
+    {
+        QString filePath = filePathJson.toString();
+        if (!filePath.isEmpty() && QFile::exists(filePath))
+        {
+            openFile(filePath);
+
+            // Restore frame position
+            QJsonValue frameJson = model["currentFrame"];
+            if (!frameJson.isUndefined())
+            {
+                showFrame(frameJson.toInt());
+            }
+        }
+    }
+}
+
+} // namespace VisionBox
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Raw Frame Source Node Model (memory-mapped raw / NPY recordings)
+ ******************************************************************************/
+
+#ifndef VISIONBOX_RAWFRAMESOURCEMODEL_H
+#define VISIONBOX_RAWFRAMESOURCEMODEL_H
+
+#include <QtNodes/NodeDelegateModel>
+#include <QtNodes/NodeData>
+#include <QObject>
+#include <QString>
+#include <QFileDialog>
+#include <QPushButton>
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QSlider>
+#include <QSpinBox>
+#include <QDoubleSpinBox>
+#include <QFileInfo>
+#include <opencv2/core.hpp>
+#include <memory>
+
+namespace VisionBox {
+
+class ImageData;
+struct MappedFrameFile;
+
+/*******************************************************************************
+ * RawFrameSourceModel - Streams frames straight out of a memory-mapped file
+ *
+ * Supported inputs:
+ *   - NumPy .npy arrays shaped (H, W), (H, W, C), (N, H, W) or (N, H, W, C)
+ *   - Raw dumps described by a JSON sidecar (<file>.json or <basename>.json):
+ *     { "width", "height", "channels", "dtype", "headerBytes", "frameBytes",
+ *       "frameCount" }
+ *
+ * Frames are cv::Mat views into the mapping (no copy, no decode). The
+ * mapping is copy-on-write and stays alive as long as any emitted frame
+ * still references it.
+ ******************************************************************************/
+class RawFrameSourceModel : public QtNodes::NodeDelegateModel
+{
+    Q_OBJECT
+
+public:
+    RawFrameSourceModel();
+    ~RawFrameSourceModel() override;
+
+    // Node identification
+    QString caption() const override { return "Raw Frame Source"; }
+    QString name() const override { return "RawFrameSourceModel"; }
+
+    // Port configuration
+    unsigned int nPorts(QtNodes::PortType portType) const override;
+    QtNodes::NodeDataType dataType(QtNodes::PortType portType,
+                                   QtNodes::PortIndex portIndex) const override;
+
+    // Data flow
+    std::shared_ptr<QtNodes::NodeData> outData(QtNodes::PortIndex port) override;
+    void setInData(std::shared_ptr<QtNodes::NodeData> data,
+                   QtNodes::PortIndex portIndex) override {}
+
+    // Widget
+    QWidget* embeddedWidget() override;
+
+    // Serialization
+    QJsonObject save() const override;
+    void load(QJsonObject const& model) override;
+
+private slots:
+    void onBrowseClicked();
+    void onPlayPauseClicked();
+    void onFrameChanged(int frame);
+    void onFpsChanged(double fps);
+    void updateFrame();
+
+private:
+    void openFile(const QString& filePath);
+    void closeFile();
+    void showFrame(int frameIndex);
+    void updateUI();
+
+private:
+    // Mapping
+    std::shared_ptr<MappedFrameFile> m_file;
+    QString m_filePath;
+    int m_currentFrame = 0;
+    int m_totalFrames = 0;
+    double m_fps = 30.0;
+
+    // Playback control
+    bool m_isPlaying = false;
+    QTimer* m_playbackTimer = nullptr;
+
+    // Data
+    std::shared_ptr<ImageData> m_imageData;
+
+    // UI
+    QWidget* m_widget = nullptr;
+    QLabel* m_pathLabel = nullptr;
+    QLabel* m_formatLabel = nullptr;
+    QLabel* m_frameLabel = nullptr;
+    QPushButton* m_browseButton = nullptr;
+    QPushButton* m_playPauseButton = nullptr;
+    QSlider* m_frameSlider = nullptr;
+    QSpinBox* m_frameSpin = nullptr;
+    QDoubleSpinBox* m_fpsSpin = nullptr;
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_RAWFRAMESOURCEMODEL_H
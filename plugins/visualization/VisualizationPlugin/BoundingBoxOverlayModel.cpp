@@ -127,7 +127,7 @@ unsigned int BoundingBoxOverlayModel::nPorts(QtNodes::PortType portType) const
 {
     if (portType == QtNodes::PortType::In)
     {
-        return 1; // One input image
+        return 2; // Input image, detections
     }
     else
     {
@@ -139,8 +139,10 @@ QtNodes::NodeDataType BoundingBoxOverlayModel::dataType(
     QtNodes::PortType portType,
     QtNodes::PortIndex portIndex) const
 {
-    Q_UNUSED(portType);
-    Q_UNUSED(portIndex);
+    if (portType == QtNodes::PortType::In && portIndex == 1)
+    {
+        return DetectionData().type();
+    }
     return ImageData().type();
 }
 
@@ -156,8 +158,31 @@ std::shared_ptr<QtNodes::NodeData> BoundingBoxOverlayModel::outData(QtNodes::Por
 void BoundingBoxOverlayModel::setInData(std::shared_ptr<QtNodes::NodeData> data,
                                        QtNodes::PortIndex portIndex)
 {
-    Q_UNUSED(portIndex);
-    m_inputImage = std::dynamic_pointer_cast<ImageData>(data);
+    if (portIndex == 1)
+    {
+        m_inputDetections = std::dynamic_pointer_cast<DetectionData>(data);
+        m_detectionsPending = static_cast<bool>(m_inputDetections);
+        if (!m_inputDetections)
+        {
+            // Disconnected: the last boxes no longer describe anything
+            m_boxes.clear();
+        }
+    }
+    else
+    {
+        m_inputImage = std::dynamic_pointer_cast<ImageData>(data);
+        m_imagePending = true;
+    }
+
+    // With detections connected, draw once both inputs of a frame are in,
+    // in whichever order they arrive, so a frame never gets the boxes of
+    // the frame before it
+    if (m_inputDetections && !(m_imagePending && m_detectionsPending))
+    {
+        return;
+    }
+    m_imagePending = false;
+    m_detectionsPending = false;
 
     if (m_inputImage && !m_inputImage->image().empty())
     {
@@ -292,6 +317,11 @@ void BoundingBoxOverlayModel::processAndDraw()
         m_outputImage = image.clone();
     }
 
+    if (m_inputDetections)
+    {
+        updateBoxesFromDetections(m_outputImage.cols, m_outputImage.rows);
+    }
+
     // Draw all bounding boxes
     for (const auto& box : m_boxes)
     {
@@ -410,6 +440,31 @@ void BoundingBoxOverlayModel::processAndDraw()
     updateInfoText();
 }
 
+void BoundingBoxOverlayModel::updateBoxesFromDetections(int imageWidth, int imageHeight)
+{
+    m_boxes.clear();
+
+    // Detection boxes are normalized; labels get a color index on first sight
+    for (const auto& det : m_inputDetections->detections())
+    {
+        auto it = m_labelClassIds.find(det.label);
+        if (it == m_labelClassIds.end())
+        {
+            it = m_labelClassIds.insert(det.label, m_labelClassIds.size());
+        }
+
+        BoundingBox box;
+        box.x = cvRound(det.bbox.x() * imageWidth);
+        box.y = cvRound(det.bbox.y() * imageHeight);
+        box.width = cvRound(det.bbox.width() * imageWidth);
+        box.height = cvRound(det.bbox.height() * imageHeight);
+        box.classId = it.value();
+        box.confidence = det.confidence;
+        box.label = det.label.toStdString();
+        m_boxes.push_back(box);
+    }
+}
+
 cv::Scalar BoundingBoxOverlayModel::getColorForClass(int classId)
 {
     if (m_colorMode == 1)
@@ -19,11 +19,13 @@
 #include <QPushButton>
 #include <QTextEdit>
 #include <QJsonArray>
+#include <QHash>
 #include <opencv2/opencv.hpp>
 
 namespace VisionBox {
 
 class ImageData;
+class DetectionData;
 
 /*******************************************************************************
  * BoundingBoxOverlayModel - Draw bounding boxes and labels on images
@@ -74,6 +76,7 @@ private:
     };
 
     void processAndDraw();
+    void updateBoxesFromDetections(int imageWidth, int imageHeight);
     cv::Scalar getColorForClass(int classId);
     void updateInfoText();
 
@@ -90,12 +93,16 @@ private:
     cv::Scalar m_fixedColor = cv::Scalar(0, 255, 0);  // Green (BGR)
     std::vector<cv::Scalar> m_classColors;
 
-    // Detection results (from CSV/JSON input or manual)
+    // Detection results (from the detections port, CSV/JSON input or manual)
     std::vector<BoundingBox> m_boxes;
+    QHash<QString, int> m_labelClassIds;   // Stable color index per label
 
     // Data
     std::shared_ptr<ImageData> m_inputImage;
     std::shared_ptr<ImageData> m_maskImage;
+    std::shared_ptr<DetectionData> m_inputDetections;
+    bool m_imagePending = false;         // Received since the last draw
+    bool m_detectionsPending = false;
     cv::Mat m_outputImage;
 
     // UI
@@ -0,0 +1,254 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Blob Preprocessor Implementation
+ ******************************************************************************/
+
+#include "BlobPreprocessor.h"
+#include <opencv2/imgproc.hpp>
+#include <QMutexLocker>
+#include <algorithm>
+#include <cmath>
+
+namespace VisionBox {
+
+namespace {
+
+// Source pixels and weight for output index i, step = source pixels per
+// output pixel (pixel-center aligned, like cv::resize INTER_LINEAR)
+void samplePosition(int i, float step, int size, int& i0, int& i1, float& weight)
+{
+    const float pos = (i + 0.5f) * step - 0.5f;
+    i0 = static_cast<int>(std::floor(pos));
+    weight = pos - i0;
+    if (i0 < 0)
+    {
+        i0 = 0;
+        weight = 0.0f;
+    }
+    if (i0 >= size - 1)
+    {
+        i0 = size - 1;
+        weight = 0.0f;
+    }
+    i1 = std::min(i0 + 1, size - 1);
+}
+
+// Bilinear sample + normalize + HWC -> CHW, one pass over the content area
+template <typename T>
+void fillPlanes(const cv::Mat& src, const LetterboxTransform& t,
+                const BlobPreprocessor::Params& params, float* const planes[3])
+{
+    const int width = t.inputSize.width;
+    const int height = t.inputSize.height;
+    const cv::Rect& content = t.content;
+    const float scale = static_cast<float>(params.scale);
+
+    int srcChannel[3];
+    float mean[3];
+    float padValue[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        srcChannel[c] = params.swapRB ? 2 - c : c;
+        mean[c] = static_cast<float>(params.mean[c]);
+        padValue[c] = (static_cast<float>(params.padColor[srcChannel[c]]) - mean[c]) * scale;
+    }
+
+    // Padding bands around the content
+    for (int c = 0; c < 3; ++c)
+    {
+        float* plane = planes[c];
+        std::fill(plane, plane + static_cast<size_t>(content.y) * width, padValue[c]);
+        std::fill(plane + static_cast<size_t>(content.y + content.height) * width,
+                  plane + static_cast<size_t>(height) * width, padValue[c]);
+        for (int y = content.y; y < content.y + content.height; ++y)
+        {
+            float* row = plane + static_cast<size_t>(y) * width;
+            std::fill(row, row + content.x, padValue[c]);
+            std::fill(row + content.x + content.width, row + width, padValue[c]);
+        }
+    }
+
+    // Column offsets and weights are shared by every row
+    cv::AutoBuffer<int> xOffset(2 * content.width);
+    cv::AutoBuffer<float> xWeight(content.width);
+    const float stepX = static_cast<float>(src.cols) / content.width;
+    for (int x = 0; x < content.width; ++x)
+    {
+        int x0 = 0;
+        int x1 = 0;
+        samplePosition(x, stepX, src.cols, x0, x1, xWeight[x]);
+        xOffset[2 * x] = x0 * 3;
+        xOffset[2 * x + 1] = x1 * 3;
+    }
+
+    const float stepY = static_cast<float>(src.rows) / content.height;
+    for (int y = 0; y < content.height; ++y)
+    {
+        int y0 = 0;
+        int y1 = 0;
+        float b = 0.0f;
+        samplePosition(y, stepY, src.rows, y0, y1, b);
+        const T* r0 = src.ptr<T>(y0);
+        const T* r1 = src.ptr<T>(y1);
+
+        const size_t outOffset = static_cast<size_t>(content.y + y) * width + content.x;
+        float* out[3] = {planes[0] + outOffset, planes[1] + outOffset, planes[2] + outOffset};
+
+        for (int x = 0; x < content.width; ++x)
+        {
+            const int i0 = xOffset[2 * x];
+            const int i1 = xOffset[2 * x + 1];
+            const float a = xWeight[x];
+            for (int c = 0; c < 3; ++c)
+            {
+                const int s = srcChannel[c];
+                const float top = r0[i0 + s] + a * (static_cast<float>(r0[i1 + s]) - r0[i0 + s]);
+                const float bottom = r1[i0 + s] + a * (static_cast<float>(r1[i1 + s]) - r1[i0 + s]);
+                out[c][x] = (top + b * (bottom - top) - mean[c]) * scale;
+            }
+        }
+    }
+}
+
+} // namespace
+
+/*******************************************************************************
+ * BlobPreprocessor Implementation
+ ******************************************************************************/
+LetterboxTransform BlobPreprocessor::transformFor(const cv::Size& imageSize, const Params& params)
+{
+    LetterboxTransform t;
+    t.imageSize = imageSize;
+    t.inputSize = params.inputSize;
+    t.content = cv::Rect(cv::Point(0, 0), params.inputSize);
+
+    if (!params.letterbox || imageSize.empty())
+    {
+        return t;
+    }
+
+    const double ratio = std::min(static_cast<double>(params.inputSize.width) / imageSize.width,
+                                  static_cast<double>(params.inputSize.height) / imageSize.height);
+    const int width = std::clamp(static_cast<int>(std::lround(imageSize.width * ratio)),
+                                 1, params.inputSize.width);
+    const int height = std::clamp(static_cast<int>(std::lround(imageSize.height * ratio)),
+                                  1, params.inputSize.height);
+    t.content = cv::Rect((params.inputSize.width - width) / 2,
+                         (params.inputSize.height - height) / 2,
+                         width, height);
+    return t;
+}
+
+LetterboxTransform BlobPreprocessor::fill(const cv::Mat& image, const Params& params, float* dst)
+{
+    CV_Assert(!image.empty() && !params.inputSize.empty());
+
+    const LetterboxTransform t = transformFor(image.size(), params);
+    const size_t planeSize = static_cast<size_t>(params.inputSize.area());
+    float* const planes[3] = {dst, dst + planeSize, dst + 2 * planeSize};
+
+    // 8-bit and float BGR are read in place; other layouts are converted once
+    cv::Mat src = image;
+    if (src.channels() == 1)
+    {
+        cv::cvtColor(image, src, cv::COLOR_GRAY2BGR);
+    }
+    else if (src.channels() == 4)
+    {
+        cv::cvtColor(image, src, cv::COLOR_BGRA2BGR);
+    }
+    if (src.depth() != CV_8U && src.depth() != CV_32F)
+    {
+        src.convertTo(src, CV_32F);
+    }
+
+    if (src.depth() == CV_8U)
+    {
+        fillPlanes<uchar>(src, t, params, planes);
+    }
+    else
+    {
+        fillPlanes<float>(src, t, params, planes);
+    }
+    return t;
+}
+
+cv::Mat BlobPreprocessor::process(const cv::Mat& image, const Params& params,
+                                  LetterboxTransform* transform)
+{
+    cv::Mat blob = acquire(1, params.inputSize);
+    LetterboxTransform t = fill(image, params, blob.ptr<float>());
+    if (transform)
+    {
+        *transform = t;
+    }
+    return blob;
+}
+
+cv::Mat BlobPreprocessor::processBatch(const std::vector<cv::Mat>& images, const Params& params,
+                                       std::vector<LetterboxTransform>* transforms)
+{
+    const int count = static_cast<int>(images.size());
+    cv::Mat blob = acquire(count, params.inputSize);
+    const size_t slotSize = 3 * static_cast<size_t>(params.inputSize.area());
+
+    if (transforms)
+    {
+        transforms->resize(count);
+    }
+    for (int i = 0; i < count; ++i)
+    {
+        LetterboxTransform t = fill(images[i], params, blob.ptr<float>() + i * slotSize);
+        if (transforms)
+        {
+            (*transforms)[i] = t;
+        }
+    }
+    return blob;
+}
+
+int BlobPreprocessor::bufferCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return static_cast<int>(m_buffers.size());
+}
+
+cv::Mat BlobPreprocessor::acquire(int batch, const cv::Size& inputSize)
+{
+    int sizes[] = {batch, 3, inputSize.height, inputSize.width};
+
+    QMutexLocker locker(&m_mutex);
+
+    // Free = referenced by the pool only. Copies are only made from held
+    // blobs, so a count of 1 seen here cannot be raised behind our back.
+    cv::Mat* spare = nullptr;
+    for (cv::Mat& buffer : m_buffers)
+    {
+        if (buffer.u->refcount != 1)
+        {
+            continue;
+        }
+        if (buffer.size[0] == batch && buffer.size[2] == inputSize.height &&
+            buffer.size[3] == inputSize.width)
+        {
+            return buffer;
+        }
+        spare = &buffer;
+    }
+
+    if (static_cast<int>(m_buffers.size()) < kMaxBuffers)
+    {
+        m_buffers.emplace_back(4, sizes, CV_32F);
+        return m_buffers.back();
+    }
+
+    // Pool full: reshape a free buffer, or hand out an unpooled one
+    if (spare)
+    {
+        spare->create(4, sizes, CV_32F);
+        return *spare;
+    }
+    return cv::Mat(4, sizes, CV_32F);
+}
+
+} // namespace VisionBox
@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Blob Preprocessor - Fused letterbox / normalize / NCHW conversion
+ ******************************************************************************/
+
+#ifndef VISIONBOX_BLOB_PREPROCESSOR_H
+#define VISIONBOX_BLOB_PREPROCESSOR_H
+
+#include <QMutex>
+#include <opencv2/core.hpp>
+#include <vector>
+
+namespace VisionBox {
+
+/**
+ * @brief Where an image lands inside the network input
+ *
+ * With letterboxing the image is scaled uniformly and centered, the rest is
+ * padding; without it the image is stretched over the whole input. Boxes
+ * decoded in network input pixels map back with toImage().
+ */
+struct LetterboxTransform
+{
+    cv::Size imageSize;       // Source image
+    cv::Size inputSize;       // Network input
+    cv::Rect content;         // Image area inside the network input
+
+    // Network input pixels per image pixel
+    float scaleX() const { return static_cast<float>(content.width) / imageSize.width; }
+    float scaleY() const { return static_cast<float>(content.height) / imageSize.height; }
+
+    cv::Rect2f toImage(const cv::Rect2f& box) const
+    {
+        return cv::Rect2f((box.x - content.x) / scaleX(), (box.y - content.y) / scaleY(),
+                          box.width / scaleX(), box.height / scaleY());
+    }
+};
+
+/**
+ * @brief Builds network input blobs in one pass over the image
+ *
+ * cv::dnn::blobFromImage resizes into a temporary, converts it to float,
+ * subtracts the mean, scales it and finally transposes HWC to CHW into a
+ * newly allocated blob. Here each output value is sampled (bilinear),
+ * normalized and written straight into its CHW plane, so an 8-bit BGR
+ * frame is read once and no full-frame temporaries are created.
+ *
+ * Blobs come from a small pool: a returned blob shares its buffer, which
+ * is handed out again once every copy of it (including the one a network
+ * keeps as its input) has been released. The pool is thread-safe.
+ */
+class BlobPreprocessor
+{
+public:
+    struct Params
+    {
+        cv::Size inputSize = cv::Size(640, 640);
+        double scale = 1.0 / 255.0;
+        cv::Scalar mean = cv::Scalar(0, 0, 0, 0);   // Subtracted before scaling, blob channel order
+        bool swapRB = true;
+        bool letterbox = true;                      // Keep aspect ratio and pad
+        cv::Scalar padColor = cv::Scalar(114, 114, 114);  // Image channel order
+
+        bool operator==(const Params& other) const
+        {
+            return inputSize == other.inputSize && scale == other.scale &&
+                   mean == other.mean && swapRB == other.swapRB &&
+                   letterbox == other.letterbox && padColor == other.padColor;
+        }
+    };
+
+    BlobPreprocessor() = default;
+
+    // Geometry only, no pixels touched
+    static LetterboxTransform transformFor(const cv::Size& imageSize, const Params& params);
+
+    // Write one image as three float planes of params.inputSize at dst
+    static LetterboxTransform fill(const cv::Mat& image, const Params& params, float* dst);
+
+    // [1, 3, H, W] blob
+    cv::Mat process(const cv::Mat& image, const Params& params,
+                    LetterboxTransform* transform = nullptr);
+
+    // [N, 3, H, W] blob, one slot per image
+    cv::Mat processBatch(const std::vector<cv::Mat>& images, const Params& params,
+                         std::vector<LetterboxTransform>* transforms = nullptr);
+
+    int bufferCount() const;
+
+private:
+    cv::Mat acquire(int batch, const cv::Size& inputSize);
+
+    static constexpr int kMaxBuffers = 8;
+
+    mutable QMutex m_mutex;
+    std::vector<cv::Mat> m_buffers;     // Guarded by m_mutex
+
+    // Prevent copy
+    BlobPreprocessor(const BlobPreprocessor&) = delete;
+    BlobPreprocessor& operator=(const BlobPreprocessor&) = delete;
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_BLOB_PREPROCESSOR_H
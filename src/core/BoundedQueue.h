@@ -0,0 +1,193 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Bounded Producer/Consumer Queue
+ ******************************************************************************/
+
+#ifndef VISIONBOX_BOUNDED_QUEUE_H
+#define VISIONBOX_BOUNDED_QUEUE_H
+
+#include <QMutex>
+#include <QMutexLocker>
+#include <QWaitCondition>
+#include <deque>
+#include <utility>
+
+namespace VisionBox {
+
+/**
+ * @brief What push() does when the queue is full
+ */
+enum class QueueOverflowPolicy
+{
+    Block = 0,      // Wait for the consumer (back-pressure on the producer)
+    DropOldest,     // Discard the oldest queued item to make room
+    DropNewest      // Discard the item being pushed
+};
+
+/**
+ * @brief Thread-safe FIFO with a fixed capacity
+ *
+ * Used to hand work from the data-flow (GUI) thread to background workers.
+ * close() wakes every waiter; consumers keep receiving the remaining items
+ * until the queue is empty, so closing and joining the worker flushes it.
+ */
+template <typename T>
+class BoundedQueue
+{
+public:
+    explicit BoundedQueue(int capacity = 16,
+                          QueueOverflowPolicy policy = QueueOverflowPolicy::Block)
+        : m_capacity(capacity > 0 ? capacity : 1)
+        , m_policy(policy)
+    {
+    }
+
+    // Push an item; returns false if it was dropped or the queue is closed
+    bool push(T item)
+    {
+        QMutexLocker locker(&m_mutex);
+
+        if (m_closed)
+        {
+            return false;
+        }
+
+        if (static_cast<int>(m_items.size()) >= m_capacity)
+        {
+            switch (m_policy)
+            {
+                case QueueOverflowPolicy::Block:
+                    while (!m_closed && static_cast<int>(m_items.size()) >= m_capacity)
+                    {
+                        m_notFull.wait(&m_mutex);
+                    }
+                    if (m_closed)
+                    {
+                        return false;
+                    }
+                    break;
+                case QueueOverflowPolicy::DropOldest:
+                    m_items.pop_front();
+                    m_dropped++;
+                    break;
+                case QueueOverflowPolicy::DropNewest:
+                    m_dropped++;
+                    return false;
+            }
+        }
+
+        m_items.push_back(std::move(item));
+        m_notEmpty.wakeOne();
+        return true;
+    }
+
+    // Pop the next item, waiting if needed; returns false once closed and drained
+    bool pop(T& item)
+    {
+        QMutexLocker locker(&m_mutex);
+
+        while (m_items.empty() && !m_closed)
+        {
+            m_notEmpty.wait(&m_mutex);
+        }
+
+        if (m_items.empty())
+        {
+            return false;
+        }
+
+        item = std::move(m_items.front());
+        m_items.pop_front();
+        m_notFull.wakeOne();
+        return true;
+    }
+
+    // Stop accepting items and wake all waiters
+    void close()
+    {
+        QMutexLocker locker(&m_mutex);
+        m_closed = true;
+        m_notEmpty.wakeAll();
+        m_notFull.wakeAll();
+    }
+
+    // Accept items again (after the consumer has been joined)
+    void reopen()
+    {
+        QMutexLocker locker(&m_mutex);
+        m_items.clear();
+        m_closed = false;
+        m_dropped = 0;
+    }
+
+    // Discard queued items without consuming them
+    void clear()
+    {
+        QMutexLocker locker(&m_mutex);
+        m_items.clear();
+        m_notFull.wakeAll();
+    }
+
+    int size() const
+    {
+        QMutexLocker locker(&m_mutex);
+        return static_cast<int>(m_items.size());
+    }
+
+    int capacity() const
+    {
+        QMutexLocker locker(&m_mutex);
+        return m_capacity;
+    }
+
+    void setCapacity(int capacity)
+    {
+        QMutexLocker locker(&m_mutex);
+        m_capacity = capacity > 0 ? capacity : 1;
+        m_notFull.wakeAll();
+    }
+
+    QueueOverflowPolicy policy() const
+    {
+        QMutexLocker locker(&m_mutex);
+        return m_policy;
+    }
+
+    void setPolicy(QueueOverflowPolicy policy)
+    {
+        QMutexLocker locker(&m_mutex);
+        m_policy = policy;
+        m_notFull.wakeAll();
+    }
+
+    // Items discarded by the overflow policy since the last reopen()
+    qint64 droppedCount() const
+    {
+        QMutexLocker locker(&m_mutex);
+        return m_dropped;
+    }
+
+    bool isClosed() const
+    {
+        QMutexLocker locker(&m_mutex);
+        return m_closed;
+    }
+
+private:
+    mutable QMutex m_mutex;
+    QWaitCondition m_notEmpty;
+    QWaitCondition m_notFull;
+    std::deque<T> m_items;
+    int m_capacity;
+    QueueOverflowPolicy m_policy;
+    qint64 m_dropped = 0;
+    bool m_closed = false;
+
+    // Prevent copy
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_BOUNDED_QUEUE_H
@@ -0,0 +1,344 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Box NMS Implementation
+ ******************************************************************************/
+
+#include "BoxNms.h"
+#include <opencv2/core.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+namespace VisionBox {
+
+namespace {
+
+constexpr int kWordBits = 64;
+
+// One class bucket in structure-of-arrays layout, padded to whole mask
+// words with empty boxes (an empty box never overlaps anything)
+struct Scratch
+{
+    std::vector<int> order;                   // Candidates above threshold, sorted
+    std::vector<float> x1;
+    std::vector<float> y1;
+    std::vector<float> x2;
+    std::vector<float> y2;
+    std::vector<float> area;
+    std::vector<float> score;
+    std::vector<int> index;                   // Candidate index of each slot
+    std::vector<float> iou;                   // Soft-NMS: IoU with the current box
+    std::vector<uint64_t> suppressed;         // Hard NMS: one bit per slot
+    std::vector<std::pair<float, int>> kept;  // (score, candidate index)
+};
+
+thread_local Scratch t_scratch;
+
+void gather(const YoloCandidates& candidates, const int* order, int count, Scratch& s)
+{
+    const size_t padded = static_cast<size_t>(count + kWordBits - 1) / kWordBits * kWordBits;
+    s.x1.assign(padded, 0.0f);
+    s.y1.assign(padded, 0.0f);
+    s.x2.assign(padded, 0.0f);
+    s.y2.assign(padded, 0.0f);
+    s.area.assign(padded, 0.0f);
+    s.score.assign(padded, 0.0f);
+    s.index.assign(padded, -1);
+
+    for (int k = 0; k < count; ++k)
+    {
+        const int i = order[k];
+        const float w = std::max(candidates.width[i], 0.0f);
+        const float h = std::max(candidates.height[i], 0.0f);
+        s.x1[k] = candidates.x[i];
+        s.y1[k] = candidates.y[i];
+        s.x2[k] = candidates.x[i] + w;
+        s.y2[k] = candidates.y[i] + h;
+        s.area[k] = w * h;
+        s.score[k] = candidates.score[i];
+        s.index[k] = i;
+    }
+}
+
+// Intersection and union of slot i with slot j
+inline void overlap(const Scratch& s, int i, int j, float& intersection, float& unionArea)
+{
+    const float w = std::max(0.0f, std::min(s.x2[i], s.x2[j]) - std::max(s.x1[i], s.x1[j]));
+    const float h = std::max(0.0f, std::min(s.y2[i], s.y2[j]) - std::max(s.y1[i], s.y1[j]));
+    intersection = w * h;
+    unionArea = s.area[i] + s.area[j] - intersection;
+}
+
+#if CV_SIMD && !CV_SIMD_SCALABLE
+// Slot i broadcast to every lane
+struct LaneBox
+{
+    explicit LaneBox(const Scratch& s, int i)
+        : x1(cv::vx_setall_f32(s.x1[i])), y1(cv::vx_setall_f32(s.y1[i])),
+          x2(cv::vx_setall_f32(s.x2[i])), y2(cv::vx_setall_f32(s.y2[i])),
+          area(cv::vx_setall_f32(s.area[i]))
+    {
+    }
+
+    cv::v_float32 x1, y1, x2, y2, area;
+};
+
+// Intersection and union of the broadcast box with the slots starting at j
+inline void overlapLanes(const Scratch& s, const LaneBox& box, int j,
+                         cv::v_float32& intersection, cv::v_float32& unionArea)
+{
+    const cv::v_float32 zero = cv::vx_setzero_f32();
+    const cv::v_float32 w = cv::v_max(zero, cv::v_min(box.x2, cv::vx_load(&s.x2[j])) -
+                                                cv::v_max(box.x1, cv::vx_load(&s.x1[j])));
+    const cv::v_float32 h = cv::v_max(zero, cv::v_min(box.y2, cv::vx_load(&s.y2[j])) -
+                                                cv::v_max(box.y1, cv::vx_load(&s.y1[j])));
+    intersection = w * h;
+    unionArea = box.area + cv::vx_load(&s.area[j]) - intersection;
+}
+#endif
+
+// Hard NMS over one bucket sorted by score
+void suppressBucket(Scratch& s, int count, float iouThreshold, int limit)
+{
+    const int words = (count + kWordBits - 1) / kWordBits;
+    s.suppressed.assign(words, 0);
+
+    int kept = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        if ((s.suppressed[i / kWordBits] >> (i % kWordBits)) & 1u)
+        {
+            continue;
+        }
+
+        s.kept.emplace_back(s.score[i], s.index[i]);
+        if (limit > 0 && ++kept >= limit)
+        {
+            break;
+        }
+
+        // Mark every later box that box i overlaps too much. Bits at or
+        // before i in the first word are set too, but never read again.
+#if CV_SIMD && !CV_SIMD_SCALABLE
+        const LaneBox box(s, i);
+        const cv::v_float32 threshold = cv::vx_setall_f32(iouThreshold);
+        const int lanes = cv::v_float32::nlanes;
+#endif
+        for (int w = (i + 1) / kWordBits; w < words; ++w)
+        {
+            // Early exit: nothing left to suppress in this word
+            if (s.suppressed[w] == ~uint64_t(0))
+            {
+                continue;
+            }
+
+            const int base = w * kWordBits;
+            uint64_t bits = 0;
+#if CV_SIMD && !CV_SIMD_SCALABLE
+            for (int k = 0; k < kWordBits; k += lanes)
+            {
+                cv::v_float32 intersection;
+                cv::v_float32 unionArea;
+                overlapLanes(s, box, base + k, intersection, unionArea);
+                const int mask = cv::v_signmask(intersection > threshold * unionArea);
+                bits |= static_cast<uint64_t>(static_cast<unsigned>(mask)) << k;
+            }
+#else
+            for (int k = 0; k < kWordBits; ++k)
+            {
+                float intersection = 0.0f;
+                float unionArea = 0.0f;
+                overlap(s, i, base + k, intersection, unionArea);
+                if (intersection > iouThreshold * unionArea)
+                {
+                    bits |= uint64_t(1) << k;
+                }
+            }
+#endif
+            s.suppressed[w] |= bits;
+        }
+    }
+}
+
+// Move slot 'from' into slot 'to' (soft-NMS keeps the live slots packed)
+inline void moveSlot(Scratch& s, int from, int to)
+{
+    s.x1[to] = s.x1[from];
+    s.y1[to] = s.y1[from];
+    s.x2[to] = s.x2[from];
+    s.y2[to] = s.y2[from];
+    s.area[to] = s.area[from];
+    s.score[to] = s.score[from];
+    s.index[to] = s.index[from];
+}
+
+inline void swapSlots(Scratch& s, int a, int b)
+{
+    std::swap(s.x1[a], s.x1[b]);
+    std::swap(s.y1[a], s.y1[b]);
+    std::swap(s.x2[a], s.x2[b]);
+    std::swap(s.y2[a], s.y2[b]);
+    std::swap(s.area[a], s.area[b]);
+    std::swap(s.score[a], s.score[b]);
+    std::swap(s.index[a], s.index[b]);
+}
+
+// Gaussian soft-NMS over one bucket
+void softSuppressBucket(Scratch& s, int count, float scoreThreshold, float sigma, int limit)
+{
+    s.iou.resize(s.score.size());
+    const float decay = -1.0f / std::max(sigma, 1e-6f);
+
+    int live = count;
+    int kept = 0;
+    while (live > 0)
+    {
+        // Scores change as boxes decay, so the best one is searched each round
+        float best = 0.0f;
+        const int i = YoloDecoder::argmax(s.score.data(), live, best);
+        if (best <= scoreThreshold)
+        {
+            break;
+        }
+
+        s.kept.emplace_back(best, s.index[i]);
+        if (limit > 0 && ++kept >= limit)
+        {
+            break;
+        }
+
+        // Keep box i in the last live slot while the others are compared to it
+        swapSlots(s, i, live - 1);
+        const int current = --live;
+
+        int j = 0;
+#if CV_SIMD && !CV_SIMD_SCALABLE
+        const LaneBox box(s, current);
+        const int lanes = cv::v_float32::nlanes;
+        const cv::v_float32 tiny = cv::vx_setall_f32(1e-9f);
+        for (; j + lanes <= live; j += lanes)
+        {
+            cv::v_float32 intersection;
+            cv::v_float32 unionArea;
+            overlapLanes(s, box, j, intersection, unionArea);
+            cv::v_store(&s.iou[j], intersection / cv::v_max(unionArea, tiny));
+        }
+#endif
+        for (; j < live; ++j)
+        {
+            float intersection = 0.0f;
+            float unionArea = 0.0f;
+            overlap(s, current, j, intersection, unionArea);
+            s.iou[j] = intersection / std::max(unionArea, 1e-9f);
+        }
+
+        // Decay, and drop boxes that fell to the threshold
+        for (j = 0; j < live;)
+        {
+            s.score[j] *= std::exp(decay * s.iou[j] * s.iou[j]);
+            if (s.score[j] <= scoreThreshold)
+            {
+                --live;
+                moveSlot(s, live, j);
+                s.iou[j] = s.iou[live];
+                continue;
+            }
+            ++j;
+        }
+    }
+}
+
+} // namespace
+
+/*******************************************************************************
+ * BoxNms Implementation
+ ******************************************************************************/
+int BoxNms::run(const YoloCandidates& candidates, const Params& params,
+                std::vector<int>& indices, std::vector<float>& scores)
+{
+    indices.clear();
+    scores.clear();
+
+    Scratch& s = t_scratch;
+    s.kept.clear();
+
+    // Candidates above threshold, by class, then score (ties by index,
+    // matching the stable sort of cv::dnn::NMSBoxes)
+    s.order.clear();
+    for (size_t i = 0; i < candidates.size(); ++i)
+    {
+        if (candidates.score[i] > params.scoreThreshold)
+        {
+            s.order.push_back(static_cast<int>(i));
+        }
+    }
+
+    const bool perClass = params.perClass;
+    std::sort(s.order.begin(), s.order.end(), [&](int a, int b)
+    {
+        if (perClass && candidates.classId[a] != candidates.classId[b])
+        {
+            return candidates.classId[a] < candidates.classId[b];
+        }
+        if (candidates.score[a] != candidates.score[b])
+        {
+            return candidates.score[a] > candidates.score[b];
+        }
+        return a < b;
+    });
+
+    // Suppress each class bucket on its own
+    const int total = static_cast<int>(s.order.size());
+    for (int begin = 0; begin < total;)
+    {
+        int end = begin + 1;
+        if (perClass)
+        {
+            const int classId = candidates.classId[s.order[begin]];
+            while (end < total && candidates.classId[s.order[end]] == classId)
+            {
+                ++end;
+            }
+        }
+        else
+        {
+            end = total;
+        }
+
+        const int count = end - begin;
+        gather(candidates, s.order.data() + begin, count, s);
+        if (params.soft)
+        {
+            softSuppressBucket(s, count, params.scoreThreshold, params.sigma, params.maxDetections);
+        }
+        else
+        {
+            suppressBucket(s, count, params.iouThreshold, params.maxDetections);
+        }
+        begin = end;
+    }
+
+    // Merge the buckets, highest score first
+    std::sort(s.kept.begin(), s.kept.end(), [](const std::pair<float, int>& a,
+                                               const std::pair<float, int>& b)
+    {
+        return a.first != b.first ? a.first > b.first : a.second < b.second;
+    });
+    if (params.maxDetections > 0 && static_cast<int>(s.kept.size()) > params.maxDetections)
+    {
+        s.kept.resize(params.maxDetections);
+    }
+
+    indices.reserve(s.kept.size());
+    scores.reserve(s.kept.size());
+    for (const std::pair<float, int>& kept : s.kept)
+    {
+        scores.push_back(kept.first);
+        indices.push_back(kept.second);
+    }
+    return static_cast<int>(indices.size());
+}
+
+} // namespace VisionBox
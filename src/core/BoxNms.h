@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Box NMS - Class-aware non-maximum suppression kernel
+ ******************************************************************************/
+
+#ifndef VISIONBOX_BOX_NMS_H
+#define VISIONBOX_BOX_NMS_H
+
+#include "YoloDecoder.h"
+#include <vector>
+
+namespace VisionBox {
+
+/**
+ * @brief Non-maximum suppression over YoloCandidates
+ *
+ * Candidates above the score threshold are sorted by class, then by score,
+ * so each class is suppressed on its own. Per class the box corners and
+ * areas are gathered into contiguous arrays and the IoU of the current box
+ * against the following ones is computed a vector at a time; suppressed
+ * boxes are tracked in a 64-bit-per-word bitmask, and words that are already
+ * fully suppressed are skipped without touching their boxes.
+ *
+ * Hard NMS keeps exactly the boxes cv::dnn::NMSBoxes keeps for the same
+ * class. Soft-NMS (Gaussian) lowers the scores of overlapping boxes instead
+ * of dropping them, which keeps more of a crowd of touching objects.
+ *
+ * Scratch buffers are per thread, so steady-state calls do not allocate.
+ */
+class BoxNms
+{
+public:
+    struct Params
+    {
+        float scoreThreshold = 0.5f;
+        float iouThreshold = 0.45f;   // Hard NMS: suppress when IoU is above this
+        bool perClass = true;         // Boxes only suppress boxes of their own class
+        bool soft = false;            // Gaussian soft-NMS instead of hard suppression
+        float sigma = 0.5f;           // Soft-NMS: score *= exp(-IoU^2 / sigma)
+        int maxDetections = 0;        // Keep at most this many boxes; 0 = all
+    };
+
+    // Kept candidate indices and their scores (decayed with soft-NMS),
+    // highest score first. Returns the number kept.
+    static int run(const YoloCandidates& candidates, const Params& params,
+                   std::vector<int>& indices, std::vector<float>& scores);
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_BOX_NMS_H
@@ -0,0 +1,332 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Detection Cadence Implementation
+ ******************************************************************************/
+
+#include "DetectionCadence.h"
+#include <opencv2/imgproc.hpp>
+#include <opencv2/video/tracking.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace VisionBox {
+
+namespace {
+
+constexpr int kMinPoints = 3;                       // Fewer surviving points: box is lost
+constexpr float kMaxForwardBackwardError = 2.0f;    // Tracking pixels
+const cv::Size kFlowWindow(21, 21);
+constexpr int kFlowLevels = 3;
+
+float median(std::vector<float>& values)
+{
+    auto middle = values.begin() + values.size() / 2;
+    std::nth_element(values.begin(), middle, values.end());
+    return *middle;
+}
+
+} // namespace
+
+/*******************************************************************************
+ * DetectionCadence Implementation
+ ******************************************************************************/
+void DetectionCadence::setParams(const Params& params)
+{
+    const bool resolutionChanged = params.trackingWidth != m_params.trackingWidth;
+    m_params = params;
+    if (resolutionChanged)
+    {
+        reset();
+    }
+}
+
+void DetectionCadence::reset()
+{
+    m_tracks.clear();
+    m_prevGray.release();
+    m_keyThumbnail.release();
+    m_sinceKeyframe = 0;
+    m_pending = false;
+    m_forceDetection = true;
+}
+
+bool DetectionCadence::needsDetection(const cv::Mat& frame)
+{
+    const int interval = std::max(1, m_params.interval);
+    const bool sameSize = frame.size() == m_frameSize && !m_prevGray.empty();
+    ++m_sinceKeyframe;
+
+    bool detect = m_forceDetection || !sameSize || m_sinceKeyframe >= interval;
+
+    // A requested keyframe is still on its way: track until it is overdue
+    if (detect && m_pending && sameSize && m_sinceKeyframe < interval)
+    {
+        detect = false;
+    }
+
+    if (!detect && m_params.sceneChangeThreshold > 0.0 && !m_keyThumbnail.empty())
+    {
+        cv::Mat difference;
+        cv::absdiff(thumbnail(frame), m_keyThumbnail, difference);
+        if (cv::mean(difference)[0] > m_params.sceneChangeThreshold)
+        {
+            m_stats.sceneChanges++;
+            detect = true;
+        }
+    }
+
+    if (detect)
+    {
+        m_stats.keyframes++;
+        m_sinceKeyframe = 0;
+        m_pending = true;
+        m_forceDetection = false;
+    }
+    else
+    {
+        m_stats.trackedFrames++;
+    }
+    return detect;
+}
+
+void DetectionCadence::setDetections(const cv::Mat& frame, const std::vector<cv::Rect>& boxes)
+{
+    m_pending = false;
+    m_prevGray = trackingGray(frame);
+    m_keyThumbnail = thumbnail(frame);
+
+    m_tracks.clear();
+    m_tracks.reserve(boxes.size());
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        Track track;
+        track.box = cv::Rect2f(static_cast<float>(boxes[i].x * m_trackScale),
+                               static_cast<float>(boxes[i].y * m_trackScale),
+                               static_cast<float>(boxes[i].width * m_trackScale),
+                               static_cast<float>(boxes[i].height * m_trackScale));
+        track.source = static_cast<int>(i);
+        seedPoints(track);
+        m_tracks.push_back(std::move(track));
+    }
+}
+
+void DetectionCadence::track(const cv::Mat& frame, std::vector<cv::Rect>& boxes,
+                             std::vector<int>& sources)
+{
+    boxes.clear();
+    sources.clear();
+
+    if (m_prevGray.empty() || frame.size() != m_frameSize)
+    {
+        m_tracks.clear();
+        m_forceDetection = true;
+        return;
+    }
+
+    cv::Mat gray = trackingGray(frame);
+    if (m_tracks.empty())
+    {
+        m_prevGray = gray;
+        return;
+    }
+
+    // Every box's points in one flow call, checked by tracking them back
+    std::vector<cv::Point2f> points;
+    for (const Track& track : m_tracks)
+    {
+        points.insert(points.end(), track.points.begin(), track.points.end());
+    }
+
+    std::vector<cv::Point2f> next;
+    std::vector<cv::Point2f> back;
+    std::vector<uchar> status;
+    std::vector<uchar> backStatus;
+    std::vector<float> error;
+    if (!points.empty())
+    {
+        cv::calcOpticalFlowPyrLK(m_prevGray, gray, points, next, status, error,
+                                 kFlowWindow, kFlowLevels);
+        cv::calcOpticalFlowPyrLK(gray, m_prevGray, next, back, backStatus, error,
+                                 kFlowWindow, kFlowLevels);
+    }
+
+    const cv::Rect2f bounds(0.0f, 0.0f, static_cast<float>(gray.cols),
+                            static_cast<float>(gray.rows));
+    std::vector<Track> kept;
+    std::vector<size_t> reseed;
+    kept.reserve(m_tracks.size());
+
+    size_t offset = 0;
+    std::vector<cv::Point2f> from;
+    std::vector<cv::Point2f> to;
+    std::vector<float> dx;
+    std::vector<float> dy;
+    std::vector<float> ratios;
+    for (Track& track : m_tracks)
+    {
+        from.clear();
+        to.clear();
+        for (size_t k = offset; k < offset + track.points.size(); ++k)
+        {
+            if (status[k] && backStatus[k] && cv::norm(back[k] - points[k]) < kMaxForwardBackwardError)
+            {
+                from.push_back(points[k]);
+                to.push_back(next[k]);
+            }
+        }
+        offset += track.points.size();
+
+        if (static_cast<int>(from.size()) < kMinPoints)
+        {
+            m_stats.lostBoxes++;
+            m_forceDetection = true;
+            continue;
+        }
+
+        // Median shift, and median change of point distances as the scale
+        dx.clear();
+        dy.clear();
+        ratios.clear();
+        for (size_t k = 0; k < from.size(); ++k)
+        {
+            dx.push_back(to[k].x - from[k].x);
+            dy.push_back(to[k].y - from[k].y);
+            for (size_t m = k + 1; m < from.size(); ++m)
+            {
+                const double before = cv::norm(from[k] - from[m]);
+                if (before > 1.0)
+                {
+                    ratios.push_back(static_cast<float>(cv::norm(to[k] - to[m]) / before));
+                }
+            }
+        }
+        const float scale = ratios.empty() ? 1.0f : median(ratios);
+        const float width = track.box.width * scale;
+        const float height = track.box.height * scale;
+        const float centerX = track.box.x + 0.5f * track.box.width + median(dx);
+        const float centerY = track.box.y + 0.5f * track.box.height + median(dy);
+        track.box = cv::Rect2f(centerX - 0.5f * width, centerY - 0.5f * height, width, height);
+
+        if ((track.box & bounds).area() < 1.0f)
+        {
+            m_stats.lostBoxes++;
+            m_forceDetection = true;
+            continue;
+        }
+
+        track.points = to;
+        if (static_cast<int>(track.points.size()) < m_params.pointsPerBox / 2)
+        {
+            reseed.push_back(kept.size());
+        }
+        kept.push_back(std::move(track));
+    }
+
+    m_tracks.swap(kept);
+    m_prevGray = gray;
+
+    // Boxes that lost most of their points pick fresh ones on this frame
+    for (size_t index : reseed)
+    {
+        seedPoints(m_tracks[index]);
+    }
+
+    const cv::Rect frameBounds(cv::Point(0, 0), m_frameSize);
+    const double inverse = 1.0 / m_trackScale;
+    boxes.reserve(m_tracks.size());
+    sources.reserve(m_tracks.size());
+    for (const Track& track : m_tracks)
+    {
+        const cv::Rect box(static_cast<int>(std::lround(track.box.x * inverse)),
+                           static_cast<int>(std::lround(track.box.y * inverse)),
+                           static_cast<int>(std::lround(track.box.width * inverse)),
+                           static_cast<int>(std::lround(track.box.height * inverse)));
+        boxes.push_back(box & frameBounds);
+        sources.push_back(track.source);
+    }
+}
+
+cv::Mat DetectionCadence::trackingGray(const cv::Mat& frame)
+{
+    m_frameSize = frame.size();
+    m_trackScale = frame.cols > m_params.trackingWidth && m_params.trackingWidth > 0
+                       ? static_cast<double>(m_params.trackingWidth) / frame.cols
+                       : 1.0;
+
+    // Shrink first, so the color conversion runs on the small image
+    cv::Mat small = frame;
+    if (m_trackScale < 1.0)
+    {
+        cv::resize(frame, small, cv::Size(), m_trackScale, m_trackScale, cv::INTER_AREA);
+    }
+
+    cv::Mat gray;
+    if (small.channels() == 3)
+    {
+        cv::cvtColor(small, gray, cv::COLOR_BGR2GRAY);
+    }
+    else if (small.channels() == 4)
+    {
+        cv::cvtColor(small, gray, cv::COLOR_BGRA2GRAY);
+    }
+    else
+    {
+        gray = small.clone();
+    }
+    if (gray.depth() != CV_8U)
+    {
+        gray.convertTo(gray, CV_8U);
+    }
+    return gray;
+}
+
+cv::Mat DetectionCadence::thumbnail(const cv::Mat& frame)
+{
+    cv::Mat small;
+    cv::resize(frame, small, cv::Size(64, 64), 0.0, 0.0, cv::INTER_AREA);
+    if (small.channels() == 3)
+    {
+        cv::cvtColor(small, small, cv::COLOR_BGR2GRAY);
+    }
+    else if (small.channels() == 4)
+    {
+        cv::cvtColor(small, small, cv::COLOR_BGRA2GRAY);
+    }
+    small.convertTo(small, CV_32F);
+    return small;
+}
+
+void DetectionCadence::seedPoints(Track& track) const
+{
+    track.points.clear();
+
+    const cv::Rect roi = cv::Rect(track.box) & cv::Rect(0, 0, m_prevGray.cols, m_prevGray.rows);
+    if (roi.width < 4 || roi.height < 4)
+    {
+        return;
+    }
+
+    // Corners inside the box; a regular grid where the box has no texture
+    const double minDistance = std::max(2, std::min(roi.width, roi.height) / 8);
+    cv::goodFeaturesToTrack(m_prevGray(roi), track.points, std::max(1, m_params.pointsPerBox),
+                            0.01, minDistance);
+    if (static_cast<int>(track.points.size()) < kMinPoints + 1)
+    {
+        track.points.clear();
+        for (int gy = 1; gy <= 4; ++gy)
+        {
+            for (int gx = 1; gx <= 4; ++gx)
+            {
+                track.points.emplace_back(roi.width * gx / 5.0f, roi.height * gy / 5.0f);
+            }
+        }
+    }
+
+    for (cv::Point2f& point : track.points)
+    {
+        point.x += static_cast<float>(roi.x);
+        point.y += static_cast<float>(roi.y);
+    }
+}
+
+} // namespace VisionBox
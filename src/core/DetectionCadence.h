@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Detection Cadence - Keyframe detection with tracked frames in between
+ ******************************************************************************/
+
+#ifndef VISIONBOX_DETECTION_CADENCE_H
+#define VISIONBOX_DETECTION_CADENCE_H
+
+#include <QtGlobal>
+#include <opencv2/core.hpp>
+#include <vector>
+
+namespace VisionBox {
+
+/**
+ * @brief Runs an expensive detector on keyframes and tracks boxes between them
+ *
+ * Consecutive video frames differ only slightly, so a detector node does not
+ * have to look at every one. needsDetection() picks the keyframes: every
+ * Params::interval frames, when the frame changes size, when the frame
+ * differs too much from the last keyframe (scene change) and after a
+ * tracked box was lost. The detector result for a keyframe is handed to
+ * setDetections(); on the other frames track() moves those boxes with
+ * pyramidal Lucas-Kanade flow of feature points inside each box (median
+ * shift and scale, forward-backward checked), which costs a fraction of a
+ * detector pass. Tracking runs on a downscaled gray copy of the frame.
+ *
+ * Not thread-safe: used from the node's thread only.
+ */
+class DetectionCadence
+{
+public:
+    struct Params
+    {
+        int interval = 5;                     // Detect every N frames; 1 = every frame
+        double sceneChangeThreshold = 25.0;   // Mean gray-level change vs the keyframe; 0 = off
+        int trackingWidth = 640;              // Frames are tracked at most this wide
+        int pointsPerBox = 30;
+    };
+
+    struct Stats
+    {
+        qint64 keyframes = 0;
+        qint64 trackedFrames = 0;
+        qint64 sceneChanges = 0;
+        qint64 lostBoxes = 0;
+
+        // Fraction of frames that went through the detector
+        double detectorShare() const
+        {
+            const qint64 frames = keyframes + trackedFrames;
+            return frames > 0 ? static_cast<double>(keyframes) / frames : 0.0;
+        }
+    };
+
+    DetectionCadence() = default;
+
+    void setParams(const Params& params);
+    Params params() const { return m_params; }
+
+    // Forget the tracked boxes; the next frame is a keyframe
+    void reset();
+
+    // Whether 'frame' has to go through the detector. Call once per frame.
+    // While a requested keyframe result is outstanding (pipelined detectors)
+    // the frames in between are tracked.
+    bool needsDetection(const cv::Mat& frame);
+
+    // Detector result for 'frame': these boxes (frame pixels) are tracked from now on
+    void setDetections(const cv::Mat& frame, const std::vector<cv::Rect>& boxes);
+
+    // Boxes of the last setDetections() moved to 'frame'. sources[i] is the
+    // index of boxes[i] in that call; lost boxes are left out.
+    void track(const cv::Mat& frame, std::vector<cv::Rect>& boxes, std::vector<int>& sources);
+
+    Stats stats() const { return m_stats; }
+
+private:
+    struct Track
+    {
+        cv::Rect2f box;                       // Tracking pixels
+        std::vector<cv::Point2f> points;
+        int source = 0;
+    };
+
+    cv::Mat trackingGray(const cv::Mat& frame);
+    static cv::Mat thumbnail(const cv::Mat& gray);
+    void seedPoints(Track& track) const;
+
+    Params m_params;
+    Stats m_stats;
+
+    cv::Size m_frameSize;
+    double m_trackScale = 1.0;                // Tracking pixels per frame pixel
+    cv::Mat m_prevGray;                       // Last tracked frame, tracking resolution
+    cv::Mat m_keyThumbnail;                   // Last keyframe, for scene changes
+    std::vector<Track> m_tracks;
+
+    int m_sinceKeyframe = 0;                  // Frames since a keyframe was requested
+    bool m_pending = false;                   // Keyframe requested, result not set yet
+    bool m_forceDetection = true;
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_DETECTION_CADENCE_H
@@ -0,0 +1,472 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Binary Columnar Detection / Keypoint Log Implementation
+ ******************************************************************************/
+
+#include "DetectionLog.h"
+#include <algorithm>
+#include <cstring>
+
+namespace VisionBox {
+
+using namespace DetectionLogFormat;
+
+namespace {
+
+constexpr qint64 align8(qint64 value)
+{
+    return (value + 7) & ~qint64(7);
+}
+
+/*******************************************************************************
+ * Column offsets of a block, relative to its header
+ ******************************************************************************/
+struct BlockLayout
+{
+    qint64 frameIndex = 0;
+    qint64 timestampMs = 0;
+    qint64 detectionOffset = 0;
+    qint64 keypointOffset = 0;
+    qint64 boxes = 0;
+    qint64 scores = 0;
+    qint64 labelIds = 0;
+    qint64 keypoints = 0;
+    qint64 keypointInts = 0;
+    qint64 labels = 0;          // Start of the label table
+
+    BlockLayout(qint64 frames, qint64 detections, qint64 keypointCount)
+    {
+        qint64 offset = sizeof(BlockHeader);
+        frameIndex = offset;
+        offset = align8(offset + frames * sizeof(qint64));
+        timestampMs = offset;
+        offset = align8(offset + frames * sizeof(double));
+        detectionOffset = offset;
+        offset = align8(offset + (frames + 1) * sizeof(quint32));
+        keypointOffset = offset;
+        offset = align8(offset + (frames + 1) * sizeof(quint32));
+        boxes = offset;
+        offset = align8(offset + detections * 4 * sizeof(float));
+        scores = offset;
+        offset = align8(offset + detections * sizeof(float));
+        labelIds = offset;
+        offset = align8(offset + detections * sizeof(quint16));
+        keypoints = offset;
+        offset = align8(offset + keypointCount * 5 * sizeof(float));
+        keypointInts = offset;
+        offset = align8(offset + keypointCount * 2 * sizeof(qint32));
+        labels = offset;
+    }
+};
+
+template <typename T>
+void writeColumn(QByteArray& block, qint64 offset, const std::vector<T>& column)
+{
+    if (!column.empty())
+    {
+        std::memcpy(block.data() + offset, column.data(), column.size() * sizeof(T));
+    }
+}
+
+} // namespace
+
+/*******************************************************************************
+ * DetectionLogEncoder Implementation
+ ******************************************************************************/
+DetectionLogEncoder::DetectionLogEncoder(int framesPerBlock)
+    : m_framesPerBlock(std::max(1, framesPerBlock))
+{
+    reset();
+}
+
+QByteArray DetectionLogEncoder::fileHeader()
+{
+    QByteArray header(kFileHeaderBytes, '\0');
+    std::memcpy(header.data(), kFileMagic, sizeof(kFileMagic));
+    std::memcpy(header.data() + 4, &kVersion, sizeof(quint32));
+    std::memcpy(header.data() + 8, &kByteOrderTag, sizeof(quint32));
+    return header;
+}
+
+bool DetectionLogEncoder::addFrame(qint64 frameIndex,
+                                   double timestampMs,
+                                   const QVector<DetectionData::Detection>& detections,
+                                   const std::vector<cv::KeyPoint>& keypoints)
+{
+    m_frameIndex.push_back(frameIndex);
+    m_timestampMs.push_back(timestampMs);
+
+    for (const auto& detection : detections)
+    {
+        m_boxes.push_back(static_cast<float>(detection.bbox.x()));
+        m_boxes.push_back(static_cast<float>(detection.bbox.y()));
+        m_boxes.push_back(static_cast<float>(detection.bbox.width()));
+        m_boxes.push_back(static_cast<float>(detection.bbox.height()));
+        m_scores.push_back(detection.confidence);
+
+        // Intern the label; ids are local to the block
+        auto found = m_labelIndex.constFind(detection.label);
+        quint16 id;
+        if (found != m_labelIndex.constEnd())
+        {
+            id = found.value();
+        }
+        else
+        {
+            id = static_cast<quint16>(m_labels.size());
+            m_labelIndex.insert(detection.label, id);
+            m_labels.append(detection.label);
+        }
+        m_labelIds.push_back(id);
+    }
+
+    for (const auto& keypoint : keypoints)
+    {
+        m_keypoints.push_back(keypoint.pt.x);
+        m_keypoints.push_back(keypoint.pt.y);
+        m_keypoints.push_back(keypoint.size);
+        m_keypoints.push_back(keypoint.angle);
+        m_keypoints.push_back(keypoint.response);
+        m_keypointInts.push_back(keypoint.octave);
+        m_keypointInts.push_back(keypoint.class_id);
+    }
+
+    m_detectionOffset.push_back(static_cast<quint32>(m_scores.size()));
+    m_keypointOffset.push_back(static_cast<quint32>(m_keypointInts.size() / 2));
+
+    // Close the block early rather than overflow the 16-bit label ids
+    return pendingFrames() >= m_framesPerBlock || m_labels.size() >= 0xFF00;
+}
+
+QByteArray DetectionLogEncoder::takeBlock()
+{
+    if (m_frameIndex.empty())
+    {
+        return QByteArray();
+    }
+
+    BlockHeader header;
+    header.frameCount = static_cast<quint32>(m_frameIndex.size());
+    header.detectionCount = static_cast<quint32>(m_scores.size());
+    header.keypointCount = static_cast<quint32>(m_keypointInts.size() / 2);
+    header.labelCount = static_cast<quint32>(m_labels.size());
+
+    BlockLayout layout(header.frameCount, header.detectionCount, header.keypointCount);
+
+    QByteArray labelTable;
+    for (const QString& label : m_labels)
+    {
+        QByteArray utf8 = label.toUtf8().left(0xFFFF);
+        quint16 length = static_cast<quint16>(utf8.size());
+        labelTable.append(reinterpret_cast<const char*>(&length), sizeof(length));
+        labelTable.append(utf8);
+    }
+
+    header.blockBytes = align8(layout.labels + labelTable.size());
+
+    QByteArray block(static_cast<int>(header.blockBytes), '\0');
+    std::memcpy(block.data(), &header, sizeof(header));
+    writeColumn(block, layout.frameIndex, m_frameIndex);
+    writeColumn(block, layout.timestampMs, m_timestampMs);
+    writeColumn(block, layout.detectionOffset, m_detectionOffset);
+    writeColumn(block, layout.keypointOffset, m_keypointOffset);
+    writeColumn(block, layout.boxes, m_boxes);
+    writeColumn(block, layout.scores, m_scores);
+    writeColumn(block, layout.labelIds, m_labelIds);
+    writeColumn(block, layout.keypoints, m_keypoints);
+    writeColumn(block, layout.keypointInts, m_keypointInts);
+    if (!labelTable.isEmpty())
+    {
+        std::memcpy(block.data() + layout.labels, labelTable.constData(), labelTable.size());
+    }
+
+    reset();
+    return block;
+}
+
+void DetectionLogEncoder::reset()
+{
+    m_frameIndex.clear();
+    m_timestampMs.clear();
+    m_detectionOffset.assign(1, 0);
+    m_keypointOffset.assign(1, 0);
+    m_boxes.clear();
+    m_scores.clear();
+    m_labelIds.clear();
+    m_keypoints.clear();
+    m_keypointInts.clear();
+    m_labelIndex.clear();
+    m_labels.clear();
+}
+
+/*******************************************************************************
+ * DetectionLogReader Implementation
+ ******************************************************************************/
+DetectionLogReader::~DetectionLogReader()
+{
+    close();
+}
+
+bool DetectionLogReader::open(const QString& filePath)
+{
+    close();
+
+    m_file.setFileName(filePath);
+    if (!m_file.open(QIODevice::ReadOnly))
+    {
+        m_error = m_file.errorString();
+        return false;
+    }
+
+    m_size = m_file.size();
+    if (m_size < kFileHeaderBytes)
+    {
+        m_error = "Not a detection log";
+        close();
+        return false;
+    }
+
+    m_base = m_file.map(0, m_size);
+    if (!m_base)
+    {
+        m_error = "Failed to map file";
+        close();
+        return false;
+    }
+
+    quint32 version = 0;
+    quint32 byteOrder = 0;
+    std::memcpy(&version, m_base + 4, sizeof(quint32));
+    std::memcpy(&byteOrder, m_base + 8, sizeof(quint32));
+    if (std::memcmp(m_base, kFileMagic, sizeof(kFileMagic)) != 0)
+    {
+        m_error = "Not a detection log";
+        close();
+        return false;
+    }
+    if (version != kVersion || byteOrder != kByteOrderTag)
+    {
+        m_error = QString("Unsupported log version %1 or byte order").arg(version);
+        close();
+        return false;
+    }
+
+    // A truncated trailing block (e.g. after a crash) ends the scan
+    qint64 offset = kFileHeaderBytes;
+    qint64 blockBytes = 0;
+    while (offset < m_size && parseBlock(offset, blockBytes))
+    {
+        offset += blockBytes;
+    }
+
+    m_error.clear();
+    return true;
+}
+
+void DetectionLogReader::close()
+{
+    if (m_base)
+    {
+        m_file.unmap(m_base);
+        m_base = nullptr;
+    }
+    if (m_file.isOpen())
+    {
+        m_file.close();
+    }
+
+    m_size = 0;
+    m_blocks.clear();
+    m_labels.clear();
+    m_labelIndex.clear();
+    m_frameCount = 0;
+    m_totalDetections = 0;
+    m_totalKeypoints = 0;
+}
+
+bool DetectionLogReader::parseBlock(qint64 offset, qint64& blockBytes)
+{
+    if (offset + static_cast<qint64>(sizeof(BlockHeader)) > m_size)
+    {
+        return false;
+    }
+
+    BlockHeader header;
+    std::memcpy(&header, m_base + offset, sizeof(header));
+    if (header.magic != kBlockMagic || header.frameCount == 0 ||
+        header.blockBytes > static_cast<quint64>(m_size - offset))
+    {
+        return false;
+    }
+
+    BlockLayout layout(header.frameCount, header.detectionCount, header.keypointCount);
+    if (layout.labels > static_cast<qint64>(header.blockBytes))
+    {
+        return false;
+    }
+
+    const uchar* base = m_base + offset;
+
+    Block block;
+    block.firstFrame = m_frameCount;
+    block.frameCount = static_cast<int>(header.frameCount);
+    block.frameIndex = reinterpret_cast<const qint64*>(base + layout.frameIndex);
+    block.timestampMs = reinterpret_cast<const double*>(base + layout.timestampMs);
+    block.detectionOffset = reinterpret_cast<const quint32*>(base + layout.detectionOffset);
+    block.keypointOffset = reinterpret_cast<const quint32*>(base + layout.keypointOffset);
+    block.boxes = reinterpret_cast<const float*>(base + layout.boxes);
+    block.scores = reinterpret_cast<const float*>(base + layout.scores);
+    block.labelIds = reinterpret_cast<const quint16*>(base + layout.labelIds);
+    block.keypoints = reinterpret_cast<const float*>(base + layout.keypoints);
+    block.keypointInts = reinterpret_cast<const qint32*>(base + layout.keypointInts);
+
+    // Offsets must be monotonic and end at the column sizes
+    for (quint32 i = 0; i < header.frameCount; ++i)
+    {
+        if (block.detectionOffset[i] > block.detectionOffset[i + 1] ||
+            block.keypointOffset[i] > block.keypointOffset[i + 1])
+        {
+            return false;
+        }
+    }
+    if (block.detectionOffset[0] != 0 || block.keypointOffset[0] != 0 ||
+        block.detectionOffset[header.frameCount] != header.detectionCount ||
+        block.keypointOffset[header.frameCount] != header.keypointCount)
+    {
+        return false;
+    }
+
+    // Intern this block's labels into the global table
+    qint64 cursor = layout.labels;
+    for (quint32 i = 0; i < header.labelCount; ++i)
+    {
+        if (cursor + 2 > static_cast<qint64>(header.blockBytes))
+        {
+            return false;
+        }
+        quint16 length = 0;
+        std::memcpy(&length, base + cursor, sizeof(length));
+        cursor += sizeof(length);
+        if (cursor + length > static_cast<qint64>(header.blockBytes))
+        {
+            return false;
+        }
+
+        QString label = QString::fromUtf8(reinterpret_cast<const char*>(base + cursor), length);
+        cursor += length;
+
+        auto found = m_labelIndex.constFind(label);
+        if (found == m_labelIndex.constEnd())
+        {
+            found = m_labelIndex.insert(label, m_labels.size());
+            m_labels.append(label);
+        }
+        block.labelMap.append(found.value());
+    }
+
+    m_blocks.append(block);
+    m_frameCount += block.frameCount;
+    m_totalDetections += header.detectionCount;
+    m_totalKeypoints += header.keypointCount;
+    blockBytes = static_cast<qint64>(header.blockBytes);
+    return true;
+}
+
+const DetectionLogReader::Block* DetectionLogReader::blockFor(int frame, int& local) const
+{
+    if (frame < 0 || frame >= m_frameCount)
+    {
+        return nullptr;
+    }
+
+    // Last block whose first frame is <= frame
+    auto it = std::upper_bound(m_blocks.begin(), m_blocks.end(), frame,
+                               [](int value, const Block& block)
+                               {
+                                   return value < block.firstFrame;
+                               });
+    const Block& block = *std::prev(it);
+    local = frame - block.firstFrame;
+    return &block;
+}
+
+qint64 DetectionLogReader::frameIndex(int frame) const
+{
+    int local = 0;
+    const Block* block = blockFor(frame, local);
+    return block ? block->frameIndex[local] : -1;
+}
+
+double DetectionLogReader::timestampMs(int frame) const
+{
+    int local = 0;
+    const Block* block = blockFor(frame, local);
+    return block ? block->timestampMs[local] : 0.0;
+}
+
+int DetectionLogReader::detectionCount(int frame) const
+{
+    int local = 0;
+    const Block* block = blockFor(frame, local);
+    return block ? static_cast<int>(block->detectionOffset[local + 1] -
+                                    block->detectionOffset[local])
+                 : 0;
+}
+
+QVector<DetectionData::Detection> DetectionLogReader::detections(int frame) const
+{
+    QVector<DetectionData::Detection> result;
+
+    int local = 0;
+    const Block* block = blockFor(frame, local);
+    if (!block)
+    {
+        return result;
+    }
+
+    const quint32 begin = block->detectionOffset[local];
+    const quint32 end = block->detectionOffset[local + 1];
+    result.reserve(static_cast<int>(end - begin));
+
+    for (quint32 i = begin; i < end; ++i)
+    {
+        const float* box = block->boxes + 4 * i;
+        const quint16 labelId = block->labelIds[i];
+        const QString label = labelId < block->labelMap.size()
+                                  ? m_labels[block->labelMap[labelId]]
+                                  : QString();
+        result.append(DetectionData::Detection(QRectF(box[0], box[1], box[2], box[3]),
+                                               label,
+                                               block->scores[i]));
+    }
+
+    return result;
+}
+
+std::vector<cv::KeyPoint> DetectionLogReader::keypoints(int frame) const
+{
+    std::vector<cv::KeyPoint> result;
+
+    int local = 0;
+    const Block* block = blockFor(frame, local);
+    if (!block)
+    {
+        return result;
+    }
+
+    const quint32 begin = block->keypointOffset[local];
+    const quint32 end = block->keypointOffset[local + 1];
+    result.reserve(end - begin);
+
+    for (quint32 i = begin; i < end; ++i)
+    {
+        const float* values = block->keypoints + 5 * i;
+        const qint32* ints = block->keypointInts + 2 * i;
+        result.emplace_back(values[0], values[1], values[2], values[3], values[4],
+                            ints[0], ints[1]);
+    }
+
+    return result;
+}
+
+} // namespace VisionBox
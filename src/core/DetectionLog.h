@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Binary Columnar Detection / Keypoint Log
+ ******************************************************************************/
+
+#ifndef VISIONBOX_DETECTION_LOG_H
+#define VISIONBOX_DETECTION_LOG_H
+
+#include "VisionDataTypes.h"
+#include <QString>
+#include <QStringList>
+#include <QByteArray>
+#include <QHash>
+#include <QVector>
+#include <QFile>
+#include <opencv2/core/types.hpp>
+#include <vector>
+
+namespace VisionBox {
+
+/**
+ * @brief On-disk layout of a detection log (.vbdl)
+ *
+ * A file is a 16-byte file header followed by self-contained blocks, so a
+ * log can be appended to, rotated, or cut short by a crash and still read.
+ * Each block stores up to a few hundred frames column by column; every
+ * column starts on an 8-byte boundary and is read in place from the mapping:
+ *
+ *   BlockHeader
+ *   int64   frameIndex[F]
+ *   double  timestampMs[F]
+ *   uint32  detectionOffset[F + 1]      (into the detection columns)
+ *   uint32  keypointOffset[F + 1]       (into the keypoint columns)
+ *   float   box[D][4]                   (x, y, w, h, normalized)
+ *   float   score[D]
+ *   uint16  labelId[D]                  (into this block's label table)
+ *   float   keypoint[K][5]              (x, y, size, angle, response)
+ *   int32   keypointInt[K][2]           (octave, class_id)
+ *   label table: { uint16 length, UTF-8 bytes } x L
+ *
+ * Values are stored in host byte order; the file header records it.
+ */
+namespace DetectionLogFormat {
+
+constexpr char kFileMagic[4] = {'V', 'B', 'D', 'L'};
+constexpr quint32 kVersion = 1;
+constexpr quint32 kByteOrderTag = 0x01020304;
+constexpr quint32 kBlockMagic = 0x4B424256; // "VBBK"
+constexpr qint64 kFileHeaderBytes = 16;
+
+struct BlockHeader
+{
+    quint32 magic = kBlockMagic;
+    quint32 frameCount = 0;
+    quint32 detectionCount = 0;
+    quint32 keypointCount = 0;
+    quint32 labelCount = 0;
+    quint32 reserved = 0;
+    quint64 blockBytes = 0;         // Including this header
+};
+
+} // namespace DetectionLogFormat
+
+/**
+ * @brief Accumulates frames and encodes them into log blocks
+ *
+ * Not thread-safe; the encoded blocks are plain byte arrays that can be
+ * handed to any writer (e.g. a background file writer).
+ */
+class DetectionLogEncoder
+{
+public:
+    explicit DetectionLogEncoder(int framesPerBlock = 256);
+
+    // Bytes that must start every log file
+    static QByteArray fileHeader();
+
+    // Add one frame; returns true once the current block is full
+    bool addFrame(qint64 frameIndex,
+                  double timestampMs,
+                  const QVector<DetectionData::Detection>& detections,
+                  const std::vector<cv::KeyPoint>& keypoints = {});
+
+    int pendingFrames() const { return static_cast<int>(m_frameIndex.size()); }
+    int framesPerBlock() const { return m_framesPerBlock; }
+
+    // Encode the pending frames as one block and start a new one
+    QByteArray takeBlock();
+
+private:
+    void reset();
+
+    int m_framesPerBlock;
+    std::vector<qint64> m_frameIndex;
+    std::vector<double> m_timestampMs;
+    std::vector<quint32> m_detectionOffset;
+    std::vector<quint32> m_keypointOffset;
+    std::vector<float> m_boxes;
+    std::vector<float> m_scores;
+    std::vector<quint16> m_labelIds;
+    std::vector<float> m_keypoints;
+    std::vector<qint32> m_keypointInts;
+    QHash<QString, quint16> m_labelIndex;   // Label -> id within the block
+    QStringList m_labels;
+};
+
+/**
+ * @brief Memory-mapped, random-access reader for detection logs
+ *
+ * open() maps the file and walks the block headers once; frames are then
+ * served straight from the mapped columns. Labels from all blocks are
+ * interned into one table, so repeated labels share a single QString.
+ */
+class DetectionLogReader
+{
+public:
+    DetectionLogReader() = default;
+    ~DetectionLogReader();
+
+    bool open(const QString& filePath);
+    void close();
+    bool isOpen() const { return m_base != nullptr; }
+    QString errorString() const { return m_error; }
+
+    int frameCount() const { return m_frameCount; }
+    qint64 totalDetections() const { return m_totalDetections; }
+    qint64 totalKeypoints() const { return m_totalKeypoints; }
+    QStringList labels() const { return m_labels; }
+
+    // Per-frame access (frame in [0, frameCount))
+    qint64 frameIndex(int frame) const;
+    double timestampMs(int frame) const;
+    int detectionCount(int frame) const;
+    QVector<DetectionData::Detection> detections(int frame) const;
+    std::vector<cv::KeyPoint> keypoints(int frame) const;
+
+private:
+    struct Block
+    {
+        int firstFrame = 0;
+        int frameCount = 0;
+        const qint64* frameIndex = nullptr;
+        const double* timestampMs = nullptr;
+        const quint32* detectionOffset = nullptr;
+        const quint32* keypointOffset = nullptr;
+        const float* boxes = nullptr;
+        const float* scores = nullptr;
+        const quint16* labelIds = nullptr;
+        const float* keypoints = nullptr;
+        const qint32* keypointInts = nullptr;
+        QVector<int> labelMap;          // Block label id -> m_labels index
+    };
+
+    const Block* blockFor(int frame, int& local) const;
+    bool parseBlock(qint64 offset, qint64& blockBytes);
+
+    QFile m_file;
+    uchar* m_base = nullptr;
+    qint64 m_size = 0;
+    QVector<Block> m_blocks;
+    QStringList m_labels;
+    QHash<QString, int> m_labelIndex;
+    int m_frameCount = 0;
+    qint64 m_totalDetections = 0;
+    qint64 m_totalKeypoints = 0;
+    QString m_error;
+
+    // Prevent copy
+    DetectionLogReader(const DetectionLogReader&) = delete;
+    DetectionLogReader& operator=(const DetectionLogReader&) = delete;
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_DETECTION_LOG_H
@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * DNN Batcher Implementation
+ ******************************************************************************/
+
+#include "DnnBatcher.h"
+#include <QElapsedTimer>
+#include <QMutexLocker>
+#include <algorithm>
+#include <exception>
+#include <map>
+
+namespace VisionBox {
+
+/*******************************************************************************
+ * DnnBatcher Implementation
+ ******************************************************************************/
+DnnBatcher::DnnBatcher(std::shared_ptr<SharedDnnNet> network)
+    : m_network(std::move(network))
+{
+}
+
+std::shared_ptr<DnnBatcher> DnnBatcher::forNetwork(const std::shared_ptr<SharedDnnNet>& network)
+{
+    static QMutex registryMutex;
+    static std::map<const SharedDnnNet*, std::weak_ptr<DnnBatcher>> registry;
+
+    QMutexLocker locker(&registryMutex);
+
+    // Forget batchers whose users are all gone
+    for (auto it = registry.begin(); it != registry.end();)
+    {
+        it = it->second.expired() ? registry.erase(it) : std::next(it);
+    }
+
+    std::shared_ptr<DnnBatcher> batcher = registry[network.get()].lock();
+    if (!batcher)
+    {
+        batcher = std::make_shared<DnnBatcher>(network);
+        registry[network.get()] = batcher;
+    }
+    return batcher;
+}
+
+std::vector<cv::Mat> DnnBatcher::infer(const cv::Mat& image, const BlobParams& params,
+                                       const Limits& limits)
+{
+    QMutexLocker locker(&m_mutex);
+
+    // Join an open batch with the same preprocessing, or open one
+    std::shared_ptr<Batch> batch;
+    for (const std::shared_ptr<Batch>& open : m_open)
+    {
+        if (open->params == params && static_cast<int>(open->images.size()) < open->capacity)
+        {
+            batch = open;
+            break;
+        }
+    }
+
+    const bool leader = !batch;
+    if (leader)
+    {
+        batch = std::make_shared<Batch>();
+        batch->params = params;
+        batch->capacity = std::max(1, limits.maxBatchSize);
+        m_open.push_back(batch);
+    }
+
+    const size_t index = batch->images.size();
+    batch->images.push_back(image);
+
+    if (leader)
+    {
+        // Wait for the batch to fill, within the latency budget
+        QElapsedTimer timer;
+        timer.start();
+        while (static_cast<int>(batch->images.size()) < batch->capacity)
+        {
+            const qint64 remaining = limits.maxWaitMs - timer.elapsed();
+            if (remaining <= 0)
+            {
+                break;
+            }
+            batch->changed.wait(&m_mutex, static_cast<unsigned long>(remaining));
+        }
+
+        // Stop accepting frames
+        m_open.erase(std::find(m_open.begin(), m_open.end(), batch));
+
+        // Closed batches are only touched by this thread until done is set
+        locker.unlock();
+        runBatch(*batch);
+        locker.relock();
+
+        batch->done = true;
+        m_stats.batches++;
+        m_stats.frames += static_cast<qint64>(batch->images.size());
+        batch->changed.wakeAll();
+    }
+    else
+    {
+        if (static_cast<int>(batch->images.size()) >= batch->capacity)
+        {
+            batch->changed.wakeAll();
+        }
+        while (!batch->done)
+        {
+            batch->changed.wait(&m_mutex);
+        }
+    }
+
+    if (!batch->error.isEmpty())
+    {
+        CV_Error(cv::Error::StsError, batch->error.toStdString());
+    }
+    return std::move(batch->results[index]);
+}
+
+DnnBatcher::Stats DnnBatcher::stats() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_stats;
+}
+
+void DnnBatcher::runBatch(Batch& batch)
+{
+    const int count = static_cast<int>(batch.images.size());
+
+    // Nothing may escape: the frames waiting on this batch need done and the error
+    try
+    {
+        batch.results.resize(count);
+        cv::Mat blob = m_preprocessor.processBatch(batch.images, batch.params);
+
+        SharedDnnNet::Lease lease = m_network->lease();
+        lease.net().setInput(blob);
+
+        std::vector<cv::Mat> outputs;
+        lease.net().forward(outputs);
+
+        // Slices are copies: the context's buffers are reused by the next batch
+        for (int i = 0; i < count; ++i)
+        {
+            batch.results[i].reserve(outputs.size());
+            for (const cv::Mat& output : outputs)
+            {
+                batch.results[i].push_back(sliceOutput(output, count, i));
+            }
+        }
+    }
+    catch (const cv::Exception& e)
+    {
+        batch.error = QString::fromStdString(e.what());
+    }
+    catch (const std::exception& e)
+    {
+        batch.error = QString::fromLocal8Bit(e.what());
+    }
+}
+
+cv::Mat DnnBatcher::sliceOutput(const cv::Mat& output, int batchSize, int index)
+{
+    if (batchSize <= 1)
+    {
+        return output.clone();
+    }
+
+    if (output.size[0] == batchSize)
+    {
+        std::vector<cv::Range> ranges(output.dims, cv::Range::all());
+        ranges[0] = cv::Range(index, index + 1);
+        return output(ranges.data()).clone();
+    }
+
+    if (output.dims == 2 && output.rows % batchSize == 0)
+    {
+        // Darknet region outputs stack the frames' rows
+        const int rows = output.rows / batchSize;
+        return output.rowRange(index * rows, (index + 1) * rows).clone();
+    }
+
+    CV_Error(cv::Error::StsBadSize, "Network output cannot be split by batch");
+}
+
+} // namespace VisionBox
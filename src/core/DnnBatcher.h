@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * DNN Batcher - Multi-frame, multi-stream batched forward passes
+ ******************************************************************************/
+
+#ifndef VISIONBOX_DNN_BATCHER_H
+#define VISIONBOX_DNN_BATCHER_H
+
+#include "DnnNetCache.h"
+#include "BlobPreprocessor.h"
+#include <QMutex>
+#include <QWaitCondition>
+#include <QString>
+#include <memory>
+#include <vector>
+
+namespace VisionBox {
+
+/**
+ * @brief Groups single-frame inference requests into NCHW batches
+ *
+ * Threads calling infer() concurrently with the same blob parameters join
+ * one batch: the first caller waits up to Limits::maxWaitMs for the batch
+ * to fill, writes every frame into one NCHW blob (BlobPreprocessor, so
+ * batched frames are letterboxed like single ones), runs a single forward()
+ * on a leased context and hands each caller the slice of the outputs that
+ * belongs to its frame. The batcher is shared per network (forNetwork()),
+ * so frames from one node's inference workers and from several nodes using
+ * the same model end up in the same batches.
+ *
+ * infer() blocks for up to maxWaitMs plus the forward pass and must not be
+ * called on the GUI thread.
+ */
+class DnnBatcher
+{
+public:
+    // Preprocessing applied to every frame of a batch; only frames with
+    // equal parameters are batched together
+    using BlobParams = BlobPreprocessor::Params;
+
+    // Set by the caller that opens a batch
+    struct Limits
+    {
+        int maxBatchSize = 4;
+        int maxWaitMs = 5;       // Latency budget for a batch to fill
+    };
+
+    struct Stats
+    {
+        qint64 batches = 0;
+        qint64 frames = 0;
+
+        double averageBatchSize() const
+        {
+            return batches > 0 ? static_cast<double>(frames) / batches : 0.0;
+        }
+    };
+
+    explicit DnnBatcher(std::shared_ptr<SharedDnnNet> network);
+
+    // Batcher shared by every user of this network
+    static std::shared_ptr<DnnBatcher> forNetwork(const std::shared_ptr<SharedDnnNet>& network);
+
+    // Run one frame as part of a batch; returns its outputs (batch size 1).
+    // Throws cv::Exception if the forward pass fails.
+    std::vector<cv::Mat> infer(const cv::Mat& image, const BlobParams& params,
+                               const Limits& limits);
+
+    Stats stats() const;
+    std::shared_ptr<SharedDnnNet> network() const { return m_network; }
+
+    // Slice frame 'index' out of a batched output: [N, ...] becomes
+    // [1, ...]; 2-D outputs with N * rows rows (Darknet) are split by rows
+    static cv::Mat sliceOutput(const cv::Mat& output, int batchSize, int index);
+
+private:
+    struct Batch
+    {
+        BlobParams params;
+        int capacity = 1;
+        std::vector<cv::Mat> images;
+        std::vector<std::vector<cv::Mat>> results;
+        QString error;
+        bool done = false;        // Results are ready
+        QWaitCondition changed;
+    };
+
+    void runBatch(Batch& batch);
+
+    std::shared_ptr<SharedDnnNet> m_network;
+    BlobPreprocessor m_preprocessor;
+
+    mutable QMutex m_mutex;
+    std::vector<std::shared_ptr<Batch>> m_open;   // Batches still accepting frames
+    Stats m_stats;
+
+    // Prevent copy
+    DnnBatcher(const DnnBatcher&) = delete;
+    DnnBatcher& operator=(const DnnBatcher&) = delete;
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_DNN_BATCHER_H
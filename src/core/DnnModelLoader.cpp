@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * DNN Model Loader Implementation
+ ******************************************************************************/
+
+#include "DnnModelLoader.h"
+#include <QElapsedTimer>
+#include <QMutexLocker>
+#include <algorithm>
+#include <exception>
+
+namespace VisionBox {
+
+/*******************************************************************************
+ * DnnModelLoader Implementation
+ ******************************************************************************/
+DnnModelLoader::DnnModelLoader(QObject* parent)
+    : QObject(parent)
+{
+}
+
+DnnModelLoader::~DnnModelLoader()
+{
+    m_cancel = true;
+    if (m_worker.joinable())
+    {
+        m_worker.join();
+    }
+}
+
+void DnnModelLoader::load(const Request& request)
+{
+    if (m_running)
+    {
+        // Started once the running load ends
+        m_pending = request;
+        m_hasPending = true;
+        m_cancel = true;
+        return;
+    }
+
+    start(request);
+}
+
+bool DnnModelLoader::isLoading() const
+{
+    return m_running || m_hasPending;
+}
+
+void DnnModelLoader::start(const Request& request)
+{
+    if (m_worker.joinable())
+    {
+        m_worker.join();
+    }
+
+    m_cancel = false;
+    m_running = true;
+    m_worker = std::thread(&DnnModelLoader::run, this, request);
+}
+
+void DnnModelLoader::run(Request request)
+{
+    Result result;
+    QElapsedTimer timer;
+    timer.start();
+
+    Q_EMIT progress("Loading model...", 0);
+
+    try
+    {
+        result.network = DnnNetCache::instance()->acquire(request.modelPath, request.configPath,
+                                                          request.backend, request.target);
+        result.loadMs = timer.elapsed();
+    }
+    catch (const cv::Exception& e)
+    {
+        result.error = QString::fromStdString(e.what());
+    }
+    catch (const std::exception& e)
+    {
+        result.error = QString::fromLocal8Bit(e.what());
+    }
+
+    // Nodes that lease several contexts at once get them parsed here rather
+    // than on their first frame; fewer contexts only means less parallelism
+    const int contexts = std::max(1, request.contexts);
+    if (result.network && result.network->contextCount() < contexts)
+    {
+        try
+        {
+            while (result.network->contextCount() < contexts && !m_cancel)
+            {
+                const int next = result.network->contextCount() + 1;
+                Q_EMIT progress(QString("Preparing inference contexts (%1/%2)...")
+                                    .arg(next).arg(contexts),
+                                10 + 40 * next / contexts);
+                result.network->addContext();
+            }
+        }
+        catch (const cv::Exception& e)
+        {
+            result.warning = QString::fromStdString(e.what());
+        }
+        catch (const std::exception& e)
+        {
+            result.warning = QString::fromLocal8Bit(e.what());
+        }
+    }
+
+    // A model may want another channel count or a fixed input shape than the
+    // warm-up blob; it still loads, only the warm-up is skipped
+    const int runs = std::max(0, request.warmupRuns);
+    if (result.network && runs > 0 && !request.inputSize.empty())
+    {
+        try
+        {
+            int sizes[] = {1, 3, request.inputSize.height, request.inputSize.width};
+            cv::Mat blob(4, sizes, CV_32F, cv::Scalar(0));
+
+            SharedDnnNet::Lease lease = result.network->lease();
+            std::vector<cv::Mat> outputs;
+            for (int i = 0; i < runs && !m_cancel; ++i)
+            {
+                Q_EMIT progress(QString("Warming up (%1/%2)...").arg(i + 1).arg(runs),
+                                50 + 50 * i / runs);
+
+                timer.restart();
+                lease.net().setInput(blob);
+                lease.net().forward(outputs);
+                const double ms = timer.nsecsElapsed() / 1.0e6;
+
+                if (i == 0)
+                {
+                    result.firstRunMs = ms;
+                }
+                result.steadyRunMs = ms;
+            }
+        }
+        catch (const cv::Exception& e)
+        {
+            result.warning = QString::fromStdString(e.what());
+        }
+        catch (const std::exception& e)
+        {
+            result.warning = QString::fromLocal8Bit(e.what());
+        }
+    }
+
+    {
+        QMutexLocker locker(&m_mutex);
+        m_result = std::move(result);
+    }
+
+    // Hand the result to the owning thread
+    QMetaObject::invokeMethod(this, [this]() { onWorkerDone(); }, Qt::QueuedConnection);
+}
+
+void DnnModelLoader::onWorkerDone()
+{
+    if (m_worker.joinable())
+    {
+        m_worker.join();
+    }
+
+    Result result;
+    {
+        QMutexLocker locker(&m_mutex);
+        result = std::move(m_result);
+        m_result = Result();
+    }
+    m_running = false;
+
+    if (m_hasPending)
+    {
+        // Superseded: drop this result and load the latest request
+        m_hasPending = false;
+        start(m_pending);
+        return;
+    }
+
+    Q_EMIT progress(result.error.isEmpty() ? "Ready" : "Failed", 100);
+    Q_EMIT loaded(result);
+}
+
+} // namespace VisionBox
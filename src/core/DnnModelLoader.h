@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * DNN Model Loader - Background model loading and warm-up
+ ******************************************************************************/
+
+#ifndef VISIONBOX_DNN_MODEL_LOADER_H
+#define VISIONBOX_DNN_MODEL_LOADER_H
+
+#include "DnnNetCache.h"
+#include <QObject>
+#include <QString>
+#include <QMutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace VisionBox {
+
+/**
+ * @brief Loads a network through DnnNetCache on a background thread, then
+ *        warms it up
+ *
+ * Parsing a large model and the first forward() (layer initialization,
+ * buffer allocation, backend compilation) both take seconds, so neither
+ * should run on the GUI thread. After the network is acquired, warm-up
+ * runs forward() on a zero blob of the requested input size; the warmed
+ * context goes back to the network's pool and is the one the node's next
+ * inference leases, so the first real frame sees steady-state latency.
+ *
+ * Nodes that run several forward passes at once ask for that many
+ * contexts in Request::contexts, so they are parsed here as well.
+ *
+ * A warm-up that fails (e.g. the model expects another input shape) does
+ * not fail the load: the network is delivered with Result::warning set.
+ *
+ * Signals are delivered on the thread that owns the loader. Calling load()
+ * while a load is running supersedes it: warm-up of the old request stops
+ * early, its result is dropped and the new request starts once it ends.
+ */
+class DnnModelLoader : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Request
+    {
+        QString modelPath;
+        QString configPath;
+        int backend = cv::dnn::DNN_BACKEND_OPENCV;
+        int target = cv::dnn::DNN_TARGET_CPU;
+        cv::Size inputSize;        // Warm-up blob size (NCHW, 3 channels)
+        int warmupRuns = 2;        // 0 disables warm-up
+        int contexts = 1;          // Inference contexts parsed before delivery
+    };
+
+    struct Result
+    {
+        std::shared_ptr<SharedDnnNet> network;
+        QString error;             // Empty on success
+        QString warning;           // Warm-up or extra context failed; network still usable
+        qint64 loadMs = 0;         // Acquire (parse, or cache hit)
+        double firstRunMs = 0.0;   // First warm-up forward()
+        double steadyRunMs = 0.0;  // Last warm-up forward()
+    };
+
+    explicit DnnModelLoader(QObject* parent = nullptr);
+    ~DnnModelLoader() override;   // Waits for a running load to finish
+
+    void load(const Request& request);
+    bool isLoading() const;
+
+signals:
+    // Stage description and overall percentage (0-100)
+    void progress(const QString& stage, int percent);
+
+    // Emitted once per load that was not superseded
+    void loaded(const VisionBox::DnnModelLoader::Result& result);
+
+private:
+    void start(const Request& request);
+    void run(Request request);
+    void onWorkerDone();
+
+    std::thread m_worker;
+    std::atomic<bool> m_running{false};
+    std::atomic<bool> m_cancel{false};
+
+    mutable QMutex m_mutex;
+    Result m_result;               // Guarded by m_mutex
+    Request m_pending;
+    bool m_hasPending = false;
+
+    // Prevent copy
+    DnnModelLoader(const DnnModelLoader&) = delete;
+    DnnModelLoader& operator=(const DnnModelLoader&) = delete;
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_DNN_MODEL_LOADER_H
@@ -0,0 +1,281 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Shared DNN Network Cache Implementation
+ ******************************************************************************/
+
+#include "DnnNetCache.h"
+#include <QFileInfo>
+#include <QDateTime>
+#include <QMutexLocker>
+#include <algorithm>
+
+namespace VisionBox {
+
+namespace {
+
+// Identity of a model file: changes when the file is rebuilt
+QString fileKey(const QString& filePath)
+{
+    if (filePath.isEmpty())
+    {
+        return QString();
+    }
+
+    QFileInfo info(filePath);
+    if (!info.exists())
+    {
+        return filePath;
+    }
+
+    return QString("%1@%2:%3")
+        .arg(info.canonicalFilePath())
+        .arg(info.lastModified().toMSecsSinceEpoch())
+        .arg(info.size());
+}
+
+} // namespace
+
+/*******************************************************************************
+ * SharedDnnNet::Lease
+ ******************************************************************************/
+SharedDnnNet::Lease::Lease(std::shared_ptr<SharedDnnNet> owner, cv::dnn::Net net)
+    : m_owner(std::move(owner))
+    , m_net(std::move(net))
+{
+}
+
+SharedDnnNet::Lease::Lease(Lease&& other) noexcept
+    : m_owner(std::move(other.m_owner))
+    , m_net(std::move(other.m_net))
+{
+    other.m_owner.reset();
+}
+
+SharedDnnNet::Lease& SharedDnnNet::Lease::operator=(Lease&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (m_owner)
+        {
+            m_owner->giveBack(std::move(m_net));
+        }
+        m_owner = std::move(other.m_owner);
+        m_net = std::move(other.m_net);
+        other.m_owner.reset();
+    }
+    return *this;
+}
+
+SharedDnnNet::Lease::~Lease()
+{
+    if (m_owner)
+    {
+        m_owner->giveBack(std::move(m_net));
+    }
+}
+
+/*******************************************************************************
+ * SharedDnnNet
+ ******************************************************************************/
+SharedDnnNet::SharedDnnNet(const QString& modelPath, const QString& configPath,
+                           int backend, int target)
+    : m_modelPath(modelPath)
+    , m_configPath(configPath)
+    , m_backend(backend)
+    , m_target(target)
+{
+}
+
+SharedDnnNet::Lease SharedDnnNet::lease()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        if (!m_idle.empty())
+        {
+            cv::dnn::Net net = std::move(m_idle.back());
+            m_idle.pop_back();
+            return Lease(shared_from_this(), std::move(net));
+        }
+    }
+
+    // Every context is busy on another thread: parse one more
+    cv::dnn::Net net = createContext();
+
+    QMutexLocker locker(&m_mutex);
+    m_contextCount++;
+    return Lease(shared_from_this(), std::move(net));
+}
+
+SharedDnnNet::Lease SharedDnnNet::tryLease()
+{
+    QMutexLocker locker(&m_mutex);
+    if (m_idle.empty())
+    {
+        return Lease();
+    }
+
+    cv::dnn::Net net = std::move(m_idle.back());
+    m_idle.pop_back();
+    return Lease(shared_from_this(), std::move(net));
+}
+
+void SharedDnnNet::preload()
+{
+    QMutexLocker loadLocker(&m_loadMutex);
+    if (contextCount() == 0)
+    {
+        lease();
+    }
+}
+
+void SharedDnnNet::addContext()
+{
+    cv::dnn::Net net = createContext();
+
+    QMutexLocker locker(&m_mutex);
+    m_contextCount++;
+    m_idle.push_back(std::move(net));
+}
+
+int SharedDnnNet::contextCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_contextCount;
+}
+
+cv::dnn::Net SharedDnnNet::createContext() const
+{
+    cv::dnn::Net net = cv::dnn::readNet(m_modelPath.toStdString(),
+                                        m_configPath.toStdString());
+    if (net.empty())
+    {
+        CV_Error(cv::Error::StsError,
+                 "Failed to load network from " + m_modelPath.toStdString());
+    }
+
+    net.setPreferableBackend(m_backend);
+    net.setPreferableTarget(m_target);
+    return net;
+}
+
+void SharedDnnNet::giveBack(cv::dnn::Net net)
+{
+    QMutexLocker locker(&m_mutex);
+    m_idle.push_back(std::move(net));
+}
+
+/*******************************************************************************
+ * DnnNetCache
+ ******************************************************************************/
+DnnNetCache* DnnNetCache::instance()
+{
+    static DnnNetCache cache;
+    return &cache;
+}
+
+std::shared_ptr<SharedDnnNet> DnnNetCache::acquire(const QString& modelPath,
+                                                   const QString& configPath,
+                                                   int backend,
+                                                   int target)
+{
+    const QString key = QString("%1|%2|%3|%4")
+                            .arg(fileKey(modelPath))
+                            .arg(fileKey(configPath))
+                            .arg(backend)
+                            .arg(target);
+
+    std::shared_ptr<SharedDnnNet> network;
+    {
+        QMutexLocker locker(&m_mutex);
+
+        auto found = m_networks.find(key);
+        if (found != m_networks.end())
+        {
+            m_order.removeOne(key);
+            m_order.append(key);
+            network = found.value();
+        }
+        else
+        {
+            // Register before parsing so concurrent loads of the same model
+            // wait for this one instead of parsing it again
+            network = std::make_shared<SharedDnnNet>(modelPath, configPath, backend, target);
+            m_networks.insert(key, network);
+            m_order.append(key);
+            trimIdle(m_maxIdleNetworks);
+        }
+    }
+
+    try
+    {
+        network->preload();
+    }
+    catch (...)
+    {
+        QMutexLocker locker(&m_mutex);
+        auto found = m_networks.constFind(key);
+        if (found != m_networks.constEnd() && found.value() == network)
+        {
+            m_networks.remove(key);
+            m_order.removeOne(key);
+        }
+        throw;
+    }
+
+    return network;
+}
+
+void DnnNetCache::setMaxIdleNetworks(int count)
+{
+    QMutexLocker locker(&m_mutex);
+    m_maxIdleNetworks = std::max(0, count);
+    trimIdle(m_maxIdleNetworks);
+}
+
+int DnnNetCache::maxIdleNetworks() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_maxIdleNetworks;
+}
+
+int DnnNetCache::networkCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_networks.size();
+}
+
+void DnnNetCache::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    trimIdle(0);
+}
+
+void DnnNetCache::trimIdle(int keep)
+{
+    // Idle = only referenced by the cache; drop the least recently acquired
+    int idle = 0;
+    for (const QString& key : m_order)
+    {
+        if (m_networks.constFind(key).value().use_count() == 1)
+        {
+            idle++;
+        }
+    }
+
+    for (int i = 0; i < m_order.size() && idle > keep;)
+    {
+        const QString key = m_order.at(i);
+        if (m_networks.constFind(key).value().use_count() == 1)
+        {
+            m_networks.remove(key);
+            m_order.removeAt(i);
+            idle--;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+} // namespace VisionBox
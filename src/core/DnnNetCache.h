@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Shared DNN Network Cache
+ ******************************************************************************/
+
+#ifndef VISIONBOX_DNN_NET_CACHE_H
+#define VISIONBOX_DNN_NET_CACHE_H
+
+#include <QString>
+#include <QHash>
+#include <QMutex>
+#include <opencv2/dnn.hpp>
+#include <memory>
+#include <vector>
+
+namespace VisionBox {
+
+/**
+ * @brief One loaded network, shared by every node using the same model
+ *
+ * A cv::dnn::Net keeps its activations next to its weights and is not safe
+ * to run from two threads at once, so the network hands out inference
+ * contexts through lease(). A thread that runs inference sequentially
+ * always gets the same context back; a second context is only parsed while
+ * another thread is holding the first one.
+ */
+class SharedDnnNet : public std::enable_shared_from_this<SharedDnnNet>
+{
+public:
+    /**
+     * @brief Exclusive use of one inference context until destroyed
+     *
+     * Outputs of forward() may alias the context's buffers, so keep the
+     * lease until they have been consumed.
+     */
+    class Lease
+    {
+    public:
+        Lease() = default;
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        ~Lease();
+
+        cv::dnn::Net& net() { return m_net; }
+        bool isValid() const { return m_owner != nullptr; }
+
+    private:
+        friend class SharedDnnNet;
+        Lease(std::shared_ptr<SharedDnnNet> owner, cv::dnn::Net net);
+
+        std::shared_ptr<SharedDnnNet> m_owner;
+        cv::dnn::Net m_net;
+    };
+
+    SharedDnnNet(const QString& modelPath, const QString& configPath,
+                 int backend, int target);
+
+    // Borrow an idle context, parsing a new one if all are in use.
+    // Throws cv::Exception if the model cannot be read.
+    Lease lease();
+
+    // Borrow an idle context; an invalid lease if all are in use (never parses)
+    Lease tryLease();
+
+    // Parse the first context now unless one exists; concurrent callers
+    // wait for the first parse instead of starting their own
+    void preload();
+
+    // Parse one more idle context, for callers that lease several at once.
+    // Throws cv::Exception if the model cannot be read.
+    void addContext();
+
+    QString modelPath() const { return m_modelPath; }
+    QString configPath() const { return m_configPath; }
+    int backend() const { return m_backend; }
+    int target() const { return m_target; }
+
+    // Number of parsed contexts (one per concurrently executing thread)
+    int contextCount() const;
+
+private:
+    cv::dnn::Net createContext() const;
+    void giveBack(cv::dnn::Net net);
+
+    const QString m_modelPath;
+    const QString m_configPath;
+    const int m_backend;
+    const int m_target;
+
+    QMutex m_loadMutex;
+    mutable QMutex m_mutex;
+    std::vector<cv::dnn::Net> m_idle;
+    int m_contextCount = 0;
+
+    // Prevent copy
+    SharedDnnNet(const SharedDnnNet&) = delete;
+    SharedDnnNet& operator=(const SharedDnnNet&) = delete;
+};
+
+/**
+ * @brief Process-wide cache of loaded DNN networks
+ *
+ * Entries are keyed by canonical model and config path, their modification
+ * times, and the preferable backend and target, so several detector nodes
+ * on the same model share one parsed network and a rebuilt model file is
+ * loaded again. Networks stay alive while any node holds them; a few idle
+ * ones are kept so reopening a project does not parse them again.
+ *
+ * The framework is picked from the file extensions (see cv::dnn::readNet).
+ * Thread-safe; parsing happens outside the cache lock.
+ */
+class DnnNetCache
+{
+public:
+    static DnnNetCache* instance();
+
+    // Shared network for a model, loading its first context if needed.
+    // Throws cv::Exception if the model cannot be read.
+    std::shared_ptr<SharedDnnNet> acquire(const QString& modelPath,
+                                          const QString& configPath = QString(),
+                                          int backend = cv::dnn::DNN_BACKEND_OPENCV,
+                                          int target = cv::dnn::DNN_TARGET_CPU);
+
+    // Networks kept alive after their last user released them
+    void setMaxIdleNetworks(int count);
+    int maxIdleNetworks() const;
+
+    // Number of cached networks (in use or idle)
+    int networkCount() const;
+
+    // Drop idle networks (networks in use stay with their users)
+    void clear();
+
+private:
+    DnnNetCache() = default;
+    ~DnnNetCache() = default;
+
+    void trimIdle(int keep);   // Caller holds m_mutex
+
+    mutable QMutex m_mutex;
+    QHash<QString, std::shared_ptr<SharedDnnNet>> m_networks;
+    QList<QString> m_order;    // Keys, most recently acquired last
+    int m_maxIdleNetworks = 2;
+
+    // Prevent copy
+    DnnNetCache(const DnnNetCache&) = delete;
+    DnnNetCache& operator=(const DnnNetCache&) = delete;
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_DNN_NET_CACHE_H
@@ -0,0 +1,50 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Export Naming Implementation
+ ******************************************************************************/
+
+#include "ExportNaming.h"
+#include <QDir>
+#include <QFileInfo>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+
+namespace VisionBox {
+
+/*******************************************************************************
+ * ExportNaming Implementation
+ ******************************************************************************/
+QString ExportNaming::timestamp()
+{
+    return timestamp(QDateTime::currentDateTime());
+}
+
+QString ExportNaming::timestamp(const QDateTime& time)
+{
+    return time.toString("yyyyMMdd_HHmmss_zzz");
+}
+
+QString ExportNaming::uniqueStem(const QString& directory, const QString& stem,
+                                 const QString& probeSuffix)
+{
+    // Names handed out so far; one entry per export run, not per file
+    static QMutex mutex;
+    static QSet<QString> issued;
+
+    const QDir dir(directory);
+    QMutexLocker locker(&mutex);
+    for (int n = 1;; ++n)
+    {
+        const QString candidate = n == 1 ? stem : QString("%1_%2").arg(stem).arg(n);
+        const QString probe = QFileInfo(dir.absoluteFilePath(candidate + probeSuffix))
+                                  .absoluteFilePath();
+        if (!issued.contains(probe) && !QFileInfo::exists(probe))
+        {
+            issued.insert(probe);
+            return candidate;
+        }
+    }
+}
+
+} // namespace VisionBox
@@ -0,0 +1,39 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Export Naming - Collision-free names for exported files
+ ******************************************************************************/
+
+#ifndef VISIONBOX_EXPORT_NAMING_H
+#define VISIONBOX_EXPORT_NAMING_H
+
+#include <QDateTime>
+#include <QString>
+
+namespace VisionBox {
+
+/**
+ * @brief File names for exporter nodes that never overwrite another run
+ *
+ * A second-resolution timestamp is not unique: two exporters started from
+ * the same trigger, or one restarted quickly, get the same name and the
+ * later run overwrites (or appends to) the earlier one. uniqueStem() adds
+ * a counter when a name is taken on disk or was already handed out by this
+ * process (covering writers that have not created their file yet).
+ */
+class ExportNaming
+{
+public:
+    // Local time with milliseconds, e.g. 20250127_143000_123
+    static QString timestamp();
+    static QString timestamp(const QDateTime& time);
+
+    // 'stem', or stem_2, stem_3, ... when directory/<stem><probeSuffix>
+    // exists or was returned before. probeSuffix is the part that follows
+    // the stem in the first file written (e.g. "_000000.png" or ".csv").
+    static QString uniqueStem(const QString& directory, const QString& stem,
+                              const QString& probeSuffix);
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_EXPORT_NAMING_H
@@ -0,0 +1,563 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Flight Recorder Implementation
+ ******************************************************************************/
+
+#include "FlightRecorder.h"
+#include "VisionDataTypes.h"
+#include "DetectionLog.h"
+#include "FrameCodec.h"
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QMutexLocker>
+#include <QRegularExpression>
+#include <QtEndian>
+#include <QVector>
+#include <algorithm>
+
+namespace VisionBox {
+
+namespace {
+
+// Default memory cap: 256 MB of compressed outputs
+constexpr qint64 kDefaultCapacityBytes = 256LL * 1024 * 1024;
+
+// Outputs waiting for the encoder before new ones are skipped
+constexpr int kEncoderQueueCapacity = 16;
+
+// NumPy dtype string for an OpenCV depth
+QString npyDescr(int depth)
+{
+    switch (depth)
+    {
+        case CV_8U:  return "|u1";
+        case CV_8S:  return "|i1";
+        case CV_16U: return "<u2";
+        case CV_16S: return "<i2";
+        case CV_32S: return "<i4";
+        case CV_32F: return "<f4";
+        case CV_64F: return "<f8";
+        case CV_16F: return "<f2";
+        default:     return QString();
+    }
+}
+
+// NPY v1.0 header for an (N, H, W, C) array, padded to 64 bytes
+QByteArray npyHeader(int frames, int rows, int cols, int type)
+{
+    QByteArray dict = QString("{'descr': '%1', 'fortran_order': False, 'shape': (%2, %3, %4, %5), }")
+                          .arg(npyDescr(CV_MAT_DEPTH(type)))
+                          .arg(frames)
+                          .arg(rows)
+                          .arg(cols)
+                          .arg(CV_MAT_CN(type))
+                          .toLatin1();
+
+    const int preamble = 10;
+    int padding = 64 - (preamble + dict.size() + 1) % 64;
+    dict.append(QByteArray(padding % 64, ' '));
+    dict.append('\n');
+
+    QByteArray header("\x93NUMPY\x01\x00", 8);
+    quint16 length = qToLittleEndian<quint16>(static_cast<quint16>(dict.size()));
+    header.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    header.append(dict);
+    return header;
+}
+
+QString sanitizeName(const QString& name)
+{
+    QString result = name;
+    result.replace(QRegularExpression("[^A-Za-z0-9_-]+"), "_");
+    return result.isEmpty() ? QString("node") : result;
+}
+
+} // namespace
+
+/*******************************************************************************
+ * FlightRecorder Implementation
+ ******************************************************************************/
+FlightRecorder::FlightRecorder()
+    : m_queue(kEncoderQueueCapacity, QueueOverflowPolicy::DropNewest)
+    , m_capacityBytes(kDefaultCapacityBytes)
+{
+    m_encoder = std::thread(&FlightRecorder::encoderLoop, this);
+}
+
+FlightRecorder::~FlightRecorder()
+{
+    m_queue.close();
+    if (m_encoder.joinable())
+    {
+        m_encoder.join();
+    }
+}
+
+FlightRecorder* FlightRecorder::instance()
+{
+    static FlightRecorder recorder;
+    return &recorder;
+}
+
+/*******************************************************************************
+ * Node Selection
+ ******************************************************************************/
+void FlightRecorder::setRecordAll(bool enabled)
+{
+    QMutexLocker locker(&m_mutex);
+    m_recordAll = enabled;
+}
+
+bool FlightRecorder::recordAll() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_recordAll;
+}
+
+void FlightRecorder::setNodeEnabled(const void* nodeInstance, bool enabled)
+{
+    QMutexLocker locker(&m_mutex);
+    if (enabled)
+    {
+        m_enabledNodes.insert(nodeInstance);
+    }
+    else
+    {
+        m_enabledNodes.remove(nodeInstance);
+    }
+}
+
+bool FlightRecorder::isNodeEnabled(const void* nodeInstance) const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_recordAll || m_enabledNodes.contains(nodeInstance);
+}
+
+void FlightRecorder::removeNode(const void* nodeInstance)
+{
+    QMutexLocker locker(&m_mutex);
+    m_enabledNodes.remove(nodeInstance);
+
+    for (auto it = m_rings.begin(); it != m_rings.end();)
+    {
+        if (it.key().first == nodeInstance)
+        {
+            while (!it.value().entries.empty())
+            {
+                popFront(it.value());
+            }
+            it = m_rings.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+/*******************************************************************************
+ * Recording
+ ******************************************************************************/
+void FlightRecorder::record(const void* nodeInstance,
+                            const QString& nodeCaption,
+                            int port,
+                            const std::shared_ptr<QtNodes::NodeData>& data)
+{
+    if (!data)
+    {
+        return;
+    }
+
+    {
+        QMutexLocker locker(&m_mutex);
+        if (!m_recordAll && !m_enabledNodes.contains(nodeInstance))
+        {
+            return;
+        }
+    }
+
+    // Only a reference is queued; the encoder thread does the work
+    Job job;
+    job.node = nodeInstance;
+    job.caption = nodeCaption;
+    job.port = port;
+    job.wallMs = static_cast<double>(QDateTime::currentMSecsSinceEpoch());
+    job.data = data;
+    m_queue.push(std::move(job));
+}
+
+void FlightRecorder::encoderLoop()
+{
+    Job job;
+    while (m_queue.pop(job))
+    {
+        Entry entry;
+        if (encode(job, entry))
+        {
+            insert(job, std::move(entry));
+        }
+        job.data.reset();
+    }
+}
+
+bool FlightRecorder::encode(const Job& job, Entry& entry) const
+{
+    if (auto image = std::dynamic_pointer_cast<ImageData>(job.data))
+    {
+        cv::Mat mat = image->image();
+        if (mat.empty())
+        {
+            return false;
+        }
+
+        entry.kind = Kind::Image;
+        entry.rows = mat.rows;
+        entry.cols = mat.cols;
+        entry.type = mat.type();
+        entry.frameIndex = image->frameIndex();
+        entry.timestampMs = image->timestampMs();
+        entry.rawBytes = static_cast<qint64>(mat.total() * mat.elemSize());
+        entry.payload = FrameCodec::encode(mat);
+        return !entry.payload.isEmpty();
+    }
+
+    if (auto detections = std::dynamic_pointer_cast<DetectionData>(job.data))
+    {
+        DetectionLogEncoder encoder(1);
+        encoder.addFrame(-1, job.wallMs, detections->detections());
+        entry.kind = Kind::Detections;
+        entry.payload = encoder.takeBlock();
+        entry.rawBytes = entry.payload.size();
+        return true;
+    }
+
+    if (auto keypoints = std::dynamic_pointer_cast<KeypointData>(job.data))
+    {
+        DetectionLogEncoder encoder(1);
+        encoder.addFrame(-1, job.wallMs, {}, keypoints->keypoints());
+        entry.kind = Kind::Keypoints;
+        entry.payload = encoder.takeBlock();
+        entry.rawBytes = entry.payload.size();
+        return true;
+    }
+
+    return false;
+}
+
+void FlightRecorder::insert(const Job& job, Entry entry)
+{
+    QMutexLocker locker(&m_mutex);
+
+    // The node may have been removed or deselected while encoding
+    if (!m_recordAll && !m_enabledNodes.contains(job.node))
+    {
+        return;
+    }
+
+    const qint64 bytes = entry.payload.size();
+    if (bytes > m_capacityBytes)
+    {
+        return;
+    }
+
+    Ring& ring = m_rings[RingKey(job.node, job.port)];
+    ring.caption = job.caption;
+    while (!ring.entries.empty() &&
+           static_cast<int>(ring.entries.size()) >= m_framesPerNode)
+    {
+        popFront(ring);
+    }
+
+    evictToFit(bytes);
+
+    entry.wallMs = job.wallMs;
+    entry.sequence = m_nextSequence++;
+    m_storedBytes += bytes;
+    m_rawBytes += entry.rawBytes;
+    ring.entries.push_back(std::move(entry));
+}
+
+void FlightRecorder::evictToFit(qint64 incomingBytes)
+{
+    while (m_storedBytes + incomingBytes > m_capacityBytes)
+    {
+        // Drop the globally oldest output
+        Ring* oldest = nullptr;
+        for (auto& ring : m_rings)
+        {
+            if (!ring.entries.empty() &&
+                (!oldest || ring.entries.front().sequence < oldest->entries.front().sequence))
+            {
+                oldest = &ring;
+            }
+        }
+
+        if (!oldest)
+        {
+            break;
+        }
+        popFront(*oldest);
+        m_evicted++;
+    }
+}
+
+void FlightRecorder::popFront(Ring& ring)
+{
+    m_storedBytes -= ring.entries.front().payload.size();
+    m_rawBytes -= ring.entries.front().rawBytes;
+    ring.entries.pop_front();
+}
+
+/*******************************************************************************
+ * Limits
+ ******************************************************************************/
+void FlightRecorder::setFramesPerNode(int frames)
+{
+    QMutexLocker locker(&m_mutex);
+    m_framesPerNode = std::max(1, frames);
+    for (auto& ring : m_rings)
+    {
+        while (static_cast<int>(ring.entries.size()) > m_framesPerNode)
+        {
+            popFront(ring);
+        }
+    }
+}
+
+int FlightRecorder::framesPerNode() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_framesPerNode;
+}
+
+void FlightRecorder::setCapacityBytes(qint64 bytes)
+{
+    QMutexLocker locker(&m_mutex);
+    m_capacityBytes = std::max<qint64>(0, bytes);
+    evictToFit(0);
+}
+
+qint64 FlightRecorder::capacityBytes() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_capacityBytes;
+}
+
+void FlightRecorder::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_rings.clear();
+    m_storedBytes = 0;
+    m_rawBytes = 0;
+    m_evicted = 0;
+}
+
+FlightRecorderStats FlightRecorder::stats() const
+{
+    FlightRecorderStats stats;
+    stats.dropped = m_queue.droppedCount();
+
+    QMutexLocker locker(&m_mutex);
+    for (const auto& ring : m_rings)
+    {
+        stats.frames += static_cast<qint64>(ring.entries.size());
+    }
+    stats.storedBytes = m_storedBytes;
+    stats.rawBytes = m_rawBytes;
+    stats.capacityBytes = m_capacityBytes;
+    stats.evicted = m_evicted;
+    stats.ringCount = m_rings.size();
+    return stats;
+}
+
+/*******************************************************************************
+ * Dump
+ ******************************************************************************/
+int FlightRecorder::dump(const QString& directory, QString* error)
+{
+    // Snapshot under the lock; payloads are implicitly shared
+    QVector<QPair<RingKey, Ring>> rings;
+    {
+        QMutexLocker locker(&m_mutex);
+        for (auto it = m_rings.constBegin(); it != m_rings.constEnd(); ++it)
+        {
+            if (!it.value().entries.empty())
+            {
+                rings.append(qMakePair(it.key(), it.value()));
+            }
+        }
+    }
+
+    QDir root(directory);
+    if (!root.mkpath("."))
+    {
+        if (error)
+        {
+            *error = "Cannot create " + directory;
+        }
+        return 0;
+    }
+
+    // Oldest rings first so folder numbering follows the timeline
+    std::sort(rings.begin(), rings.end(),
+              [](const QPair<RingKey, Ring>& a, const QPair<RingKey, Ring>& b)
+              {
+                  return a.second.entries.front().sequence < b.second.entries.front().sequence;
+              });
+
+    int written = 0;
+    QJsonArray ringsJson;
+
+    for (int r = 0; r < rings.size(); ++r)
+    {
+        const RingKey& key = rings[r].first;
+        const Ring& ring = rings[r].second;
+
+        const QString folder = QString("%1_%2").arg(r, 2, 10, QChar('0')).arg(sanitizeName(ring.caption));
+        root.mkpath(folder);
+        QDir ringDir(root.filePath(folder));
+
+        QJsonArray framesJson;
+        size_t begin = 0;
+        int segment = 0;
+
+        while (begin < ring.entries.size())
+        {
+            const Entry& first = ring.entries[begin];
+
+            // Images with equal geometry share one NPY stack; logs take the whole ring
+            size_t end = begin + 1;
+            while (end < ring.entries.size() &&
+                   ring.entries[end].kind == first.kind &&
+                   (first.kind != Kind::Image ||
+                    (ring.entries[end].rows == first.rows &&
+                     ring.entries[end].cols == first.cols &&
+                     ring.entries[end].type == first.type)))
+            {
+                end++;
+            }
+
+            const bool isImage = (first.kind == Kind::Image);
+            const QString fileName = QString("port%1_%2%3")
+                                         .arg(key.second)
+                                         .arg(segment++, 3, 10, QChar('0'))
+                                         .arg(isImage ? ".npy" : ".vbdl");
+
+            QFile file(ringDir.filePath(fileName));
+            if (!file.open(QIODevice::WriteOnly))
+            {
+                if (error)
+                {
+                    *error = QString("Cannot write %1: %2").arg(file.fileName(), file.errorString());
+                }
+                return written;
+            }
+
+            if (isImage)
+            {
+                if (npyDescr(CV_MAT_DEPTH(first.type)).isEmpty())
+                {
+                    file.close();
+                    file.remove();
+                    begin = end;
+                    continue;
+                }
+                file.write(npyHeader(static_cast<int>(end - begin), first.rows, first.cols, first.type));
+            }
+            else
+            {
+                file.write(DetectionLogEncoder::fileHeader());
+            }
+
+            QJsonArray segmentJson;
+            bool corrupt = false;
+            for (size_t i = begin; i < end && !corrupt; ++i)
+            {
+                const Entry& entry = ring.entries[i];
+                if (isImage)
+                {
+                    // A frame that does not decode to the stack's geometry
+                    // would leave a stack too short for its header
+                    cv::Mat frame = FrameCodec::decode(entry.payload);
+                    if (frame.rows != first.rows || frame.cols != first.cols ||
+                        frame.type() != first.type)
+                    {
+                        corrupt = true;
+                        continue;
+                    }
+                    if (!frame.isContinuous())
+                    {
+                        frame = frame.clone();
+                    }
+                    file.write(reinterpret_cast<const char*>(frame.data),
+                               static_cast<qint64>(frame.total() * frame.elemSize()));
+                }
+                else
+                {
+                    file.write(entry.payload);
+                }
+
+                QJsonObject frameJson;
+                frameJson["file"] = folder + "/" + fileName;
+                frameJson["index"] = static_cast<int>(i - begin);
+                frameJson["sequence"] = static_cast<qint64>(entry.sequence);
+                frameJson["wallMs"] = entry.wallMs;
+                if (entry.frameIndex >= 0)
+                {
+                    frameJson["frameIndex"] = entry.frameIndex;
+                    frameJson["timestampMs"] = entry.timestampMs;
+                }
+                segmentJson.append(frameJson);
+            }
+
+            file.close();
+            begin = end;
+
+            if (corrupt)
+            {
+                file.remove();
+                if (error)
+                {
+                    if (!error->isEmpty())
+                    {
+                        *error += '\n';
+                    }
+                    *error += QString("Skipped %1/%2: a recorded frame could not be decoded")
+                                  .arg(folder, fileName);
+                }
+                continue;
+            }
+
+            for (const QJsonValue& frameJson : segmentJson)
+            {
+                framesJson.append(frameJson);
+            }
+            written += segmentJson.size();
+        }
+
+        QJsonObject ringJson;
+        ringJson["node"] = ring.caption;
+        ringJson["port"] = key.second;
+        ringJson["folder"] = folder;
+        ringJson["frames"] = framesJson;
+        ringsJson.append(ringJson);
+    }
+
+    QJsonObject manifest;
+    manifest["created"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+    manifest["stats"] = stats().toJson();
+    manifest["rings"] = ringsJson;
+
+    QFile manifestFile(root.filePath("manifest.json"));
+    if (manifestFile.open(QIODevice::WriteOnly))
+    {
+        manifestFile.write(QJsonDocument(manifest).toJson(QJsonDocument::Indented));
+    }
+
+    return written;
+}
+
+} // namespace VisionBox
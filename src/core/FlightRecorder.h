@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Flight Recorder - Ring buffers of recent node outputs
+ ******************************************************************************/
+
+#ifndef VISIONBOX_FLIGHT_RECORDER_H
+#define VISIONBOX_FLIGHT_RECORDER_H
+
+#include "BoundedQueue.h"
+#include <QtNodes/NodeData>
+#include <QString>
+#include <QByteArray>
+#include <QHash>
+#include <QSet>
+#include <QMutex>
+#include <QJsonObject>
+#include <deque>
+#include <memory>
+#include <thread>
+
+namespace VisionBox {
+
+/**
+ * @brief Snapshot of flight recorder counters
+ */
+struct FlightRecorderStats
+{
+    qint64 frames = 0;          // Outputs currently held
+    qint64 storedBytes = 0;     // Compressed bytes currently held
+    qint64 rawBytes = 0;        // Uncompressed size of the held outputs
+    qint64 capacityBytes = 0;   // Configured memory cap
+    qint64 dropped = 0;         // Outputs skipped because the encoder was busy
+    qint64 evicted = 0;         // Outputs dropped to stay within the cap
+    int ringCount = 0;          // Recorded (node, port) pairs
+
+    double compressionRatio() const
+    {
+        return storedBytes > 0 ? static_cast<double>(rawBytes) / storedBytes : 0.0;
+    }
+
+    double storedMB() const { return storedBytes / (1024.0 * 1024.0); }
+    double capacityMB() const { return capacityBytes / (1024.0 * 1024.0); }
+
+    // Convert to JSON
+    QJsonObject toJson() const
+    {
+        QJsonObject obj;
+        obj["frames"] = frames;
+        obj["storedMB"] = storedMB();
+        obj["capacityMB"] = capacityMB();
+        obj["compressionRatio"] = compressionRatio();
+        obj["dropped"] = dropped;
+        obj["evicted"] = evicted;
+        obj["ringCount"] = ringCount;
+        return obj;
+    }
+};
+
+/**
+ * @brief Process-wide recorder of the last N outputs of selected nodes
+ *
+ * record() is called from the data-flow thread and only queues a reference
+ * to the output; compression happens on a background thread, and outputs
+ * arriving while the encoder is saturated are skipped rather than stalling
+ * the graph. Images are compressed with FrameCodec, detections and
+ * keypoints are stored as detection-log blocks. Each (node, port) keeps at most
+ * framesPerNode() outputs, and the oldest outputs overall are evicted once
+ * the memory cap is reached.
+ *
+ * dump() writes everything for post-mortem replay: image rings become NPY
+ * stacks (Raw Frame Source), detection rings become .vbdl logs (Detection
+ * Log Source), and manifest.json lists every output with its timestamps.
+ *
+ * Recorded outputs are held by reference until encoded, so nodes must not
+ * modify an emitted image in place (the usual data-flow contract).
+ */
+class FlightRecorder
+{
+public:
+    static FlightRecorder* instance();
+
+    // Record every node, or only nodes enabled with setNodeEnabled()
+    void setRecordAll(bool enabled);
+    bool recordAll() const;
+    void setNodeEnabled(const void* nodeInstance, bool enabled);
+    bool isNodeEnabled(const void* nodeInstance) const;
+
+    // Queue one node output (no-op unless the node is being recorded)
+    void record(const void* nodeInstance,
+                const QString& nodeCaption,
+                int port,
+                const std::shared_ptr<QtNodes::NodeData>& data);
+
+    // Forget a deleted node and its recorded outputs
+    void removeNode(const void* nodeInstance);
+
+    // Limits
+    void setFramesPerNode(int frames);
+    int framesPerNode() const;
+    void setCapacityBytes(qint64 bytes);
+    qint64 capacityBytes() const;
+
+    // Write all recorded outputs below directory; returns the number written.
+    // Stacks holding a frame that fails to decode are left out and listed in error.
+    int dump(const QString& directory, QString* error = nullptr);
+
+    void clear();
+    FlightRecorderStats stats() const;
+
+private:
+    FlightRecorder();
+    ~FlightRecorder();
+
+    enum class Kind
+    {
+        Image,
+        Detections,
+        Keypoints
+    };
+
+    struct Job
+    {
+        const void* node = nullptr;
+        QString caption;
+        int port = 0;
+        double wallMs = 0.0;
+        std::shared_ptr<QtNodes::NodeData> data;
+    };
+
+    struct Entry
+    {
+        quint64 sequence = 0;       // Global arrival order
+        double wallMs = 0.0;        // Wall clock at record()
+        qint64 frameIndex = -1;     // Source frame index, if known
+        double timestampMs = 0.0;   // Source timestamp, if known
+        Kind kind = Kind::Image;
+        int rows = 0;
+        int cols = 0;
+        int type = 0;               // OpenCV type for images
+        qint64 rawBytes = 0;
+        QByteArray payload;
+    };
+
+    struct Ring
+    {
+        QString caption;
+        std::deque<Entry> entries;
+    };
+
+    using RingKey = QPair<const void*, int>;
+
+    void encoderLoop();
+    bool encode(const Job& job, Entry& entry) const;
+    void insert(const Job& job, Entry entry);
+    void evictToFit(qint64 incomingBytes);       // Caller holds m_mutex
+    void popFront(Ring& ring);                   // Caller holds m_mutex
+
+    BoundedQueue<Job> m_queue;
+    std::thread m_encoder;
+
+    mutable QMutex m_mutex;
+    QHash<RingKey, Ring> m_rings;
+    QSet<const void*> m_enabledNodes;
+    bool m_recordAll = false;
+    int m_framesPerNode = 60;
+    qint64 m_capacityBytes;
+    qint64 m_storedBytes = 0;
+    qint64 m_rawBytes = 0;
+    qint64 m_evicted = 0;
+    quint64 m_nextSequence = 0;
+
+    // Prevent copy
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_FLIGHT_RECORDER_H
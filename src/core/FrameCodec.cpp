@@ -0,0 +1,615 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Fast Lossless Frame Codec Implementation
+ ******************************************************************************/
+
+#include "FrameCodec.h"
+#include <QFile>
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <vector>
+
+namespace VisionBox {
+
+namespace {
+
+// Raw bytes per chunk; small enough to stay in L2 and to spread over cores
+constexpr int kChunkBytes = 256 * 1024;
+
+/*******************************************************************************
+ * LZ4 block format constants
+ ******************************************************************************/
+constexpr int kMinMatch = 4;
+constexpr int kLastLiterals = 5;        // Block must end with literals
+constexpr int kMatchFindLimit = 12;     // No match may start in the last 12 bytes
+constexpr int kMaxOffset = 65535;
+constexpr int kHashLog = 14;
+
+inline quint32 read32(const uchar* p)
+{
+    quint32 value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline quint64 read64(const uchar* p)
+{
+    quint64 value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline quint32 hash4(quint32 sequence)
+{
+    return (sequence * 2654435761u) >> (32 - kHashLog);
+}
+
+// Length of the common prefix of a and b, not reading past limit
+inline const uchar* matchEnd(const uchar* a, const uchar* b, const uchar* limit)
+{
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        while (a + 8 <= limit)
+        {
+            quint64 diff = read64(a) ^ read64(b);
+            if (diff)
+            {
+                return a + (std::countr_zero(diff) >> 3);
+            }
+            a += 8;
+            b += 8;
+        }
+    }
+    while (a < limit && *a == *b)
+    {
+        a++;
+        b++;
+    }
+    return a;
+}
+
+inline uchar* writeLength(uchar* op, int length)
+{
+    while (length >= 255)
+    {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = static_cast<uchar>(length);
+    return op;
+}
+
+/*******************************************************************************
+ * Reversible filters
+ ******************************************************************************/
+// Horizontal delta per channel on the raw element bits (wrapping arithmetic)
+template <typename T>
+void deltaEncodeRows(uchar* data, int rows, int elemsPerRow, int channels, size_t rowBytes)
+{
+    for (int y = 0; y < rows; ++y)
+    {
+        T* row = reinterpret_cast<T*>(data + y * rowBytes);
+        for (int i = elemsPerRow - 1; i >= channels; --i)
+        {
+            row[i] = static_cast<T>(row[i] - row[i - channels]);
+        }
+    }
+}
+
+template <typename T>
+void deltaDecodeRows(uchar* data, int rows, int elemsPerRow, int channels, size_t rowBytes)
+{
+    for (int y = 0; y < rows; ++y)
+    {
+        T* row = reinterpret_cast<T*>(data + y * rowBytes);
+        for (int i = channels; i < elemsPerRow; ++i)
+        {
+            row[i] = static_cast<T>(row[i] + row[i - channels]);
+        }
+    }
+}
+
+void applyDelta(uchar* data, int rows, int cols, int type, bool encode)
+{
+    const int channels = CV_MAT_CN(type);
+    const int elemsPerRow = cols * channels;
+    const size_t rowBytes = static_cast<size_t>(cols) * CV_ELEM_SIZE(type);
+
+    switch (CV_ELEM_SIZE1(type))
+    {
+        case 1:
+            encode ? deltaEncodeRows<quint8>(data, rows, elemsPerRow, channels, rowBytes)
+                   : deltaDecodeRows<quint8>(data, rows, elemsPerRow, channels, rowBytes);
+            break;
+        case 2:
+            encode ? deltaEncodeRows<quint16>(data, rows, elemsPerRow, channels, rowBytes)
+                   : deltaDecodeRows<quint16>(data, rows, elemsPerRow, channels, rowBytes);
+            break;
+        case 4:
+            encode ? deltaEncodeRows<quint32>(data, rows, elemsPerRow, channels, rowBytes)
+                   : deltaDecodeRows<quint32>(data, rows, elemsPerRow, channels, rowBytes);
+            break;
+        case 8:
+            encode ? deltaEncodeRows<quint64>(data, rows, elemsPerRow, channels, rowBytes)
+                   : deltaDecodeRows<quint64>(data, rows, elemsPerRow, channels, rowBytes);
+            break;
+    }
+}
+
+// Group byte k of every element together (k = 0 .. elementSize-1)
+void shuffleBytes(const uchar* src, uchar* dst, size_t bytes, int elementSize)
+{
+    const size_t count = bytes / elementSize;
+    for (int k = 0; k < elementSize; ++k)
+    {
+        uchar* plane = dst + k * count;
+        const uchar* in = src + k;
+        for (size_t i = 0; i < count; ++i)
+        {
+            plane[i] = in[i * elementSize];
+        }
+    }
+}
+
+void unshuffleBytes(const uchar* src, uchar* dst, size_t bytes, int elementSize)
+{
+    const size_t count = bytes / elementSize;
+    for (int k = 0; k < elementSize; ++k)
+    {
+        const uchar* plane = src + k * count;
+        uchar* out = dst + k;
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i * elementSize] = plane[i];
+        }
+    }
+}
+
+} // namespace
+
+/*******************************************************************************
+ * LZ4 Block Format
+ ******************************************************************************/
+int FrameCodec::lz4Bound(int inputSize)
+{
+    return inputSize + inputSize / 255 + 16;
+}
+
+int FrameCodec::lz4Compress(const uchar* src, int srcSize, uchar* dst, int dstCapacity)
+{
+    if (dstCapacity < lz4Bound(srcSize))
+    {
+        return 0;
+    }
+
+    const uchar* ip = src;
+    const uchar* anchor = src;
+    const uchar* const iend = src + srcSize;
+    const uchar* const mflimit = iend - kMatchFindLimit;
+    const uchar* const matchLimit = iend - kLastLiterals;
+    uchar* op = dst;
+
+    if (srcSize >= kMatchFindLimit + 1)
+    {
+        std::vector<quint32> table(1u << kHashLog, 0);
+        ip++;
+
+        while (ip < mflimit)
+        {
+            const quint32 sequence = read32(ip);
+            const quint32 h = hash4(sequence);
+            const uchar* ref = src + table[h];
+            table[h] = static_cast<quint32>(ip - src);
+
+            if (ref >= ip || ip - ref > kMaxOffset || read32(ref) != sequence)
+            {
+                // Skip faster through incompressible data
+                ip += 1 + ((ip - anchor) >> 6);
+                continue;
+            }
+
+            // Extend backwards over pending literals
+            while (ip > anchor && ref > src && ip[-1] == ref[-1])
+            {
+                ip--;
+                ref--;
+            }
+
+            const uchar* end = matchEnd(ip + kMinMatch, ref + kMinMatch, matchLimit);
+            const int literalLength = static_cast<int>(ip - anchor);
+            const int matchLength = static_cast<int>(end - ip) - kMinMatch;
+
+            uchar* token = op++;
+            *token = static_cast<uchar>((std::min(literalLength, 15) << 4) |
+                                        std::min(matchLength, 15));
+            if (literalLength >= 15)
+            {
+                op = writeLength(op, literalLength - 15);
+            }
+            std::memcpy(op, anchor, literalLength);
+            op += literalLength;
+
+            const quint16 offset = static_cast<quint16>(ip - ref);
+            *op++ = static_cast<uchar>(offset & 0xFF);
+            *op++ = static_cast<uchar>(offset >> 8);
+            if (matchLength >= 15)
+            {
+                op = writeLength(op, matchLength - 15);
+            }
+
+            ip = end;
+            anchor = ip;
+
+            // Seed the table inside the match so the next search finds it
+            if (ip < mflimit)
+            {
+                table[hash4(read32(ip - 2))] = static_cast<quint32>(ip - 2 - src);
+            }
+        }
+    }
+
+    // Trailing literals
+    const int literalLength = static_cast<int>(iend - anchor);
+    *op++ = static_cast<uchar>(std::min(literalLength, 15) << 4);
+    if (literalLength >= 15)
+    {
+        op = writeLength(op, literalLength - 15);
+    }
+    std::memcpy(op, anchor, literalLength);
+    op += literalLength;
+
+    return static_cast<int>(op - dst);
+}
+
+bool FrameCodec::lz4Decompress(const uchar* src, int srcSize, uchar* dst, int dstSize)
+{
+    const uchar* ip = src;
+    const uchar* const iend = src + srcSize;
+    uchar* op = dst;
+    uchar* const oend = dst + dstSize;
+
+    while (ip < iend)
+    {
+        const uchar token = *ip++;
+
+        // Literals
+        size_t literalLength = token >> 4;
+        if (literalLength == 15)
+        {
+            uchar b;
+            do
+            {
+                if (ip >= iend)
+                {
+                    return false;
+                }
+                b = *ip++;
+                literalLength += b;
+            } while (b == 255);
+        }
+        if (literalLength > static_cast<size_t>(iend - ip) ||
+            literalLength > static_cast<size_t>(oend - op))
+        {
+            return false;
+        }
+        std::memcpy(op, ip, literalLength);
+        op += literalLength;
+        ip += literalLength;
+
+        if (ip == iend)
+        {
+            break; // Last sequence has no match
+        }
+
+        // Match
+        if (iend - ip < 2)
+        {
+            return false;
+        }
+        const size_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst))
+        {
+            return false;
+        }
+
+        size_t matchLength = token & 15;
+        if (matchLength == 15)
+        {
+            uchar b;
+            do
+            {
+                if (ip >= iend)
+                {
+                    return false;
+                }
+                b = *ip++;
+                matchLength += b;
+            } while (b == 255);
+        }
+        matchLength += kMinMatch;
+        if (matchLength > static_cast<size_t>(oend - op))
+        {
+            return false;
+        }
+
+        const uchar* match = op - offset;
+        if (offset >= matchLength)
+        {
+            std::memcpy(op, match, matchLength);
+            op += matchLength;
+        }
+        else
+        {
+            // Overlapping copy repeats the last `offset` bytes
+            for (size_t i = 0; i < matchLength; ++i)
+            {
+                *op++ = *match++;
+            }
+        }
+    }
+
+    return op == oend;
+}
+
+/*******************************************************************************
+ * Frame Encoding
+ ******************************************************************************/
+QByteArray FrameCodec::encode(const cv::Mat& image, int filters)
+{
+    if (image.empty() || image.dims != 2)
+    {
+        return QByteArray();
+    }
+
+    const int elementSize = static_cast<int>(image.elemSize1());
+    if (elementSize <= 1)
+    {
+        filters &= ~ShuffleFilter;
+    }
+
+    Header header;
+    header.filters = static_cast<quint16>(filters);
+    header.rows = image.rows;
+    header.cols = image.cols;
+    header.type = image.type();
+    header.step = static_cast<quint32>(image.cols * image.elemSize());
+    header.chunkRows = std::max<quint32>(1, kChunkBytes / std::max<quint32>(1, header.step));
+    header.chunkCount = (header.rows + header.chunkRows - 1) / header.chunkRows;
+
+    // Compress chunks independently and in parallel
+    std::vector<std::vector<uchar>> chunks(header.chunkCount);
+    std::vector<quint32> sizes(header.chunkCount);
+
+    cv::parallel_for_(cv::Range(0, static_cast<int>(header.chunkCount)), [&](const cv::Range& range)
+    {
+        std::vector<uchar> work;
+        std::vector<uchar> shuffled;
+
+        for (int c = range.start; c < range.end; ++c)
+        {
+            const int y0 = c * static_cast<int>(header.chunkRows);
+            const int rows = std::min(static_cast<int>(header.chunkRows), header.rows - y0);
+            const size_t bytes = static_cast<size_t>(rows) * header.step;
+
+            // Pack the rows (the source may be a strided ROI)
+            work.resize(bytes);
+            for (int y = 0; y < rows; ++y)
+            {
+                std::memcpy(work.data() + y * header.step, image.ptr(y0 + y), header.step);
+            }
+
+            if (filters & DeltaFilter)
+            {
+                applyDelta(work.data(), rows, header.cols, header.type, true);
+            }
+
+            const uchar* input = work.data();
+            if (filters & ShuffleFilter)
+            {
+                shuffled.resize(bytes);
+                shuffleBytes(work.data(), shuffled.data(), bytes, elementSize);
+                input = shuffled.data();
+            }
+
+            std::vector<uchar>& out = chunks[c];
+            out.resize(lz4Bound(static_cast<int>(bytes)));
+            int compressed = lz4Compress(input, static_cast<int>(bytes), out.data(),
+                                         static_cast<int>(out.size()));
+
+            if (compressed <= 0 || static_cast<size_t>(compressed) >= bytes)
+            {
+                // Incompressible: store the filtered bytes
+                out.assign(input, input + bytes);
+                sizes[c] = static_cast<quint32>(bytes) | kStoredFlag;
+            }
+            else
+            {
+                out.resize(compressed);
+                sizes[c] = static_cast<quint32>(compressed);
+            }
+        }
+    });
+
+    qint64 total = sizeof(Header) + sizes.size() * sizeof(quint32);
+    for (const auto& chunk : chunks)
+    {
+        total += static_cast<qint64>(chunk.size());
+    }
+
+    QByteArray result;
+    result.resize(static_cast<int>(total));
+    char* out = result.data();
+    std::memcpy(out, &header, sizeof(Header));
+    out += sizeof(Header);
+    std::memcpy(out, sizes.data(), sizes.size() * sizeof(quint32));
+    out += sizes.size() * sizeof(quint32);
+    for (const auto& chunk : chunks)
+    {
+        std::memcpy(out, chunk.data(), chunk.size());
+        out += chunk.size();
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+ * Frame Decoding
+ ******************************************************************************/
+bool FrameCodec::peekHeader(const char* data, qint64 size, Header& header)
+{
+    if (!data || size < static_cast<qint64>(sizeof(Header)))
+    {
+        return false;
+    }
+
+    std::memcpy(&header, data, sizeof(Header));
+    const Header reference;
+    if (std::memcmp(header.magic, reference.magic, sizeof(header.magic)) != 0 ||
+        header.version != reference.version)
+    {
+        return false;
+    }
+
+    const int depth = CV_MAT_DEPTH(header.type);
+    const int channels = CV_MAT_CN(header.type);
+    if (header.rows <= 0 || header.cols <= 0 || depth > CV_16F ||
+        channels < 1 || channels > CV_CN_MAX || header.chunkRows == 0)
+    {
+        return false;
+    }
+
+    return header.step == static_cast<quint32>(header.cols * CV_ELEM_SIZE(header.type)) &&
+           header.chunkCount == (header.rows + header.chunkRows - 1) / header.chunkRows;
+}
+
+cv::Mat FrameCodec::decode(const QByteArray& data)
+{
+    return decode(data.constData(), data.size());
+}
+
+cv::Mat FrameCodec::decode(const char* data, qint64 size)
+{
+    Header header;
+    if (!peekHeader(data, size, header))
+    {
+        return cv::Mat();
+    }
+
+    const qint64 tableBytes = static_cast<qint64>(header.chunkCount) * sizeof(quint32);
+    if (size < static_cast<qint64>(sizeof(Header)) + tableBytes)
+    {
+        return cv::Mat();
+    }
+
+    // Locate every chunk before decoding any of them
+    std::vector<quint32> sizes(header.chunkCount);
+    std::memcpy(sizes.data(), data + sizeof(Header), tableBytes);
+
+    std::vector<qint64> offsets(header.chunkCount);
+    qint64 offset = sizeof(Header) + tableBytes;
+    for (quint32 c = 0; c < header.chunkCount; ++c)
+    {
+        offsets[c] = offset;
+        offset += sizes[c] & ~kStoredFlag;
+    }
+    if (offset > size)
+    {
+        return cv::Mat();
+    }
+
+    cv::Mat image(header.rows, header.cols, header.type);
+    const int elementSize = static_cast<int>(image.elemSize1());
+    std::atomic<bool> ok{true};
+
+    cv::parallel_for_(cv::Range(0, static_cast<int>(header.chunkCount)), [&](const cv::Range& range)
+    {
+        std::vector<uchar> shuffled;
+
+        for (int c = range.start; c < range.end && ok; ++c)
+        {
+            const int y0 = c * static_cast<int>(header.chunkRows);
+            const int rows = std::min(static_cast<int>(header.chunkRows), header.rows - y0);
+            const size_t bytes = static_cast<size_t>(rows) * header.step;
+            const uchar* input = reinterpret_cast<const uchar*>(data + offsets[c]);
+            const quint32 stored = sizes[c] & ~kStoredFlag;
+
+            // A freshly allocated Mat is continuous: chunks are contiguous rows
+            uchar* target = image.ptr(y0);
+            uchar* decoded = target;
+            if (header.filters & ShuffleFilter)
+            {
+                shuffled.resize(bytes);
+                decoded = shuffled.data();
+            }
+
+            if (sizes[c] & kStoredFlag)
+            {
+                if (stored != bytes)
+                {
+                    ok = false;
+                    return;
+                }
+                std::memcpy(decoded, input, bytes);
+            }
+            else if (!lz4Decompress(input, static_cast<int>(stored), decoded, static_cast<int>(bytes)))
+            {
+                ok = false;
+                return;
+            }
+
+            if (header.filters & ShuffleFilter)
+            {
+                unshuffleBytes(decoded, target, bytes, elementSize);
+            }
+            if (header.filters & DeltaFilter)
+            {
+                applyDelta(target, rows, header.cols, header.type, false);
+            }
+        }
+    });
+
+    return ok ? image : cv::Mat();
+}
+
+/*******************************************************************************
+ * File Helpers
+ ******************************************************************************/
+bool FrameCodec::writeFile(const QString& filePath, const cv::Mat& image, int filters)
+{
+    QByteArray encoded = encode(image, filters);
+    if (encoded.isEmpty())
+    {
+        return false;
+    }
+
+    QFile file(filePath);
+    return file.open(QIODevice::WriteOnly) && file.write(encoded) == encoded.size();
+}
+
+cv::Mat FrameCodec::readFile(const QString& filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return cv::Mat();
+    }
+
+    // Decode straight from the mapping when possible
+    const qint64 size = file.size();
+    uchar* mapped = size > 0 ? file.map(0, size) : nullptr;
+    if (mapped)
+    {
+        cv::Mat image = decode(reinterpret_cast<const char*>(mapped), size);
+        file.unmap(mapped);
+        return image;
+    }
+
+    return decode(file.readAll());
+}
+
+} // namespace VisionBox
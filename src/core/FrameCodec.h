@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Fast Lossless Frame Codec
+ ******************************************************************************/
+
+#ifndef VISIONBOX_FRAME_CODEC_H
+#define VISIONBOX_FRAME_CODEC_H
+
+#include <QString>
+#include <QByteArray>
+#include <opencv2/core/mat.hpp>
+
+namespace VisionBox {
+
+/**
+ * @brief Lossless codec for intermediate frames (.vbf)
+ *
+ * Built for throughput rather than ratio: rows are split into independent
+ * chunks that are filtered and LZ4-compressed in parallel, and decoded the
+ * same way. Any 2-D cv::Mat round-trips bit-exactly, whatever its depth
+ * (8U/8S/16U/16S/32S/32F/64F/16F) and channel count.
+ *
+ * Per chunk, two optional reversible filters run before LZ4:
+ *   - Delta: each element minus its left neighbour in the same channel,
+ *     computed on the raw bits (wrapping), so it is lossless for floats too
+ *   - Shuffle: bytes of multi-byte elements are regrouped by significance
+ *
+ * Layout (host byte order):
+ *   Header | uint32 chunkSize[chunkCount] | chunk payloads
+ * A chunk size with kStoredFlag set holds raw (filtered) bytes.
+ */
+class FrameCodec
+{
+public:
+    enum Filter
+    {
+        NoFilter = 0,
+        DeltaFilter = 0x1,
+        ShuffleFilter = 0x2
+    };
+
+    struct Header
+    {
+        char magic[4] = {'V', 'B', 'F', 'C'};
+        quint16 version = 1;
+        quint16 filters = 0;        // Filter flags
+        qint32 rows = 0;
+        qint32 cols = 0;
+        qint32 type = 0;            // OpenCV type (depth + channels)
+        quint32 step = 0;           // Packed bytes per row
+        quint32 chunkRows = 0;      // Rows per chunk (last may be shorter)
+        quint32 chunkCount = 0;
+    };
+
+    static constexpr quint32 kStoredFlag = 0x80000000u;
+
+    // Encode an image; filters default to delta + shuffle
+    static QByteArray encode(const cv::Mat& image,
+                             int filters = DeltaFilter | ShuffleFilter);
+
+    // Decode; returns an empty Mat on malformed input
+    static cv::Mat decode(const QByteArray& data);
+    static cv::Mat decode(const char* data, qint64 size);
+
+    // Read the header only (e.g. to size a buffer); false if not a frame
+    static bool peekHeader(const char* data, qint64 size, Header& header);
+
+    // File helpers
+    static bool writeFile(const QString& filePath, const cv::Mat& image,
+                          int filters = DeltaFilter | ShuffleFilter);
+    static cv::Mat readFile(const QString& filePath);
+
+    // LZ4 block format primitives (exposed for other caches and tests)
+    static int lz4Bound(int inputSize);
+    static int lz4Compress(const uchar* src, int srcSize, uchar* dst, int dstCapacity);
+    static bool lz4Decompress(const uchar* src, int srcSize, uchar* dst, int dstSize);
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_FRAME_CODEC_H
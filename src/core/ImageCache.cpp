@@ -0,0 +1,199 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Shared Decoded Image Cache Implementation
+ ******************************************************************************/
+
+#include "ImageCache.h"
+#include "FrameCodec.h"
+#include <QFileInfo>
+#include <QDateTime>
+#include <QMutexLocker>
+#include <opencv2/imgcodecs.hpp>
+
+namespace VisionBox {
+
+namespace {
+
+// Default budget: 512 MB of decoded pixels
+constexpr qint64 kDefaultCapacityBytes = 512LL * 1024 * 1024;
+
+qint64 matBytes(const cv::Mat& image)
+{
+    return static_cast<qint64>(image.total() * image.elemSize());
+}
+
+} // namespace
+
+/*******************************************************************************
+ * ImageCache Implementation
+ ******************************************************************************/
+ImageCache::ImageCache()
+    : m_capacityBytes(kDefaultCapacityBytes)
+{
+}
+
+ImageCache* ImageCache::instance()
+{
+    static ImageCache cache;
+    return &cache;
+}
+
+cv::Mat ImageCache::imread(const QString& filePath, int flags)
+{
+    QFileInfo info(filePath);
+    if (!info.exists())
+    {
+        return cv::Mat();
+    }
+
+    const QString canonicalPath = info.canonicalFilePath();
+    const QString key = QString("%1|%2|%3|%4")
+                            .arg(canonicalPath)
+                            .arg(info.lastModified().toMSecsSinceEpoch())
+                            .arg(info.size())
+                            .arg(flags);
+
+    {
+        QMutexLocker locker(&m_mutex);
+
+        auto found = m_index.find(key);
+        if (found != m_index.end())
+        {
+            // Move to front (most recently used)
+            m_lru.splice(m_lru.begin(), m_lru, found.value());
+            m_hits++;
+            return m_lru.front().image;
+        }
+
+        m_misses++;
+    }
+
+    // Decode without holding the lock so other nodes are not serialized
+    // .vbf frames are returned exactly as stored, whatever the flags
+    cv::Mat image = info.suffix().compare("vbf", Qt::CaseInsensitive) == 0
+                        ? FrameCodec::readFile(canonicalPath)
+                        : cv::imread(canonicalPath.toStdString(), flags);
+    if (image.empty())
+    {
+        return image;
+    }
+
+    const qint64 bytes = matBytes(image);
+
+    QMutexLocker locker(&m_mutex);
+
+    // Another thread may have decoded the same file meanwhile
+    auto found = m_index.find(key);
+    if (found != m_index.end())
+    {
+        m_lru.splice(m_lru.begin(), m_lru, found.value());
+        return m_lru.front().image;
+    }
+
+    if (bytes > m_capacityBytes)
+    {
+        // Too large to cache, hand it out uncached
+        return image;
+    }
+
+    // Older versions of this file can never be hit again
+    for (auto it = m_lru.begin(); it != m_lru.end();)
+    {
+        auto next = std::next(it);
+        if (it->canonicalPath == canonicalPath)
+        {
+            eraseEntry(it);
+        }
+        it = next;
+    }
+
+    evictToFit(bytes);
+
+    Entry entry;
+    entry.key = key;
+    entry.canonicalPath = canonicalPath;
+    entry.image = image;
+    entry.bytes = bytes;
+    m_lru.push_front(std::move(entry));
+    m_index.insert(key, m_lru.begin());
+    m_residentBytes += bytes;
+
+    return image;
+}
+
+void ImageCache::setCapacityBytes(qint64 bytes)
+{
+    QMutexLocker locker(&m_mutex);
+    m_capacityBytes = std::max<qint64>(0, bytes);
+    evictToFit(0);
+}
+
+qint64 ImageCache::capacityBytes() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_capacityBytes;
+}
+
+void ImageCache::invalidate(const QString& filePath)
+{
+    const QString canonicalPath = QFileInfo(filePath).canonicalFilePath();
+
+    QMutexLocker locker(&m_mutex);
+    for (auto it = m_lru.begin(); it != m_lru.end();)
+    {
+        auto next = std::next(it);
+        if (it->canonicalPath == canonicalPath)
+        {
+            eraseEntry(it);
+        }
+        it = next;
+    }
+}
+
+void ImageCache::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_lru.clear();
+    m_index.clear();
+    m_residentBytes = 0;
+}
+
+void ImageCache::resetStats()
+{
+    QMutexLocker locker(&m_mutex);
+    m_hits = 0;
+    m_misses = 0;
+    m_evictions = 0;
+}
+
+ImageCacheStats ImageCache::stats() const
+{
+    QMutexLocker locker(&m_mutex);
+
+    ImageCacheStats stats;
+    stats.hits = m_hits;
+    stats.misses = m_misses;
+    stats.evictions = m_evictions;
+    stats.residentBytes = m_residentBytes;
+    stats.capacityBytes = m_capacityBytes;
+    stats.entryCount = static_cast<int>(m_index.size());
+    return stats;
+}
+
+void ImageCache::evictToFit(qint64 incomingBytes)
+{
+    while (!m_lru.empty() && m_residentBytes + incomingBytes > m_capacityBytes)
+    {
+        eraseEntry(std::prev(m_lru.end()));
+        m_evictions++;
+    }
+}
+
+void ImageCache::eraseEntry(EntryList::iterator it)
+{
+    m_residentBytes -= it->bytes;
+    m_index.remove(it->key);
+    m_lru.erase(it);
+}
+
+} // namespace VisionBox
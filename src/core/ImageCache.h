@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Shared Decoded Image Cache
+ ******************************************************************************/
+
+#ifndef VISIONBOX_IMAGE_CACHE_H
+#define VISIONBOX_IMAGE_CACHE_H
+
+#include <QString>
+#include <QHash>
+#include <QMutex>
+#include <QJsonObject>
+#include <opencv2/core/mat.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <list>
+
+namespace VisionBox {
+
+/**
+ * @brief Snapshot of image cache counters
+ */
+struct ImageCacheStats
+{
+    qint64 hits = 0;            // Lookups served from the cache
+    qint64 misses = 0;          // Lookups that had to decode the file
+    qint64 evictions = 0;       // Entries dropped to stay within budget
+    qint64 residentBytes = 0;   // Decoded pixel bytes currently held
+    qint64 capacityBytes = 0;   // Configured memory budget
+    int entryCount = 0;         // Number of cached images
+
+    double hitRate() const
+    {
+        qint64 lookups = hits + misses;
+        return lookups > 0 ? static_cast<double>(hits) / lookups : 0.0;
+    }
+
+    double residentMB() const { return residentBytes / (1024.0 * 1024.0); }
+    double capacityMB() const { return capacityBytes / (1024.0 * 1024.0); }
+
+    // Convert to JSON
+    QJsonObject toJson() const
+    {
+        QJsonObject obj;
+        obj["hits"] = hits;
+        obj["misses"] = misses;
+        obj["evictions"] = evictions;
+        obj["hitRate"] = hitRate();
+        obj["residentMB"] = residentMB();
+        obj["capacityMB"] = capacityMB();
+        obj["entryCount"] = entryCount;
+        return obj;
+    }
+};
+
+/**
+ * @brief Process-wide, memory-bounded cache of decoded images
+ *
+ * Singleton shared by all source nodes (and therefore by every project
+ * loaded during a session). Entries are keyed by canonical file path,
+ * modification time, file size and imread flags, so an edited file on
+ * disk is decoded again while unchanged files are served from memory.
+ * Least recently used entries are evicted once the byte budget is exceeded.
+ *
+ * Returned matrices share their buffer with the cache. Callers must treat
+ * them as read-only and clone() before modifying pixels in place.
+ * Thread-safe; decoding happens outside the lock.
+ */
+class ImageCache
+{
+public:
+    static ImageCache* instance();
+
+    // Decode (or fetch) an image, same semantics as cv::imread
+    cv::Mat imread(const QString& filePath, int flags = cv::IMREAD_COLOR);
+
+    // Memory budget in bytes (0 disables caching)
+    void setCapacityBytes(qint64 bytes);
+    qint64 capacityBytes() const;
+
+    // Drop all entries for a file, or everything
+    void invalidate(const QString& filePath);
+    void clear();
+
+    // Reset hit/miss/eviction counters (entries are kept)
+    void resetStats();
+
+    ImageCacheStats stats() const;
+
+private:
+    ImageCache();
+    ~ImageCache() = default;
+
+    struct Entry
+    {
+        QString key;
+        QString canonicalPath;
+        cv::Mat image;
+        qint64 bytes = 0;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    void evictToFit(qint64 incomingBytes);   // Caller holds m_mutex
+    void eraseEntry(EntryList::iterator it); // Caller holds m_mutex
+
+    mutable QMutex m_mutex;
+    EntryList m_lru;                                 // Front = most recently used
+    QHash<QString, EntryList::iterator> m_index;     // Key -> LRU node
+    qint64 m_capacityBytes;
+    qint64 m_residentBytes = 0;
+    qint64 m_hits = 0;
+    qint64 m_misses = 0;
+    qint64 m_evictions = 0;
+
+    // Prevent copy
+    ImageCache(const ImageCache&) = delete;
+    ImageCache& operator=(const ImageCache&) = delete;
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_IMAGE_CACHE_H
@@ -0,0 +1,275 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Inference Pipeline Implementation
+ ******************************************************************************/
+
+#include "InferencePipeline.h"
+#include <opencv2/core.hpp>
+#include <QMutexLocker>
+#include <algorithm>
+#include <exception>
+
+namespace VisionBox {
+
+namespace {
+
+// Weight of the newest sample in the per-stage moving averages
+constexpr double kAverageWeight = 0.1;
+
+double movingAverage(double average, double sample, qint64 count)
+{
+    return count <= 1 ? sample : average + kAverageWeight * (sample - average);
+}
+
+} // namespace
+
+/*******************************************************************************
+ * InferencePipeline Implementation
+ ******************************************************************************/
+InferencePipeline::InferencePipeline(Stage preprocess, Stage inference, Stage postprocess,
+                                     QObject* parent)
+    : QObject(parent)
+    , m_preprocess(std::move(preprocess))
+    , m_inference(std::move(inference))
+    , m_postprocess(std::move(postprocess))
+    , m_preprocessQueue(2, QueueOverflowPolicy::DropNewest)
+    , m_inferenceQueue(2, QueueOverflowPolicy::Block)
+    , m_postprocessQueue(2, QueueOverflowPolicy::Block)
+{
+    m_clock.start();
+}
+
+InferencePipeline::~InferencePipeline()
+{
+    stop();
+}
+
+void InferencePipeline::start(const Config& config)
+{
+    stop();
+
+    m_config = config;
+    m_config.preprocessThreads = std::max(1, config.preprocessThreads);
+    m_config.inferenceWorkers = std::max(1, config.inferenceWorkers);
+    m_config.queueDepth = std::max(1, config.queueDepth);
+
+    m_preprocessQueue.reopen();
+    m_inferenceQueue.reopen();
+    m_postprocessQueue.reopen();
+    m_preprocessQueue.setCapacity(m_config.queueDepth);
+    m_inferenceQueue.setCapacity(m_config.queueDepth);
+    m_postprocessQueue.setCapacity(m_config.queueDepth);
+
+    {
+        QMutexLocker locker(&m_resultMutex);
+        m_results.clear();
+        m_stats = InferencePipelineStats();
+        m_firstResultNs = -1;
+    }
+    m_nextSequence = 0;
+    m_running = true;
+
+    for (int i = 0; i < m_config.preprocessThreads; ++i)
+    {
+        m_preprocessThreads.emplace_back(&InferencePipeline::preprocessLoop, this);
+    }
+    for (int i = 0; i < m_config.inferenceWorkers; ++i)
+    {
+        m_inferenceThreads.emplace_back(&InferencePipeline::inferenceLoop, this);
+    }
+    m_postprocessThread = std::thread(&InferencePipeline::postprocessLoop, this);
+}
+
+void InferencePipeline::stop()
+{
+    if (!m_running)
+    {
+        return;
+    }
+
+    // Close stage by stage so every frame already accepted drains through
+    m_preprocessQueue.close();
+    for (std::thread& thread : m_preprocessThreads)
+    {
+        thread.join();
+    }
+    m_preprocessThreads.clear();
+
+    m_inferenceQueue.close();
+    for (std::thread& thread : m_inferenceThreads)
+    {
+        thread.join();
+    }
+    m_inferenceThreads.clear();
+
+    m_postprocessQueue.close();
+    m_postprocessThread.join();
+
+    m_running = false;
+
+    QMutexLocker locker(&m_resultMutex);
+    m_results.clear();
+}
+
+bool InferencePipeline::submit(InferenceFrame frame)
+{
+    if (!m_running)
+    {
+        return false;
+    }
+
+    frame.sequence = m_nextSequence;
+    frame.submittedNs = m_clock.nsecsElapsed();
+
+    // Sequence numbers are only consumed by accepted frames, so the
+    // reordering in front of postprocess never waits for a dropped one
+    if (!m_preprocessQueue.push(std::move(frame)))
+    {
+        QMutexLocker locker(&m_resultMutex);
+        m_stats.dropped++;
+        return false;
+    }
+
+    m_nextSequence++;
+
+    QMutexLocker locker(&m_resultMutex);
+    m_stats.submitted++;
+    m_stats.inFlight++;
+    return true;
+}
+
+std::vector<InferenceFrame> InferencePipeline::takeResults()
+{
+    QMutexLocker locker(&m_resultMutex);
+    std::vector<InferenceFrame> results;
+    results.swap(m_results);
+    return results;
+}
+
+InferencePipelineStats InferencePipeline::stats() const
+{
+    QMutexLocker locker(&m_resultMutex);
+    return m_stats;
+}
+
+/*******************************************************************************
+ * Stages
+ ******************************************************************************/
+void InferencePipeline::runStage(const Stage& stage, InferenceFrame& frame, double& elapsedMs)
+{
+    if (!frame.error.isEmpty() || !stage)
+    {
+        return;
+    }
+
+    const qint64 startNs = m_clock.nsecsElapsed();
+    try
+    {
+        stage(frame);
+    }
+    catch (const cv::Exception& e)
+    {
+        frame.error = QString::fromStdString(e.what());
+    }
+    catch (const std::exception& e)
+    {
+        frame.error = QString::fromLocal8Bit(e.what());
+    }
+    elapsedMs = (m_clock.nsecsElapsed() - startNs) / 1.0e6;
+}
+
+void InferencePipeline::preprocessLoop()
+{
+    InferenceFrame frame;
+    while (m_preprocessQueue.pop(frame))
+    {
+        runStage(m_preprocess, frame, frame.preprocessMs);
+        m_inferenceQueue.push(std::move(frame));
+    }
+}
+
+void InferencePipeline::inferenceLoop()
+{
+    InferenceFrame frame;
+    while (m_inferenceQueue.pop(frame))
+    {
+        runStage(m_inference, frame, frame.inferenceMs);
+        frame.blob.release();
+        m_postprocessQueue.push(std::move(frame));
+    }
+}
+
+void InferencePipeline::postprocessLoop()
+{
+    // Frames waiting for an earlier sequence number to arrive
+    std::map<quint64, InferenceFrame> pending;
+    quint64 nextSequence = 0;
+
+    InferenceFrame frame;
+    while (m_postprocessQueue.pop(frame))
+    {
+        pending.emplace(frame.sequence, std::move(frame));
+
+        for (auto it = pending.begin(); it != pending.end() && it->first == nextSequence;
+             it = pending.begin())
+        {
+            InferenceFrame ready = std::move(it->second);
+            pending.erase(it);
+            nextSequence++;
+
+            runStage(m_postprocess, ready, ready.postprocessMs);
+            ready.outputs.clear();
+            deliver(std::move(ready));
+        }
+    }
+}
+
+void InferencePipeline::deliver(InferenceFrame frame)
+{
+    const qint64 nowNs = m_clock.nsecsElapsed();
+    frame.latencyMs = (nowNs - frame.submittedNs) / 1.0e6;
+
+    bool notify = false;
+    {
+        QMutexLocker locker(&m_resultMutex);
+
+        InferencePipelineStats& s = m_stats;
+        s.completed++;
+        s.inFlight = std::max(0, s.inFlight - 1);
+        s.preprocessMs = movingAverage(s.preprocessMs, frame.preprocessMs, s.completed);
+        s.inferenceMs = movingAverage(s.inferenceMs, frame.inferenceMs, s.completed);
+        s.postprocessMs = movingAverage(s.postprocessMs, frame.postprocessMs, s.completed);
+        s.latencyMs = movingAverage(s.latencyMs, frame.latencyMs, s.completed);
+
+        if (m_firstResultNs < 0)
+        {
+            m_firstResultNs = nowNs;
+        }
+        else if (nowNs > m_firstResultNs)
+        {
+            s.throughputFps = (s.completed - 1) / ((nowNs - m_firstResultNs) / 1.0e9);
+        }
+
+        m_results.push_back(std::move(frame));
+        if (!m_notifyPending)
+        {
+            m_notifyPending = true;
+            notify = true;
+        }
+    }
+
+    // One notification per batch of results, on the pipeline's thread
+    if (notify)
+    {
+        QMetaObject::invokeMethod(this, [this]()
+        {
+            {
+                QMutexLocker locker(&m_resultMutex);
+                m_notifyPending = false;
+            }
+            Q_EMIT resultsReady();
+        }, Qt::QueuedConnection);
+    }
+}
+
+} // namespace VisionBox
@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Inference Pipeline - Overlapped preprocess / forward / postprocess stages
+ ******************************************************************************/
+
+#ifndef VISIONBOX_INFERENCE_PIPELINE_H
+#define VISIONBOX_INFERENCE_PIPELINE_H
+
+#include "BoundedQueue.h"
+#include "BlobPreprocessor.h"
+#include <QObject>
+#include <QString>
+#include <QMutex>
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <opencv2/core/mat.hpp>
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace VisionBox {
+
+/**
+ * @brief One frame travelling through an InferencePipeline
+ *
+ * Parameters are captured at submit() so stages never read node widgets.
+ */
+struct InferenceFrame
+{
+    quint64 sequence = 0;             // Submission order (assigned by the pipeline)
+    cv::Mat image;                    // Input frame (shared, read-only)
+    cv::Size inputSize;               // Network input size
+    float scoreThreshold = 0.5f;
+    float nmsThreshold = 0.4f;
+    bool softNms = false;             // Gaussian soft-NMS instead of hard suppression
+
+    cv::Mat blob;                     // Preprocess output
+    LetterboxTransform transform;     // Image -> network input mapping
+    std::vector<cv::Mat> outputs;     // Network outputs (owned, not aliasing the net)
+
+    std::vector<cv::Rect> boxes;      // Postprocess output, image pixels
+    std::vector<float> scores;
+    std::vector<int> classIds;
+
+    QString error;                    // Set by a failing stage; later stages are skipped
+
+    // Timing (filled by the pipeline)
+    qint64 submittedNs = 0;
+    double preprocessMs = 0.0;
+    double inferenceMs = 0.0;
+    double postprocessMs = 0.0;
+    double latencyMs = 0.0;           // Submit to result
+};
+
+/**
+ * @brief Snapshot of pipeline counters and per-stage latencies
+ */
+struct InferencePipelineStats
+{
+    qint64 submitted = 0;       // Frames accepted by submit()
+    qint64 completed = 0;       // Results delivered
+    qint64 dropped = 0;         // Frames rejected because the pipeline was full
+    int inFlight = 0;           // Accepted but not yet delivered
+    double preprocessMs = 0.0;  // Moving averages per stage
+    double inferenceMs = 0.0;
+    double postprocessMs = 0.0;
+    double latencyMs = 0.0;     // Moving average end-to-end latency
+    double throughputFps = 0.0; // Results per second since start
+
+    // Slowest stage: throughput is bounded by 1 / bottleneckMs
+    double bottleneckMs() const
+    {
+        return std::max(preprocessMs, std::max(inferenceMs, postprocessMs));
+    }
+
+    // Convert to JSON
+    QJsonObject toJson() const
+    {
+        QJsonObject obj;
+        obj["submitted"] = submitted;
+        obj["completed"] = completed;
+        obj["dropped"] = dropped;
+        obj["inFlight"] = inFlight;
+        obj["preprocessMs"] = preprocessMs;
+        obj["inferenceMs"] = inferenceMs;
+        obj["postprocessMs"] = postprocessMs;
+        obj["latencyMs"] = latencyMs;
+        obj["throughputFps"] = throughputFps;
+        return obj;
+    }
+};
+
+/**
+ * @brief Three-stage frame pipeline for DNN nodes
+ *
+ * Preprocess threads feed inference workers, which feed a single
+ * postprocess thread, through bounded queues, so consecutive frames
+ * overlap and throughput approaches 1/max(stage) instead of 1/sum(stages).
+ * With several preprocess threads or inference workers frames can finish
+ * out of order; they are put back in submission order before postprocess,
+ * so results are always delivered in order.
+ *
+ * submit() never blocks: when the entry queue is full the frame is dropped
+ * and counted. Inside the pipeline, stages apply back-pressure to each
+ * other. resultsReady() is emitted on the pipeline's thread, and
+ * takeResults() returns the completed frames.
+ *
+ * Stage functions run on worker threads and must only touch the frame and
+ * thread-safe state. The inference stage must leave outputs that do not
+ * alias network buffers (clone them), since the net is reused at once.
+ */
+class InferencePipeline : public QObject
+{
+    Q_OBJECT
+
+public:
+    using Stage = std::function<void(InferenceFrame&)>;
+
+    struct Config
+    {
+        int preprocessThreads = 1;
+        int inferenceWorkers = 1;
+        int queueDepth = 2;           // Frames buffered in front of each stage
+    };
+
+    InferencePipeline(Stage preprocess, Stage inference, Stage postprocess,
+                      QObject* parent = nullptr);
+    ~InferencePipeline() override;
+
+    void start(const Config& config = Config());
+    void stop();                      // Joins the workers; undelivered results are discarded
+    bool isRunning() const { return m_running; }
+    Config config() const { return m_config; }
+
+    // Queue a frame; false when the pipeline is full or stopped
+    bool submit(InferenceFrame frame);
+
+    // Completed frames, in submission order
+    std::vector<InferenceFrame> takeResults();
+
+    InferencePipelineStats stats() const;
+
+signals:
+    void resultsReady();
+
+private:
+    void preprocessLoop();
+    void inferenceLoop();
+    void postprocessLoop();
+    void runStage(const Stage& stage, InferenceFrame& frame, double& elapsedMs);
+    void deliver(InferenceFrame frame);
+
+    Stage m_preprocess;
+    Stage m_inference;
+    Stage m_postprocess;
+
+    Config m_config;
+    bool m_running = false;
+    quint64 m_nextSequence = 0;       // Submitting thread only
+
+    BoundedQueue<InferenceFrame> m_preprocessQueue;
+    BoundedQueue<InferenceFrame> m_inferenceQueue;
+    BoundedQueue<InferenceFrame> m_postprocessQueue;
+    std::vector<std::thread> m_preprocessThreads;
+    std::vector<std::thread> m_inferenceThreads;
+    std::thread m_postprocessThread;
+
+    QElapsedTimer m_clock;
+
+    mutable QMutex m_resultMutex;
+    std::vector<InferenceFrame> m_results;    // Guarded by m_resultMutex
+    bool m_notifyPending = false;             // Guarded by m_resultMutex
+    InferencePipelineStats m_stats;           // Guarded by m_resultMutex
+    qint64 m_firstResultNs = -1;              // Guarded by m_resultMutex
+
+    // Prevent copy
+    InferencePipeline(const InferencePipeline&) = delete;
+    InferencePipeline& operator=(const InferencePipeline&) = delete;
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_INFERENCE_PIPELINE_H
@@ -6,6 +6,7 @@
 #ifndef VISIONBOX_NODE_ERROR_H
 #define VISIONBOX_NODE_ERROR_H
 
+#include "NodeStatusCoalescer.h"
 #include <QString>
 #include <QtNodes/internal/NodeDelegateModel.hpp>
 
@@ -224,14 +225,18 @@ public:
 
     /**
      * @brief Set error and update validation state
+     *
+     * The node's displayed status is updated on the next display frame,
+     * and only if it actually changes.
      */
     void setError(const NodeError& error, QtNodes::NodeDelegateModel* model)
     {
         _lastError = error;
         if (model)
         {
-            model->setValidationState(error.toValidationState());
-            model->setNodeProcessingStatus(error.toProcessingStatus());
+            NodeStatusCoalescer::instance()->submit(model,
+                                                    error.toValidationState(),
+                                                    error.toProcessingStatus());
         }
     }
 
@@ -247,12 +252,7 @@ public:
         try
         {
             func();
-            clearError();
-            if (model)
-            {
-                model->setValidationState(ErrorBuilder::success().toValidationState());
-                model->setNodeProcessingStatus(ErrorBuilder::success().toProcessingStatus());
-            }
+            setError(ErrorBuilder::success(), model);
             return true;
         }
         catch (const std::exception& e)
@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Node Status Coalescer Implementation
+ ******************************************************************************/
+
+#include "NodeStatusCoalescer.h"
+#include <QCoreApplication>
+#include <QMutexLocker>
+#include <QThread>
+#include <QTimer>
+
+namespace VisionBox {
+
+/*******************************************************************************
+ * NodeStatusCoalescer Implementation
+ ******************************************************************************/
+NodeStatusCoalescer::NodeStatusCoalescer()
+    : QObject()
+{
+    // Created before the move: a child cannot be parented across threads,
+    // and moveToThread() takes the children along
+    m_timer = new QTimer(this);
+    m_timer->setSingleShot(true);
+    m_timer->setInterval(16);
+    connect(m_timer, &QTimer::timeout, this, [this]() { flush(); });
+
+    // Flushes must run on the GUI thread, whichever thread created us
+    if (QCoreApplication::instance())
+    {
+        moveToThread(QCoreApplication::instance()->thread());
+    }
+}
+
+NodeStatusCoalescer* NodeStatusCoalescer::instance()
+{
+    static NodeStatusCoalescer coalescer;
+    return &coalescer;
+}
+
+void NodeStatusCoalescer::submit(QtNodes::NodeDelegateModel* model,
+                                 const QtNodes::NodeValidationState& validation,
+                                 QtNodes::NodeProcessingStatus status)
+{
+    if (!model)
+    {
+        return;
+    }
+
+    bool wasIdle = false;
+    {
+        QMutexLocker locker(&m_mutex);
+        m_submitted++;
+        wasIdle = m_pending.isEmpty();
+
+        PendingStatus& pending = m_pending[model];
+        pending.model = model;
+        pending.validation = validation;
+        pending.status = status;
+    }
+
+    // Only the first change of a frame needs to arm the timer
+    if (wasIdle)
+    {
+        scheduleFlush();
+    }
+}
+
+void NodeStatusCoalescer::scheduleFlush()
+{
+    if (QThread::currentThread() == thread())
+    {
+        if (!m_timer->isActive())
+        {
+            m_timer->start();
+        }
+        return;
+    }
+
+    QMetaObject::invokeMethod(this, [this]()
+    {
+        if (!m_timer->isActive())
+        {
+            m_timer->start();
+        }
+    }, Qt::QueuedConnection);
+}
+
+int NodeStatusCoalescer::flush()
+{
+    QHash<const void*, PendingStatus> pending;
+    {
+        QMutexLocker locker(&m_mutex);
+        pending.swap(m_pending);
+    }
+
+    int applied = 0;
+    for (const PendingStatus& change : pending)
+    {
+        QtNodes::NodeDelegateModel* model = change.model.data();
+        if (!model)
+        {
+            continue; // Node deleted meanwhile
+        }
+
+        // Each setter triggers a node repaint, so skip what is already shown
+        const QtNodes::NodeValidationState current = model->validationState();
+        bool changed = false;
+        if (current._state != change.validation._state ||
+            current._stateMessage != change.validation._stateMessage)
+        {
+            model->setValidationState(change.validation);
+            changed = true;
+        }
+        if (model->processingStatus() != change.status)
+        {
+            model->setNodeProcessingStatus(change.status);
+            changed = true;
+        }
+        if (changed)
+        {
+            applied++;
+        }
+    }
+
+    QMutexLocker locker(&m_mutex);
+    m_applied += applied;
+    return applied;
+}
+
+void NodeStatusCoalescer::setIntervalMs(int intervalMs)
+{
+    m_timer->setInterval(qMax(0, intervalMs));
+}
+
+int NodeStatusCoalescer::intervalMs() const
+{
+    return m_timer->interval();
+}
+
+qint64 NodeStatusCoalescer::submittedCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_submitted;
+}
+
+qint64 NodeStatusCoalescer::appliedCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_applied;
+}
+
+} // namespace VisionBox
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Node Status Coalescer - Batches node status repaints per display frame
+ ******************************************************************************/
+
+#ifndef VISIONBOX_NODE_STATUS_COALESCER_H
+#define VISIONBOX_NODE_STATUS_COALESCER_H
+
+#include <QtNodes/internal/NodeDelegateModel.hpp>
+#include <QObject>
+#include <QHash>
+#include <QMutex>
+#include <QPointer>
+
+class QTimer;
+
+namespace VisionBox {
+
+/**
+ * @brief Collects node validation/processing status changes and applies them
+ *        once per display frame
+ *
+ * Setting a status on a NodeDelegateModel requests a node geometry update
+ * and repaint, so doing it after every execution makes scene cost scale
+ * with frame rate times node count. Nodes submit their status here instead;
+ * only the latest status per node is kept, and it is applied on the next
+ * flush only if it differs from what the node already shows.
+ *
+ * submit() may be called from any thread; flushing happens on the GUI thread.
+ */
+class NodeStatusCoalescer : public QObject
+{
+    Q_OBJECT
+
+public:
+    static NodeStatusCoalescer* instance();
+
+    // Queue the status to show for a node (latest submission wins)
+    void submit(QtNodes::NodeDelegateModel* model,
+                const QtNodes::NodeValidationState& validation,
+                QtNodes::NodeProcessingStatus status);
+
+    // Apply pending changes now; returns the number of nodes updated
+    int flush();
+
+    // Flush period (defaults to one 60 Hz frame)
+    void setIntervalMs(int intervalMs);
+    int intervalMs() const;
+
+    // Counters for diagnostics
+    qint64 submittedCount() const;
+    qint64 appliedCount() const;
+
+private:
+    NodeStatusCoalescer();
+    ~NodeStatusCoalescer() override = default;
+
+    struct PendingStatus
+    {
+        QPointer<QtNodes::NodeDelegateModel> model;  // Cleared if the node is deleted
+        QtNodes::NodeValidationState validation;
+        QtNodes::NodeProcessingStatus status = QtNodes::NodeProcessingStatus::NoStatus;
+    };
+
+    void scheduleFlush();
+
+    QTimer* m_timer = nullptr;
+    mutable QMutex m_mutex;
+    QHash<const void*, PendingStatus> m_pending;
+    qint64 m_submitted = 0;
+    qint64 m_applied = 0;
+
+    // Prevent copy
+    NodeStatusCoalescer(const NodeStatusCoalescer&) = delete;
+    NodeStatusCoalescer& operator=(const NodeStatusCoalescer&) = delete;
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_NODE_STATUS_COALESCER_H
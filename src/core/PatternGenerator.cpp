@@ -0,0 +1,420 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Pattern Generator Implementation
+ ******************************************************************************/
+
+#include "PatternGenerator.h"
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace VisionBox {
+
+namespace {
+
+// RNG stream for per-object layout (frames use the frame index as stream)
+constexpr quint64 kLayoutStream = ~0ULL;
+
+// SplitMix64 finalizer
+quint64 splitMix64(quint64 z)
+{
+    z += 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Independent RNG state for (seed, stream)
+quint64 mixSeed(quint64 seed, quint64 stream)
+{
+    return splitMix64(splitMix64(seed) ^ stream);
+}
+
+// Counter-based generator: 64 random bits for element `counter` of stream `key`
+inline quint64 counterHash(quint64 key, quint64 counter)
+{
+    return splitMix64(key + counter * 0x9E3779B97F4A7C15ULL);
+}
+
+cv::Scalar randomColor(cv::RNG& rng, int channels)
+{
+    if (channels == 1)
+    {
+        return cv::Scalar(rng.uniform(0, 256));
+    }
+    int b = rng.uniform(0, 256);
+    int g = rng.uniform(0, 256);
+    int r = rng.uniform(0, 256);
+    return cv::Scalar(b, g, r);
+}
+
+// Point with a random start and velocity, advanced by `phase` frames (wraps around)
+cv::Point movingPoint(cv::RNG& rng, qint64 phase, int width, int height)
+{
+    int x0 = rng.uniform(0, width);
+    int y0 = rng.uniform(0, height);
+    int vx = rng.uniform(-4, 5);
+    int vy = rng.uniform(-4, 5);
+
+    auto wrap = [](qint64 value, int range)
+    {
+        return static_cast<int>(((value % range) + range) % range);
+    };
+
+    return cv::Point(wrap(x0 + vx * phase, width), wrap(y0 + vy * phase, height));
+}
+
+cv::Mat generateSolidColor(const PatternGenerator::Params& p, qint64 phase, cv::RNG& rng)
+{
+    int type = (p.channels == 1) ? CV_8UC1 : CV_8UC3;
+    cv::Mat image(p.height, p.width, type);
+
+    if (p.random)
+    {
+        // Random color (new one every frame)
+        image.setTo(randomColor(rng, p.channels));
+    }
+    else
+    {
+        // Intensity cycles with the animation phase
+        double intensity = std::fmod(p.value1 + phase, 256.0);
+        cv::Scalar value = (p.channels == 1) ?
+            cv::Scalar(intensity) :
+            cv::Scalar(intensity, intensity, intensity);
+        image.setTo(value);
+    }
+
+    return image;
+}
+
+cv::Mat generateGradient(const PatternGenerator::Params& p, qint64 phase)
+{
+    int type = (p.channels == 1) ? CV_8UC1 : CV_8UC3;
+    cv::Mat image(p.height, p.width, type);
+    const int cn = image.channels();
+
+    double startVal = p.value1;
+    double endVal = p.value2;
+
+    // Gradients scroll by one pixel per frame. Every row is a window into a
+    // 1-D lookup table, so the per-pixel work is a table read and a store.
+    int span = 0;
+    int offset = 0;
+    double denom = 1.0;
+    switch (p.pattern)
+    {
+        case PatternGenerator::GradientHorizontal:
+            span = p.width;
+            offset = static_cast<int>(phase % span);
+            denom = std::max(1, p.width - 1);
+            break;
+        case PatternGenerator::GradientVertical:
+            span = p.height;
+            offset = static_cast<int>(phase % span);
+            denom = std::max(1, p.height - 1);
+            break;
+        default: // GradientDiagonal
+            span = p.width + p.height - 1;
+            offset = static_cast<int>(phase % span);
+            denom = std::max(1, p.width + p.height - 2);
+            break;
+    }
+
+    std::vector<uchar> lut(span);
+    for (int i = 0; i < span; ++i)
+    {
+        double value = startVal + (i / denom) * (endVal - startVal);
+        lut[i] = cv::saturate_cast<uchar>(std::max(0.0, std::min(255.0, value)));
+    }
+
+    const PatternGenerator::Pattern pattern = p.pattern;
+    const int width = p.width;
+
+    cv::parallel_for_(cv::Range(0, p.height), [&](const cv::Range& range)
+    {
+        for (int y = range.start; y < range.end; ++y)
+        {
+            uchar* row = image.ptr<uchar>(y);
+
+            if (pattern == PatternGenerator::GradientVertical)
+            {
+                std::memset(row, lut[(y + offset) % span], static_cast<size_t>(width) * cn);
+                continue;
+            }
+
+            int index = (pattern == PatternGenerator::GradientDiagonal) ? (y + offset) % span : offset;
+            for (int x = 0; x < width; ++x)
+            {
+                uchar value = lut[index];
+                for (int c = 0; c < cn; ++c)
+                {
+                    row[x * cn + c] = value;
+                }
+                if (++index == span)
+                {
+                    index = 0;
+                }
+            }
+        }
+    });
+
+    return image;
+}
+
+cv::Mat generateCheckerboard(const PatternGenerator::Params& p, qint64 phase)
+{
+    int type = (p.channels == 1) ? CV_8UC1 : CV_8UC3;
+    cv::Mat image(p.height, p.width, type);
+    int squareSize = static_cast<int>(p.value1);
+
+    // Board scrolls diagonally by one pixel per frame
+    int offset = static_cast<int>(phase % (2 * squareSize));
+
+    // Only two distinct rows exist; build both once and copy them
+    cv::Mat rows(2, p.width, type);
+    for (int x = 0; x < p.width; ++x)
+    {
+        bool evenColumn = ((x + offset) / squareSize) % 2 == 0;
+        rows.row(0).col(x).setTo(cv::Scalar::all(evenColumn ? 255 : 0));
+        rows.row(1).col(x).setTo(cv::Scalar::all(evenColumn ? 0 : 255));
+    }
+
+    const size_t rowBytes = image.cols * image.elemSize();
+
+    cv::parallel_for_(cv::Range(0, p.height), [&](const cv::Range& range)
+    {
+        for (int y = range.start; y < range.end; ++y)
+        {
+            int parity = ((y + offset) / squareSize) % 2;
+            std::memcpy(image.ptr(y), rows.ptr(parity), rowBytes);
+        }
+    });
+
+    return image;
+}
+
+cv::Mat generateGrid(const PatternGenerator::Params& p, qint64 phase)
+{
+    int type = (p.channels == 1) ? CV_8UC1 : CV_8UC3;
+    cv::Mat image(p.height, p.width, type);
+
+    int gridSize = static_cast<int>(p.value1);
+    int thickness = static_cast<int>(p.value2);
+
+    // Grid scrolls by one pixel per frame
+    int start = gridSize - static_cast<int>(phase % gridSize);
+
+    // Distance to the nearest line is below half the thickness on a line
+    auto onLine = [=](int v)
+    {
+        int d = ((v - start) % gridSize + gridSize) % gridSize;
+        d = std::min(d, gridSize - d);
+        return v >= start - thickness / 2 && 2 * d < thickness + 1;
+    };
+
+    // Template rows: background row with vertical lines, and a solid line row
+    cv::Mat rows(2, p.width, type, cv::Scalar::all(0));
+    rows.row(1).setTo(cv::Scalar::all(255));
+    for (int x = 0; x < p.width; ++x)
+    {
+        if (onLine(x))
+        {
+            rows.row(0).col(x).setTo(cv::Scalar::all(255));
+        }
+    }
+
+    const size_t rowBytes = image.cols * image.elemSize();
+
+    cv::parallel_for_(cv::Range(0, p.height), [&](const cv::Range& range)
+    {
+        for (int y = range.start; y < range.end; ++y)
+        {
+            std::memcpy(image.ptr(y), rows.ptr(onLine(y) ? 1 : 0), rowBytes);
+        }
+    });
+
+    return image;
+}
+
+cv::Mat generateCircles(const PatternGenerator::Params& p, qint64 phase)
+{
+    int type = (p.channels == 1) ? CV_8UC1 : CV_8UC3;
+    cv::Mat image(p.height, p.width, type, cv::Scalar::all(0));
+
+    int count = static_cast<int>(p.value1);
+    int radius = static_cast<int>(p.value2);
+
+    // Layout (start, velocity, color, size) depends on the seed only, so
+    // objects move smoothly from frame to frame
+    cv::RNG layout(mixSeed(static_cast<quint32>(p.seed), kLayoutStream));
+
+    for (int i = 0; i < count; ++i)
+    {
+        cv::Point center = movingPoint(layout, phase, p.width, p.height);
+
+        cv::Scalar color = p.random ?
+            randomColor(layout, p.channels) :
+            cv::Scalar::all(255);
+
+        int actualRadius = radius;
+        if (p.random)
+        {
+            actualRadius = layout.uniform(10, radius + 1);
+        }
+
+        cv::circle(image, center, actualRadius, color, -1);
+    }
+
+    return image;
+}
+
+cv::Mat generateRectangles(const PatternGenerator::Params& p, qint64 phase)
+{
+    int type = (p.channels == 1) ? CV_8UC1 : CV_8UC3;
+    cv::Mat image(p.height, p.width, type, cv::Scalar::all(0));
+
+    int count = static_cast<int>(p.value1);
+    int maxSize = static_cast<int>(p.value2);
+
+    cv::RNG layout(mixSeed(static_cast<quint32>(p.seed), kLayoutStream));
+
+    for (int i = 0; i < count; ++i)
+    {
+        int w = layout.uniform(10, maxSize + 1);
+        int h = layout.uniform(10, maxSize + 1);
+        cv::Point origin = movingPoint(layout, phase,
+                                       std::max(1, p.width - w),
+                                       std::max(1, p.height - h));
+
+        cv::Scalar color = p.random ?
+            randomColor(layout, p.channels) :
+            cv::Scalar::all(255);
+
+        cv::rectangle(image, origin, cv::Point(origin.x + w, origin.y + h), color, -1);
+    }
+
+    return image;
+}
+
+cv::Mat generateLines(const PatternGenerator::Params& p, qint64 phase)
+{
+    int type = (p.channels == 1) ? CV_8UC1 : CV_8UC3;
+    cv::Mat image(p.height, p.width, type, cv::Scalar::all(0));
+
+    int count = static_cast<int>(p.value1);
+    int thickness = static_cast<int>(p.value2);
+
+    cv::RNG layout(mixSeed(static_cast<quint32>(p.seed), kLayoutStream));
+
+    for (int i = 0; i < count; ++i)
+    {
+        cv::Point pt1 = movingPoint(layout, phase, p.width, p.height);
+        cv::Point pt2 = movingPoint(layout, phase, p.width, p.height);
+
+        cv::Scalar color = p.random ?
+            randomColor(layout, p.channels) :
+            cv::Scalar::all(255);
+
+        cv::line(image, pt1, pt2, color, thickness);
+    }
+
+    return image;
+}
+
+cv::Mat generateNoise(const PatternGenerator::Params& p, qint64 phase)
+{
+    int type = (p.channels == 1) ? CV_8UC1 : CV_8UC3;
+    cv::Mat image(p.height, p.width, type);
+
+    // Counter-based generation: every sample is a pure function of
+    // (seed, frame, element index), so the result does not depend on how
+    // rows are split across threads.
+    const quint64 key = mixSeed(static_cast<quint32>(p.seed), static_cast<quint64>(phase));
+    const int rowElems = image.cols * image.channels();
+    const bool gaussian = (p.pattern == PatternGenerator::GaussianNoise);
+    const double low = p.value1;
+    const double high = p.value2;
+
+    cv::parallel_for_(cv::Range(0, p.height), [&](const cv::Range& range)
+    {
+        for (int y = range.start; y < range.end; ++y)
+        {
+            uchar* row = image.ptr<uchar>(y);
+            const quint64 base = static_cast<quint64>(y) * rowElems;
+
+            if (gaussian)
+            {
+                // Sum of four 16-bit uniforms (Irwin-Hall), rescaled to unit
+                // variance: a cheap, branch-free normal approximation
+                const float mean = static_cast<float>(low);
+                const float scale = static_cast<float>(high * std::sqrt(3.0) / 65535.0);
+                for (int i = 0; i < rowElems; ++i)
+                {
+                    quint64 h = counterHash(key, base + i);
+                    float sum = static_cast<float>((h & 0xFFFF) + ((h >> 16) & 0xFFFF) +
+                                                   ((h >> 32) & 0xFFFF) + (h >> 48));
+                    row[i] = cv::saturate_cast<uchar>(mean + (sum - 2.0f * 65535.0f) * scale);
+                }
+            }
+            else
+            {
+                // Eight 8-bit uniforms per hash, mapped to [min, max)
+                const int minVal = static_cast<int>(low);
+                const int span = std::max(0, static_cast<int>(high) - minVal);
+                quint64 h = 0;
+                for (int i = 0; i < rowElems; ++i)
+                {
+                    const quint64 index = base + i;
+                    if ((index & 7) == 0 || i == 0)
+                    {
+                        h = counterHash(key, index >> 3);
+                    }
+                    int byte = static_cast<int>((h >> ((index & 7) * 8)) & 0xFF);
+                    row[i] = cv::saturate_cast<uchar>(minVal + ((byte * span) >> 8));
+                }
+            }
+        }
+    });
+
+    return image;
+}
+
+} // namespace
+
+/*******************************************************************************
+ * PatternGenerator Implementation
+ ******************************************************************************/
+cv::Mat PatternGenerator::render(const Params& params, qint64 frameIndex)
+{
+    // Everything random below derives from (seed, frame) only
+    cv::RNG rng(mixSeed(static_cast<quint32>(params.seed), static_cast<quint64>(frameIndex)));
+
+    switch (params.pattern)
+    {
+        case SolidColor:
+            return generateSolidColor(params, frameIndex, rng);
+        case GradientHorizontal:
+        case GradientVertical:
+        case GradientDiagonal:
+            return generateGradient(params, frameIndex);
+        case Checkerboard:
+            return generateCheckerboard(params, frameIndex);
+        case Grid:
+            return generateGrid(params, frameIndex);
+        case Circles:
+            return generateCircles(params, frameIndex);
+        case Rectangles:
+            return generateRectangles(params, frameIndex);
+        case Lines:
+            return generateLines(params, frameIndex);
+        case GaussianNoise:
+        case UniformNoise:
+            return generateNoise(params, frameIndex);
+    }
+
+    return cv::Mat();
+}
+
+} // namespace VisionBox
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Pattern Generator - Reproducible synthetic test frames
+ ******************************************************************************/
+
+#ifndef VISIONBOX_PATTERN_GENERATOR_H
+#define VISIONBOX_PATTERN_GENERATOR_H
+
+#include <QtGlobal>
+#include <opencv2/core.hpp>
+
+namespace VisionBox {
+
+/**
+ * @brief Renders the test patterns of the image generator node
+ *
+ * Every frame is a pure function of (parameters, frame index): random
+ * content derives from the seed and the frame index only, and per-pixel
+ * noise is counter-based, so the output does not depend on how rows are
+ * split across cv::parallel_for_ threads. render() touches no shared state
+ * and may run on several threads at once.
+ */
+class PatternGenerator
+{
+public:
+    enum Pattern
+    {
+        SolidColor = 0,
+        GradientHorizontal,
+        GradientVertical,
+        GradientDiagonal,
+        Checkerboard,
+        Grid,
+        Circles,
+        Rectangles,
+        Lines,
+        GaussianNoise,
+        UniformNoise
+    };
+
+    struct Params
+    {
+        Pattern pattern = SolidColor;
+        int width = 640;
+        int height = 480;
+        int channels = 3;         // 1 = grayscale, otherwise BGR
+        double value1 = 128.0;    // Intensity, noise mean, size, count...
+        double value2 = 30.0;     // Noise std, radius, thickness...
+        bool random = false;      // Random colors
+        int seed = 0;             // Seed for all random content
+    };
+
+    // Frame 'frameIndex' of the animated sequence (0 = the static image)
+    static cv::Mat render(const Params& params, qint64 frameIndex);
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_PATTERN_GENERATOR_H
@@ -80,21 +80,69 @@ void PerformanceMonitor::recordExecution(const void* nodeInstance,
         stats.maxExecutionTime = std::max(stats.maxExecutionTime, elapsedMicroseconds);
         stats.avgExecutionTime = stats.totalExecutionTime / stats.executionCount;
     }
+    stats.generation = m_generation.fetch_add(1, std::memory_order_release) + 1;
 
     // Emit signal with node instance
     emit statsUpdated(nodeInstance);
 }
 
+void PerformanceMonitor::recordMetric(const void* nodeInstance,
+                                      const QString& nodeCaption,
+                                      const QString& metric,
+                                      double value)
+{
+    if (!m_enabled)
+        return;
+
+    {
+        QMutexLocker locker(&m_mutex);
+
+        PerformanceStats& stats = m_stats[nodeInstance];
+        stats.nodeInstance = const_cast<void*>(nodeInstance);
+        if (stats.nodeCaption.isEmpty())
+        {
+            stats.nodeCaption = nodeCaption;
+            stats.nodeName = nodeCaption;
+        }
+        stats.metrics[metric] = value;
+        stats.generation = m_generation.fetch_add(1, std::memory_order_release) + 1;
+    }
+
+    // Emit outside the lock; may be called from worker threads (queued to the UI)
+    emit statsUpdated(nodeInstance);
+}
+
 QVector<PerformanceStats> PerformanceMonitor::getAllStats() const
 {
     QMutexLocker locker(&m_mutex);
     return m_stats.values().toVector();
 }
 
+QVector<PerformanceStats> PerformanceMonitor::changedSince(quint64 generation, quint64* current) const
+{
+    QVector<PerformanceStats> result;
+
+    QMutexLocker locker(&m_mutex);
+    for (const PerformanceStats& stats : m_stats)
+    {
+        if (stats.generation > generation)
+        {
+            result.append(stats);
+        }
+    }
+    if (current)
+    {
+        *current = m_generation.load(std::memory_order_acquire);
+    }
+
+    return result;
+}
+
 void PerformanceMonitor::clear()
 {
     QMutexLocker locker(&m_mutex);
     m_stats.clear();
+    m_generation.fetch_add(1, std::memory_order_release);
     emit statsCleared();
 }
 
@@ -13,6 +13,7 @@
 #include <QVector>
 #include <QMutex>
 #include <QJsonObject>
+#include <atomic>
 
 namespace VisionBox {
 
@@ -30,6 +31,8 @@ struct PerformanceStats
     qint64 maxExecutionTime;    // Maximum execution time
     qint64 totalExecutionTime;  // Total execution time
     int executionCount;         // Number of executions
+    QMap<QString, double> metrics; // Node-reported values (queue depth, encode time, ...)
+    quint64 generation;         // Monitor generation of the last change
 
     PerformanceStats()
         : nodeName()
@@ -41,6 +44,7 @@ struct PerformanceStats
         , maxExecutionTime(0)
         , totalExecutionTime(0)
         , executionCount(0)
+        , generation(0)
     {}
 
     // Get execution time in milliseconds
@@ -60,6 +64,15 @@ struct PerformanceStats
         obj["minMs"] = minMs();
         obj["maxMs"] = maxMs();
         obj["executionCount"] = executionCount;
+        if (!metrics.isEmpty())
+        {
+            QJsonObject metricsObj;
+            for (auto it = metrics.constBegin(); it != metrics.constEnd(); ++it)
+            {
+                metricsObj[it.key()] = it.value();
+            }
+            obj["metrics"] = metricsObj;
+        }
         return obj;
     }
 
@@ -121,9 +134,21 @@ public:
                         const QString& nodeCaption,
                         qint64 elapsedMicroseconds);
 
+    // Record a named value for a node (e.g. queue depth reported by a worker thread)
+    void recordMetric(const void* nodeInstance,
+                      const QString& nodeCaption,
+                      const QString& metric,
+                      double value);
+
     // Get all statistics
     QVector<PerformanceStats> getAllStats() const;
 
+    // Incremental reads for views: generation() is lock-free and changes on
+    // every update; changedSince() copies only entries updated after the
+    // given generation and reports the generation it read up to.
+    quint64 generation() const { return m_generation.load(std::memory_order_acquire); }
+    QVector<PerformanceStats> changedSince(quint64 generation, quint64* current) const;
+
     // Clear all statistics
     void clear();
 
@@ -150,6 +175,7 @@ private:
     mutable QMutex m_mutex;
     QMap<const void*, PerformanceStats> m_stats;  // Use pointer as key
     bool m_enabled;
+    std::atomic<quint64> m_generation{0};
 
     // Prevent copy
     PerformanceMonitor(const PerformanceMonitor&) = delete;
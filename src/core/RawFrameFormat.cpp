@@ -0,0 +1,306 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Raw Frame Format Implementation
+ ******************************************************************************/
+
+#include "RawFrameFormat.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QMap>
+#include <QRegularExpression>
+#include <QStringList>
+#include <QVector>
+#include <QtEndian>
+#include <opencv2/core.hpp>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+
+namespace VisionBox {
+
+namespace {
+
+// Optional non-negative integer field; false if present but not one
+bool readCount(const QJsonObject& sidecar, const char* key, qint64& value)
+{
+    const QJsonValue json = sidecar[key];
+    if (json.isUndefined())
+    {
+        return true;
+    }
+
+    const double number = json.toDouble(-1.0);
+    if (!json.isDouble() || number < 0.0 || number != std::floor(number) || number > 9.0e15)
+    {
+        return false;
+    }
+    value = static_cast<qint64>(number);
+    return true;
+}
+
+} // namespace
+
+/*******************************************************************************
+ * Type Names
+ ******************************************************************************/
+int RawFrameFormat::depthFromTypeCode(const QString& code)
+{
+    if (code == "u1" || code == "b1") return CV_8U;
+    if (code == "i1") return CV_8S;
+    if (code == "u2") return CV_16U;
+    if (code == "i2") return CV_16S;
+    if (code == "i4") return CV_32S;
+    if (code == "f2") return CV_16F;
+    if (code == "f4") return CV_32F;
+    if (code == "f8") return CV_64F;
+    return -1;
+}
+
+int RawFrameFormat::depthFromDtypeName(const QString& name)
+{
+    static const QMap<QString, int> names = {
+        {"uint8", CV_8U}, {"int8", CV_8S},
+        {"uint16", CV_16U}, {"int16", CV_16S},
+        {"int32", CV_32S}, {"float16", CV_16F},
+        {"float32", CV_32F}, {"float64", CV_64F}
+    };
+
+    QString key = name.trimmed().toLower();
+    if (names.contains(key))
+    {
+        return names.value(key);
+    }
+
+    // Accept NumPy descriptors such as "<u2" as well
+    if (key.startsWith('<') || key.startsWith('|') || key.startsWith('='))
+    {
+        key = key.mid(1);
+    }
+    return depthFromTypeCode(key);
+}
+
+QString RawFrameFormat::typeName(int type)
+{
+    static const char* depths[] = {"8U", "8S", "16U", "16S", "32S", "32F", "64F", "16F"};
+    return QString("%1C%2").arg(depths[CV_MAT_DEPTH(type)]).arg(CV_MAT_CN(type));
+}
+
+/*******************************************************************************
+ * NPY Header
+ ******************************************************************************/
+bool RawFrameFormat::parseNpyHeader(const uchar* data, qint64 size, RawFrameLayout& layout,
+                                    QString& error)
+{
+    static const char kMagic[] = "\x93NUMPY";
+    if (!data || size < 10 || std::memcmp(data, kMagic, 6) != 0)
+    {
+        error = "Not an NPY file";
+        return false;
+    }
+
+    const int major = data[6];
+    qint64 headerLength = 0;
+    qint64 headerStart = 0;
+    if (major == 1)
+    {
+        headerLength = qFromLittleEndian<quint16>(data + 8);
+        headerStart = 10;
+    }
+    else if (major == 2 || major == 3)
+    {
+        if (size < 12)
+        {
+            error = "Truncated NPY header";
+            return false;
+        }
+        headerLength = qFromLittleEndian<quint32>(data + 8);
+        headerStart = 12;
+    }
+    else
+    {
+        error = QString("Unsupported NPY version %1").arg(major);
+        return false;
+    }
+
+    if (headerStart + headerLength > size)
+    {
+        error = "Truncated NPY header";
+        return false;
+    }
+
+    const QString header = QString::fromLatin1(
+        reinterpret_cast<const char*>(data + headerStart), static_cast<int>(headerLength));
+
+    QRegularExpressionMatch descr =
+        QRegularExpression("'descr'\\s*:\\s*'([<>|=])(\\w\\d+)'").match(header);
+    QRegularExpressionMatch fortran =
+        QRegularExpression("'fortran_order'\\s*:\\s*(True|False)").match(header);
+    QRegularExpressionMatch shape =
+        QRegularExpression("'shape'\\s*:\\s*\\(([^)]*)\\)").match(header);
+
+    if (!descr.hasMatch() || !shape.hasMatch())
+    {
+        error = "Malformed NPY header";
+        return false;
+    }
+    if (fortran.hasMatch() && fortran.captured(1) == "True")
+    {
+        error = "Fortran-ordered arrays are not supported";
+        return false;
+    }
+
+    const int depth = depthFromTypeCode(descr.captured(2));
+    if (depth < 0)
+    {
+        error = "Unsupported NPY dtype: " + descr.captured(2);
+        return false;
+    }
+    if (descr.captured(1) == ">" && CV_ELEM_SIZE1(depth) > 1)
+    {
+        error = "Big-endian NPY data is not supported";
+        return false;
+    }
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+    const QStringList parts = shape.captured(1).split(',', Qt::SkipEmptyParts);
+#else
+    const QStringList parts = shape.captured(1).split(',', QString::SkipEmptyParts);
+#endif
+
+    QVector<qint64> dims;
+    for (const QString& part : parts)
+    {
+        bool ok = false;
+        qint64 value = part.trimmed().toLongLong(&ok);
+        if (!ok)
+        {
+            error = "Malformed NPY shape";
+            return false;
+        }
+        dims.append(value);
+    }
+
+    // (H, W) | (H, W, C<=4) | (N, H, W) | (N, H, W, C)
+    qint64 frames = 1, height = 0, width = 0, channels = 1;
+    if (dims.size() == 2)
+    {
+        height = dims[0]; width = dims[1];
+    }
+    else if (dims.size() == 3 && dims[2] <= 4)
+    {
+        height = dims[0]; width = dims[1]; channels = dims[2];
+    }
+    else if (dims.size() == 3)
+    {
+        frames = dims[0]; height = dims[1]; width = dims[2];
+    }
+    else if (dims.size() == 4)
+    {
+        frames = dims[0]; height = dims[1]; width = dims[2]; channels = dims[3];
+    }
+    else
+    {
+        error = QString("Unsupported NPY rank %1").arg(dims.size());
+        return false;
+    }
+
+    if (channels < 1 || channels > CV_CN_MAX || width <= 0 || height <= 0 ||
+        width > INT_MAX || height > INT_MAX || frames < 0)
+    {
+        error = "Unsupported NPY frame shape";
+        return false;
+    }
+
+    layout.width = static_cast<int>(width);
+    layout.height = static_cast<int>(height);
+    layout.type = CV_MAKETYPE(depth, static_cast<int>(channels));
+    layout.headerBytes = headerStart + headerLength;
+    layout.frameBytes = width * height * channels * CV_ELEM_SIZE1(depth);
+    layout.frameCount = static_cast<int>(std::min<qint64>(
+        {frames, (size - layout.headerBytes) / layout.frameBytes, INT_MAX}));
+    layout.formatName = "NPY";
+    return true;
+}
+
+/*******************************************************************************
+ * Raw Sidecar
+ ******************************************************************************/
+bool RawFrameFormat::parseRawSidecar(const QJsonObject& sidecar, qint64 fileSize,
+                                     RawFrameLayout& layout, QString& error)
+{
+    const int width = sidecar["width"].toInt();
+    const int height = sidecar["height"].toInt();
+    const int channels = sidecar["channels"].toInt(1);
+    const int depth = depthFromDtypeName(sidecar["dtype"].toString("uint8"));
+
+    if (width <= 0 || height <= 0 || channels < 1 || channels > CV_CN_MAX || depth < 0)
+    {
+        error = "Invalid sidecar layout";
+        return false;
+    }
+
+    const qint64 packedBytes = static_cast<qint64>(width) * height * channels * CV_ELEM_SIZE1(depth);
+
+    qint64 headerBytes = 0;
+    qint64 frameBytes = packedBytes;
+    qint64 frameCount = -1;
+    if (!readCount(sidecar, "headerBytes", headerBytes) ||
+        !readCount(sidecar, "frameBytes", frameBytes) ||
+        !readCount(sidecar, "frameCount", frameCount))
+    {
+        error = "Invalid sidecar: headerBytes, frameBytes and frameCount must be non-negative integers";
+        return false;
+    }
+    if (headerBytes > fileSize)
+    {
+        error = "Invalid sidecar: headerBytes is past the end of the file";
+        return false;
+    }
+
+    // A stride smaller than a frame would make frames overlap
+    frameBytes = std::max(packedBytes, frameBytes);
+
+    const qint64 available = (fileSize - headerBytes) / frameBytes;
+    if (frameCount < 0)
+    {
+        frameCount = available;
+    }
+    else if (frameCount > available)
+    {
+        error = QString("Invalid sidecar: %1 frames do not fit the file (%2 do)")
+                    .arg(frameCount).arg(available);
+        return false;
+    }
+
+    layout.width = width;
+    layout.height = height;
+    layout.type = CV_MAKETYPE(depth, channels);
+    layout.headerBytes = headerBytes;
+    layout.frameBytes = frameBytes;
+    layout.frameCount = static_cast<int>(std::min<qint64>(frameCount, INT_MAX));
+    layout.formatName = "RAW";
+    return true;
+}
+
+QJsonObject RawFrameFormat::readSidecar(const QString& filePath)
+{
+    QFileInfo info(filePath);
+    const QStringList candidates = {
+        filePath + ".json",
+        info.absolutePath() + "/" + info.completeBaseName() + ".json"
+    };
+
+    for (const QString& candidate : candidates)
+    {
+        QFile file(candidate);
+        if (file.open(QIODevice::ReadOnly))
+        {
+            return QJsonDocument::fromJson(file.readAll()).object();
+        }
+    }
+    return QJsonObject();
+}
+
+} // namespace VisionBox
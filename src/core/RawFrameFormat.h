@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Raw Frame Format - NPY headers and raw-dump sidecars
+ ******************************************************************************/
+
+#ifndef VISIONBOX_RAW_FRAME_FORMAT_H
+#define VISIONBOX_RAW_FRAME_FORMAT_H
+
+#include <QJsonObject>
+#include <QString>
+#include <QtGlobal>
+
+namespace VisionBox {
+
+/**
+ * @brief Where the frames of a raw or NPY file are and what they hold
+ *
+ * Frame i starts at headerBytes + i * frameBytes. A parsed layout always
+ * fits the file: no frame reaches past its end.
+ */
+struct RawFrameLayout
+{
+    qint64 headerBytes = 0;     // Offset of the first frame
+    qint64 frameBytes = 0;      // Distance between consecutive frames
+    int frameCount = 0;
+    int width = 0;
+    int height = 0;
+    int type = -1;              // OpenCV type (depth + channels)
+    QString formatName;         // "NPY" or "RAW"
+};
+
+/**
+ * @brief Parsers for the frame files read by the raw frame source
+ *
+ * NPY files describe themselves in their header. Raw dumps come with a JSON
+ * sidecar ("<file>.json" or "<base name>.json"):
+ *   {"width": 640, "height": 480, "channels": 1, "dtype": "uint16",
+ *    "headerBytes": 0, "frameBytes": 614400, "frameCount": 100}
+ * width and height are required; frameBytes (frame stride), headerBytes and
+ * frameCount are optional, the count defaulting to what the file holds.
+ */
+class RawFrameFormat
+{
+public:
+    // Layout from the NPY header at the start of a file of 'size' bytes
+    static bool parseNpyHeader(const uchar* data, qint64 size, RawFrameLayout& layout,
+                               QString& error);
+
+    // Layout from a sidecar describing a raw file of 'fileSize' bytes
+    static bool parseRawSidecar(const QJsonObject& sidecar, qint64 fileSize,
+                                RawFrameLayout& layout, QString& error);
+
+    // Sidecar next to filePath; empty if there is none
+    static QJsonObject readSidecar(const QString& filePath);
+
+    // NumPy type code ("u1", "f4", ...) or dtype name ("uint8", "<u2", ...)
+    // to an OpenCV depth; -1 if unsupported
+    static int depthFromTypeCode(const QString& code);
+    static int depthFromDtypeName(const QString& name);
+
+    // "16UC1" style name of an OpenCV type
+    static QString typeName(int type);
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_RAW_FRAME_FORMAT_H
@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Tile Grid Implementation
+ ******************************************************************************/
+
+#include "TileGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace VisionBox {
+
+/*******************************************************************************
+ * TileGrid Implementation
+ ******************************************************************************/
+std::vector<cv::Rect> TileGrid::cut(const cv::Size& imageSize, const cv::Size& tileSize,
+                                    double overlap)
+{
+    std::vector<cv::Rect> tiles;
+    if (imageSize.empty() || tileSize.empty())
+    {
+        return tiles;
+    }
+
+    const int tileWidth = std::min(tileSize.width, imageSize.width);
+    const int tileHeight = std::min(tileSize.height, imageSize.height);
+    const std::vector<int> xs = positions(imageSize.width, tileWidth, overlap);
+    const std::vector<int> ys = positions(imageSize.height, tileHeight, overlap);
+
+    tiles.reserve(xs.size() * ys.size());
+    for (int y : ys)
+    {
+        for (int x : xs)
+        {
+            tiles.emplace_back(x, y, tileWidth, tileHeight);
+        }
+    }
+    return tiles;
+}
+
+std::vector<int> TileGrid::positions(int length, int tile, double overlap)
+{
+    if (length <= tile)
+    {
+        return {0};
+    }
+
+    // Largest step that keeps the requested overlap, then spread evenly
+    const double clamped = std::clamp(overlap, 0.0, 0.9);
+    const double maxStep = std::max(1.0, tile * (1.0 - clamped));
+    const int count = static_cast<int>(std::ceil((length - tile) / maxStep)) + 1;
+
+    std::vector<int> origins(count);
+    const double step = static_cast<double>(length - tile) / (count - 1);
+    for (int i = 0; i < count; ++i)
+    {
+        origins[i] = static_cast<int>(std::lround(i * step));
+    }
+    return origins;
+}
+
+} // namespace VisionBox
@@ -0,0 +1,38 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Tile Grid - Overlapping tiles for sliced inference
+ ******************************************************************************/
+
+#ifndef VISIONBOX_TILE_GRID_H
+#define VISIONBOX_TILE_GRID_H
+
+#include <opencv2/core/types.hpp>
+#include <vector>
+
+namespace VisionBox {
+
+/**
+ * @brief Cuts a large frame into overlapping tiles
+ *
+ * Small objects shrink below what a detector can see when a 4K frame is
+ * resized to a 640x640 network input. Running the detector on tiles of
+ * about the input size keeps them at native resolution; neighbouring tiles
+ * overlap so an object cut by one tile border is whole in the next tile.
+ */
+class TileGrid
+{
+public:
+    // Tiles of tileSize (clipped to the image) covering the whole image.
+    // overlap is the minimum shared fraction of a tile (0.0 - 0.9); tiles
+    // are spread evenly so the last row and column end at the image edge.
+    static std::vector<cv::Rect> cut(const cv::Size& imageSize, const cv::Size& tileSize,
+                                     double overlap);
+
+private:
+    // Tile origins along one axis
+    static std::vector<int> positions(int length, int tile, double overlap);
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_TILE_GRID_H
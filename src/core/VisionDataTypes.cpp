@@ -6,12 +6,27 @@
 #include "VisionDataTypes.h"
 #include <QImage>
 #include <QDebug>
+#include <opencv2/imgproc.hpp>
 
 namespace VisionBox {
 
 /*******************************************************************************
  * ImageData Implementation
  ******************************************************************************/
+namespace {
+
+// Wrap a Mat in a read-only QImage without copying; the QImage keeps the
+// buffer alive and detaches if anyone paints on it. The pixels stay shared
+// with the Mat, so the Mat must not be written while the QImage is alive.
+QImage wrapMat(const cv::Mat& mat, QImage::Format format)
+{
+    auto* owner = new cv::Mat(mat);
+    return QImage(static_cast<const uchar*>(owner->data), owner->cols, owner->rows, static_cast<int>(owner->step),
+                  format, [](void* info) { delete static_cast<cv::Mat*>(info); }, owner);
+}
+
+} // namespace
+
 QImage ImageData::toQImage() const
 {
     if (m_image.empty())
@@ -20,31 +35,50 @@ QImage ImageData::toQImage() const
         return QImage();
     }
 
+    // Viewers of one output share a single conversion per buffer
+    QMutexLocker locker(&m_display.mutex);
+    if (m_display.source != m_image.data || m_display.image.isNull())
+    {
+        m_display.image = convertForDisplay();
+        m_display.source = m_image.data;
+    }
+    return m_display.image;
+}
+
+QImage ImageData::convertForDisplay() const
+{
     // Convert cv::Mat to QImage based on type
     switch (m_image.type())
     {
         case CV_8UC1:
         {
             // Grayscale 8-bit
-            QImage img(m_image.data, m_image.cols, m_image.rows,
-                       static_cast<int>(m_image.step), QImage::Format_Grayscale8);
-            return img.copy();
+            return wrapMat(m_image, QImage::Format_Grayscale8);
         }
 
         case CV_8UC3:
         {
-            // BGR 8-bit (OpenCV default) -> RGB
-            QImage img(m_image.data, m_image.cols, m_image.rows,
-                       static_cast<int>(m_image.step), QImage::Format_RGB888);
-            return img.rgbSwapped();
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+            // BGR 8-bit (OpenCV default), no swap needed
+            return wrapMat(m_image, QImage::Format_BGR888);
+#else
+            // BGR 8-bit -> RGB (SIMD swizzle)
+            cv::Mat rgb;
+            cv::cvtColor(m_image, rgb, cv::COLOR_BGR2RGB);
+            return wrapMat(rgb, QImage::Format_RGB888);
+#endif
         }
 
         case CV_8UC4:
         {
-            // BGRA 8-bit -> RGBA
-            QImage img(m_image.data, m_image.cols, m_image.rows,
-                       static_cast<int>(m_image.step), QImage::Format_ARGB32);
-            return img.rgbSwapped();
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+            // BGRA 8-bit is ARGB32 in little-endian memory order
+            return wrapMat(m_image, QImage::Format_ARGB32);
+#else
+            cv::Mat rgba;
+            cv::cvtColor(m_image, rgba, cv::COLOR_BGRA2RGBA);
+            return wrapMat(rgba, QImage::Format_RGBA8888);
+#endif
         }
 
         case CV_16UC1:
@@ -52,9 +86,7 @@ QImage ImageData::toQImage() const
             // 16-bit grayscale - convert to 8-bit
             cv::Mat temp;
             m_image.convertTo(temp, CV_8U, 255.0 / 65535.0);
-            QImage img(temp.data, temp.cols, temp.rows,
-                      static_cast<int>(temp.step), QImage::Format_Grayscale8);
-            return img.copy();
+            return wrapMat(temp, QImage::Format_Grayscale8);
         }
 
         case CV_32FC1:
@@ -62,9 +94,7 @@ QImage ImageData::toQImage() const
             // 32-bit float (0-1) - convert to 8-bit
             cv::Mat temp;
             m_image.convertTo(temp, CV_8U, 255.0);
-            QImage img(temp.data, temp.cols, temp.rows,
-                      static_cast<int>(temp.step), QImage::Format_Grayscale8);
-            return img.copy();
+            return wrapMat(temp, QImage::Format_Grayscale8);
         }
 
         default:
@@ -93,7 +123,7 @@ QImage ImageData::toQImage() const
             }
 
             m_image.convertTo(temp, cv_type);
-            return ImageData(temp).toQImage();
+            return ImageData(temp).convertForDisplay();
         }
     }
 }
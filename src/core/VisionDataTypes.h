@@ -10,6 +10,7 @@
 #include <opencv2/core/mat.hpp>
 #include <opencv2/features2d.hpp>
 #include <QImage>
+#include <QMutex>
 #include <QVector>
 #include <QRectF>
 #include <QString>
@@ -40,9 +41,14 @@ public:
     void setImage(const cv::Mat& image)
     {
         m_image = image;
+        m_display.reset();
     }
 
-    // Convert to QImage for display
+    // Convert to QImage for display. The result is computed once per
+    // buffer and shared by every caller; 8-bit images are wrapped without
+    // copying, so the QImage shows the Mat's pixels as they are when it is
+    // painted. The image must be treated as immutable once emitted: nodes
+    // that edit a buffer in place work on a clone, or call setImage().
     QImage toQImage() const;
 
     // NodeData interface
@@ -73,8 +79,57 @@ public:
         return m_image.channels();
     }
 
+    // Frame metadata set by streaming sources (-1 / 0.0 when unknown)
+    qint64 frameIndex() const
+    {
+        return m_frameIndex;
+    }
+
+    void setFrameIndex(qint64 index)
+    {
+        m_frameIndex = index;
+    }
+
+    double timestampMs() const
+    {
+        return m_timestampMs;
+    }
+
+    void setTimestampMs(double timestamp)
+    {
+        m_timestampMs = timestamp;
+    }
+
 private:
+    // Display conversion cache; copies of ImageData start with an empty one
+    struct DisplayCache
+    {
+        QMutex mutex;
+        const uchar* source = nullptr;  // Buffer the image was built from
+        QImage image;
+
+        DisplayCache() = default;
+        DisplayCache(const DisplayCache&) {}
+        DisplayCache& operator=(const DisplayCache&)
+        {
+            reset();
+            return *this;
+        }
+
+        void reset()
+        {
+            QMutexLocker locker(&mutex);
+            source = nullptr;
+            image = QImage();
+        }
+    };
+
+    QImage convertForDisplay() const;
+
     cv::Mat m_image;
+    qint64 m_frameIndex = -1;
+    double m_timestampMs = 0.0;
+    mutable DisplayCache m_display;
 };
 
 /*******************************************************************************
@@ -0,0 +1,148 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * YOLO Output Decoder Implementation
+ ******************************************************************************/
+
+#include "YoloDecoder.h"
+#include <opencv2/core.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#include <algorithm>
+
+namespace VisionBox {
+
+/*******************************************************************************
+ * Class Argmax
+ ******************************************************************************/
+int YoloDecoder::argmax(const float* values, int count, float& maxValue)
+{
+    if (count <= 0)
+    {
+        maxValue = 0.0f;
+        return -1;
+    }
+
+    int i = 0;
+    float best = values[0];
+
+#if CV_SIMD && !CV_SIMD_SCALABLE
+    // Vector max first, then locate the first lane holding it
+    const int lanes = cv::v_float32::nlanes;
+    if (count >= lanes)
+    {
+        cv::v_float32 vmax = cv::vx_load(values);
+        for (i = lanes; i <= count - lanes; i += lanes)
+        {
+            vmax = cv::v_max(vmax, cv::vx_load(values + i));
+        }
+        best = cv::v_reduce_max(vmax);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        best = std::max(best, values[i]);
+    }
+
+    maxValue = best;
+    for (int k = 0; k < count; ++k)
+    {
+        if (values[k] == best)
+        {
+            return k;
+        }
+    }
+    return 0; // Only reachable with NaN scores
+}
+
+/*******************************************************************************
+ * Row Decoding
+ ******************************************************************************/
+int YoloDecoder::decodeRows(const float* data, int rows, int rowStride,
+                            const Params& params, YoloCandidates& out)
+{
+    const int numClasses = rowStride - 5;
+    if (numClasses <= 0 || rows <= 0)
+    {
+        return 0;
+    }
+
+    const size_t before = out.size();
+    const float threshold = params.scoreThreshold;
+    const float maxX = static_cast<float>(params.clipWidth);
+    const float maxY = static_cast<float>(params.clipHeight);
+
+    for (int r = 0; r < rows; ++r)
+    {
+        const float* row = data + static_cast<size_t>(r) * rowStride;
+
+        // Early reject: class scores are at most 1, so objectness bounds the score
+        const float objectness = row[4];
+        if (objectness < threshold)
+        {
+            continue;
+        }
+
+        float classScore = 0.0f;
+        const int classId = argmax(row + 5, numClasses, classScore);
+        const float score = params.multiplyObjectness ? objectness * classScore : classScore;
+        if (score < threshold)
+        {
+            continue;
+        }
+
+        float w = row[2] * params.scaleX;
+        float h = row[3] * params.scaleY;
+        float left = (row[0] - params.offsetX) * params.scaleX - 0.5f * w;
+        float top = (row[1] - params.offsetY) * params.scaleY - 0.5f * h;
+
+        if (params.clipWidth > 0 && params.clipHeight > 0)
+        {
+            const float right = std::clamp(left + w, 0.0f, maxX - 1.0f);
+            const float bottom = std::clamp(top + h, 0.0f, maxY - 1.0f);
+            left = std::clamp(left, 0.0f, maxX - 1.0f);
+            top = std::clamp(top, 0.0f, maxY - 1.0f);
+            w = right - left;
+            h = bottom - top;
+        }
+
+        out.x.push_back(left);
+        out.y.push_back(top);
+        out.width.push_back(w);
+        out.height.push_back(h);
+        out.score.push_back(score);
+        out.classId.push_back(classId);
+    }
+
+    return static_cast<int>(out.size() - before);
+}
+
+int YoloDecoder::decode(const cv::Mat& output, const Params& params, YoloCandidates& out)
+{
+    if (output.empty() || output.depth() != CV_32F)
+    {
+        return 0;
+    }
+
+    int rows = 0;
+    int stride = 0;
+    if (output.dims == 3)
+    {
+        rows = output.size[1];
+        stride = output.size[2];
+    }
+    else if (output.dims == 2)
+    {
+        rows = output.rows;
+        stride = output.cols;
+    }
+    else
+    {
+        return 0;
+    }
+
+    // Network outputs are contiguous; copy once otherwise
+    cv::Mat contiguous = output.isContinuous() ? output : output.clone();
+    return decodeRows(contiguous.ptr<float>(), rows, stride, params, out);
+}
+
+} // namespace VisionBox
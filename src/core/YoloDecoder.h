@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * YOLO Output Decoder
+ ******************************************************************************/
+
+#ifndef VISIONBOX_YOLO_DECODER_H
+#define VISIONBOX_YOLO_DECODER_H
+
+#include <opencv2/core/mat.hpp>
+#include <vector>
+
+namespace VisionBox {
+
+/**
+ * @brief Decoded candidate boxes in structure-of-arrays layout
+ *
+ * Boxes are in image pixels (top-left corner and size). The arrays are
+ * cleared, not freed, between frames so steady-state decoding does not
+ * allocate.
+ */
+struct YoloCandidates
+{
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> width;
+    std::vector<float> height;
+    std::vector<float> score;
+    std::vector<int> classId;
+
+    size_t size() const { return score.size(); }
+    bool empty() const { return score.empty(); }
+
+    void clear()
+    {
+        x.clear();
+        y.clear();
+        width.clear();
+        height.clear();
+        score.clear();
+        classId.clear();
+    }
+
+    void reserve(size_t count)
+    {
+        x.reserve(count);
+        y.reserve(count);
+        width.reserve(count);
+        height.reserve(count);
+        score.reserve(count);
+        classId.reserve(count);
+    }
+
+    // Integer box of candidate i (for drawing and DetectionData)
+    cv::Rect rect(size_t i) const
+    {
+        return cv::Rect(static_cast<int>(x[i]), static_cast<int>(y[i]),
+                        static_cast<int>(width[i]), static_cast<int>(height[i]));
+    }
+};
+
+/**
+ * @brief Decoder for YOLO-style detection heads
+ *
+ * Rows are [cx, cy, w, h, objectness, class scores...]. The kernel reads the
+ * network output in place: rows whose objectness cannot reach the threshold
+ * are rejected before their class scores are touched, the class argmax is
+ * vectorized, and survivors are appended to a YoloCandidates.
+ */
+class YoloDecoder
+{
+public:
+    struct Params
+    {
+        float scoreThreshold = 0.5f;
+        bool multiplyObjectness = true;  // score = objectness * class (YOLOv5);
+                                         // false when class scores already include it (Darknet)
+        float scaleX = 1.0f;             // Output coordinates -> image pixels
+        float scaleY = 1.0f;
+        float offsetX = 0.0f;            // Subtracted before scaling (letterbox padding)
+        float offsetY = 0.0f;
+        int clipWidth = 0;               // Clip boxes to [0, clipWidth) x [0, clipHeight); 0 = off
+        int clipHeight = 0;
+    };
+
+    // Decode rows of a contiguous float buffer; returns the number appended
+    static int decodeRows(const float* data, int rows, int rowStride,
+                          const Params& params, YoloCandidates& out);
+
+    // Decode a 2-D [rows, 5 + classes] or 3-D [1, rows, 5 + classes] output
+    static int decode(const cv::Mat& output, const Params& params, YoloCandidates& out);
+
+    // Index and value of the largest of count floats
+    static int argmax(const float* values, int count, float& maxValue);
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_YOLO_DECODER_H
@@ -16,6 +16,8 @@
 #include <QColor>
 #include "ui/MainWindow.h"
 #include "core/PluginManager.h"
+#include "core/ImageCache.h"
+#include "core/FlightRecorder.h"
 
 int main(int argc, char* argv[])
 {
@@ -124,8 +126,68 @@ int main(int argc, char* argv[])
         "Disable automatic plugin loading from default directories.");
     parser.addOption(noAutoLoadOption);
 
+    // Option to size the shared decoded-image cache
+    QCommandLineOption imageCacheOption("image-cache-mb",
+        "Memory budget of the shared decoded-image cache in <megabytes> (0 disables it).",
+        "megabytes");
+    parser.addOption(imageCacheOption);
+
+    // Options to size the flight recorder of recent node outputs
+    QCommandLineOption recorderFramesOption("recorder-frames",
+        "Outputs the flight recorder keeps per node port (default 60).",
+        "count");
+    parser.addOption(recorderFramesOption);
+
+    QCommandLineOption recorderMemoryOption("recorder-mb",
+        "Memory cap of the flight recorder in <megabytes> (default 256).",
+        "megabytes");
+    parser.addOption(recorderMemoryOption);
+
     parser.process(app);
 
+    if (parser.isSet(imageCacheOption))
+    {
+        bool ok = false;
+        qint64 megabytes = parser.value(imageCacheOption).toLongLong(&ok);
+        if (ok && megabytes >= 0)
+        {
+            VisionBox::ImageCache::instance()->setCapacityBytes(megabytes * 1024 * 1024);
+            qDebug() << "Image cache budget:" << megabytes << "MB";
+        }
+        else
+        {
+            qWarning() << "Invalid image cache size:" << parser.value(imageCacheOption);
+        }
+    }
+
+    if (parser.isSet(recorderFramesOption))
+    {
+        bool ok = false;
+        int frames = parser.value(recorderFramesOption).toInt(&ok);
+        if (ok && frames > 0)
+        {
+            VisionBox::FlightRecorder::instance()->setFramesPerNode(frames);
+        }
+        else
+        {
+            qWarning() << "Invalid recorder frame count:" << parser.value(recorderFramesOption);
+        }
+    }
+
+    if (parser.isSet(recorderMemoryOption))
+    {
+        bool ok = false;
+        qint64 megabytes = parser.value(recorderMemoryOption).toLongLong(&ok);
+        if (ok && megabytes >= 0)
+        {
+            VisionBox::FlightRecorder::instance()->setCapacityBytes(megabytes * 1024 * 1024);
+        }
+        else
+        {
+            qWarning() << "Invalid recorder memory cap:" << parser.value(recorderMemoryOption);
+        }
+    }
+
     // Get plugin manager instance
     VisionBox::PluginManager* pluginManager = VisionBox::PluginManager::instance();
 
@@ -5,6 +5,7 @@
 
 #include "DataFlowGraphModel.h"
 #include "core/PluginManager.h"
+#include "core/FlightRecorder.h"
 #include <QtNodes/NodeDelegateModelRegistry>
 #include <QtNodes/NodeDelegateModel>
 #include <QtNodes/Definitions>
@@ -141,6 +142,10 @@ DataFlowGraphModel::DataFlowGraphModel(std::shared_ptr<PluginManager> pluginMana
     : QtNodes::DataFlowGraphModel(buildRegistry(pluginManager))
     , m_pluginManager(pluginManager)
 {
+    connect(this, &QtNodes::AbstractGraphModel::nodeCreated,
+            this, [this](NodeId nodeId) { attachRecorder(nodeId); });
+    connect(this, &QtNodes::AbstractGraphModel::nodeDeleted,
+            this, [this](NodeId nodeId) { detachRecorder(nodeId); });
 }
 
 DataFlowGraphModel::~DataFlowGraphModel()
@@ -156,6 +161,56 @@ std::shared_ptr<QtNodes::NodeDelegateModelRegistry> DataFlowGraphModel::registry
     return dataModelRegistry();
 }
 
+/*******************************************************************************
+ * Flight Recorder
+ ******************************************************************************/
+void DataFlowGraphModel::attachRecorder(NodeId nodeId)
+{
+    auto* model = delegateModel<QtNodes::NodeDelegateModel>(nodeId);
+    if (!model)
+    {
+        return;
+    }
+
+    m_nodeInstances.insert(nodeId, model);
+
+    // Outputs are only fetched when this node is actually being recorded
+    connect(model, &QtNodes::NodeDelegateModel::dataUpdated, this,
+            [model](QtNodes::PortIndex const portIndex)
+            {
+                FlightRecorder* recorder = FlightRecorder::instance();
+                if (recorder->isNodeEnabled(model))
+                {
+                    recorder->record(model, model->caption(), static_cast<int>(portIndex),
+                                     model->outData(portIndex));
+                }
+            });
+}
+
+void DataFlowGraphModel::detachRecorder(NodeId nodeId)
+{
+    const void* model = m_nodeInstances.take(nodeId);
+    if (model)
+    {
+        FlightRecorder::instance()->removeNode(model);
+    }
+}
+
+void DataFlowGraphModel::setNodeRecording(NodeId nodeId, bool enabled)
+{
+    const void* model = m_nodeInstances.value(nodeId, nullptr);
+    if (model)
+    {
+        FlightRecorder::instance()->setNodeEnabled(model, enabled);
+    }
+}
+
+bool DataFlowGraphModel::isNodeRecording(NodeId nodeId) const
+{
+    const void* model = m_nodeInstances.value(nodeId, nullptr);
+    return model && FlightRecorder::instance()->isNodeEnabled(model);
+}
+
 /*******************************************************************************
  * Serialization
  ******************************************************************************/
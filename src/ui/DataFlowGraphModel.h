@@ -11,6 +11,7 @@
 #include <QtNodes/Definitions>
 #include <QUuid>
 #include <QMap>
+#include <QHash>
 #include <QString>
 #include <memory>
 
@@ -25,7 +26,7 @@ class PluginManager;
  *
  * Extends QtNodes::DataFlowGraphModel to integrate with VisionBox's
  * plugin system. Provides node models from loaded plugins and handles
- * graph serialization.
+ * graph serialization. Forwards node outputs to the flight recorder.
  ******************************************************************************/
 class DataFlowGraphModel : public ::QtNodes::DataFlowGraphModel
 {
@@ -45,7 +46,16 @@ public:
     // Get the node registry
     std::shared_ptr<QtNodes::NodeDelegateModelRegistry> registry();
 
+    // Flight recorder selection per node
+    void setNodeRecording(NodeId nodeId, bool enabled);
+    bool isNodeRecording(NodeId nodeId) const;
+
+private:
+    void attachRecorder(NodeId nodeId);
+    void detachRecorder(NodeId nodeId);
+
 private:
+    QHash<NodeId, const void*> m_nodeInstances;     // Delegate model per node
     std::shared_ptr<PluginManager> m_pluginManager;
 };
 
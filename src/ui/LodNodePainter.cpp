@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Level-of-Detail Node Painter Implementation
+ ******************************************************************************/
+
+#include "LodNodePainter.h"
+#include <QtNodes/internal/AbstractGraphModel.hpp>
+#include <QtNodes/internal/AbstractNodeGeometry.hpp>
+#include <QtNodes/internal/BasicGraphicsScene.hpp>
+#include <QtNodes/internal/NodeGraphicsObject.hpp>
+#include <QtNodes/internal/NodeStyle.hpp>
+#include <QJsonDocument>
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
+
+namespace VisionBox {
+
+namespace {
+
+// Below this scale captions would be unreadable anyway
+constexpr double kCaptionThreshold = 0.15;
+
+} // namespace
+
+LodNodePainter::LodNodePainter(double detailThreshold)
+    : m_detailThreshold(detailThreshold)
+{
+}
+
+void LodNodePainter::paint(QPainter* painter, ::QtNodes::NodeGraphicsObject& ngo) const
+{
+    const double lod = QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform());
+    if (lod >= m_detailThreshold)
+    {
+        ::QtNodes::DefaultNodePainter::paint(painter, ngo);
+        return;
+    }
+
+    paintGlyph(painter, ngo, lod);
+}
+
+void LodNodePainter::paintGlyph(QPainter* painter, ::QtNodes::NodeGraphicsObject& ngo, double lod) const
+{
+    ::QtNodes::AbstractGraphModel& model = ngo.graphModel();
+    const ::QtNodes::NodeId nodeId = ngo.nodeId();
+    const QSize size = ngo.nodeScene()->nodeGeometry().size(nodeId);
+
+    QJsonDocument json = QJsonDocument::fromVariant(model.nodeData(nodeId, ::QtNodes::NodeRole::Style));
+    ::QtNodes::NodeStyle nodeStyle(json.object());
+
+    // Flat box: no gradient, shadow or ports
+    QPen pen(ngo.isSelected() ? nodeStyle.SelectedBoundaryColor : nodeStyle.NormalBoundaryColor);
+    pen.setCosmetic(true);
+    pen.setWidthF(ngo.isSelected() ? 2.0 : 1.0);
+    painter->setPen(pen);
+    painter->setBrush(nodeStyle.GradientColor1);
+
+    const QRectF box(QPointF(0, 0), size);
+    painter->drawRoundedRect(box, 3.0, 3.0);
+
+    if (lod < kCaptionThreshold)
+    {
+        return;
+    }
+
+    // Caption enlarged to stay legible at the current zoom
+    QFont font = painter->font();
+    font.setBold(true);
+    font.setPointSizeF(qMin(font.pointSizeF() / lod, box.height() * 0.4));
+    painter->setFont(font);
+    painter->setPen(nodeStyle.FontColor);
+    painter->drawText(box.adjusted(4, 4, -4, -4),
+                      Qt::AlignCenter | Qt::TextWordWrap,
+                      model.nodeData(nodeId, ::QtNodes::NodeRole::Caption).toString());
+}
+
+} // namespace VisionBox
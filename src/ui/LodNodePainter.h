@@ -0,0 +1,39 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Level-of-Detail Node Painter
+ ******************************************************************************/
+
+#ifndef VISIONBOX_LODNODEPAINTER_H
+#define VISIONBOX_LODNODEPAINTER_H
+
+#include <QtNodes/internal/DefaultNodePainter.hpp>
+
+namespace VisionBox {
+
+/*******************************************************************************
+ * LodNodePainter - Draws nodes as simple glyphs when zoomed out
+ *
+ * Above the threshold nodes are painted by the stock QtNodes painter. Below
+ * it, ports, gradients, shadows and per-port captions are skipped and each
+ * node becomes a flat rounded box with its caption, which keeps panning and
+ * zooming across hundreds of nodes cheap.
+ ******************************************************************************/
+class LodNodePainter : public ::QtNodes::DefaultNodePainter
+{
+public:
+    explicit LodNodePainter(double detailThreshold = 0.5);
+
+    void paint(QPainter* painter, ::QtNodes::NodeGraphicsObject& ngo) const override;
+
+    double detailThreshold() const { return m_detailThreshold; }
+    void setDetailThreshold(double threshold) { m_detailThreshold = threshold; }
+
+private:
+    void paintGlyph(QPainter* painter, ::QtNodes::NodeGraphicsObject& ngo, double lod) const;
+
+    double m_detailThreshold;
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_LODNODEPAINTER_H
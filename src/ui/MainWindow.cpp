@@ -7,6 +7,8 @@
 
 #include <QApplication>
 #include <QCloseEvent>
+#include <QDateTime>
+#include <QDir>
 #include <QFile>
 #include <QFileDialog>
 #include <QJsonDocument>
@@ -23,6 +25,7 @@
 #include "VisionBoxGraphicsView.h"
 #include "PerformancePanel.h"
 #include "core/PluginManager.h"
+#include "core/FlightRecorder.h"
 
 namespace VisionBox
 {
@@ -183,6 +186,30 @@ void MainWindow::createMenus()
   m_togglePerformancePanelAction->setShortcut(QKeySequence(tr("Ctrl+P")));
   m_togglePerformancePanelAction->setStatusTip("Show/hide the performance statistics panel");
 
+  // Recorder Menu (flight recorder of recent node outputs)
+  QMenu* recorderMenu = menuBar()->addMenu("&Recorder");
+
+  m_recordSelectedAction = recorderMenu->addAction("Record &Selected Nodes");
+  m_recordSelectedAction->setShortcut(QKeySequence(tr("Ctrl+R")));
+  m_recordSelectedAction->setStatusTip("Keep the most recent outputs of the selected nodes");
+
+  m_stopRecordingSelectedAction = recorderMenu->addAction("S&top Recording Selected Nodes");
+  m_stopRecordingSelectedAction->setStatusTip("Stop recording the selected nodes");
+
+  m_recordAllAction = recorderMenu->addAction("Record &All Nodes");
+  m_recordAllAction->setCheckable(true);
+  m_recordAllAction->setChecked(false);
+  m_recordAllAction->setStatusTip("Keep the most recent outputs of every node");
+
+  recorderMenu->addSeparator();
+
+  m_dumpRecorderAction = recorderMenu->addAction("&Dump Recording...");
+  m_dumpRecorderAction->setShortcut(QKeySequence(tr("Ctrl+Shift+D")));
+  m_dumpRecorderAction->setStatusTip("Write the recorded outputs to disk for replay");
+
+  m_clearRecorderAction = recorderMenu->addAction("&Clear Recording");
+  m_clearRecorderAction->setStatusTip("Discard all recorded outputs");
+
   // Plugins Menu
   QMenu* pluginsMenu = menuBar()->addMenu("&Plugins");
 
@@ -256,6 +283,13 @@ void MainWindow::createConnections()
   connect(m_toggleStatusBarAction, &QAction::triggered, this, &MainWindow::onToggleStatusBar);
   connect(m_togglePerformancePanelAction, &QAction::triggered, this, &MainWindow::onTogglePerformancePanel);
 
+  connect(m_recordSelectedAction, &QAction::triggered, this, &MainWindow::onRecordSelectedNodes);
+  connect(m_stopRecordingSelectedAction, &QAction::triggered, this,
+          &MainWindow::onStopRecordingSelectedNodes);
+  connect(m_recordAllAction, &QAction::toggled, this, &MainWindow::onRecordAllNodes);
+  connect(m_dumpRecorderAction, &QAction::triggered, this, &MainWindow::onDumpRecorder);
+  connect(m_clearRecorderAction, &QAction::triggered, this, &MainWindow::onClearRecorder);
+
   connect(m_loadPluginsAction, &QAction::triggered, this, &MainWindow::onLoadPlugins);
   connect(m_pluginInfoAction, &QAction::triggered, this, &MainWindow::onPluginInfo);
 
@@ -517,6 +551,88 @@ void MainWindow::onTogglePerformancePanel()
   }
 }
 
+/*******************************************************************************
+ * Recorder Menu Actions
+ ******************************************************************************/
+void MainWindow::onRecordSelectedNodes()
+{
+  auto selected = m_scene->selectedNodes();
+  for (auto nodeId : selected)
+  {
+    m_graphModel->setNodeRecording(nodeId, true);
+  }
+
+  statusBar()->showMessage(QString("Recording %1 node(s), last %2 outputs each")
+                               .arg(selected.size())
+                               .arg(FlightRecorder::instance()->framesPerNode()),
+                           3000);
+}
+
+void MainWindow::onStopRecordingSelectedNodes()
+{
+  auto selected = m_scene->selectedNodes();
+  for (auto nodeId : selected)
+  {
+    m_graphModel->setNodeRecording(nodeId, false);
+  }
+
+  statusBar()->showMessage(QString("Stopped recording %1 node(s)").arg(selected.size()), 3000);
+}
+
+void MainWindow::onRecordAllNodes(bool checked)
+{
+  FlightRecorder::instance()->setRecordAll(checked);
+  statusBar()->showMessage(checked ? "Recording all nodes" : "Recording selected nodes only",
+                           3000);
+}
+
+void MainWindow::onDumpRecorder()
+{
+  FlightRecorderStats stats = FlightRecorder::instance()->stats();
+  if (stats.frames == 0)
+  {
+    QMessageBox::information(this, "Dump Recording",
+                             "Nothing has been recorded yet.\n"
+                             "Use Recorder > Record Selected Nodes first.");
+    return;
+  }
+
+  QString dir = QFileDialog::getExistingDirectory(this, "Select Dump Directory", QDir::homePath(),
+                                                  QFileDialog::ShowDirsOnly);
+  if (dir.isEmpty())
+  {
+    return;
+  }
+
+  QString target = QDir(dir).filePath(
+      "flight_" + QDateTime::currentDateTime().toString("yyyyMMdd_HHmmss"));
+
+  QApplication::setOverrideCursor(Qt::WaitCursor);
+  QString error;
+  int written = FlightRecorder::instance()->dump(target, &error);
+  QApplication::restoreOverrideCursor();
+
+  if (!error.isEmpty())
+  {
+    QMessageBox::warning(this, "Dump Recording",
+                         QString("Dump incomplete (%1 outputs written):\n%2").arg(written).arg(error));
+    return;
+  }
+
+  QMessageBox::information(this, "Dump Recording",
+                           QString("Wrote %1 outputs to %2\n\n"
+                                   "Replay images with Raw Frame Source (.npy) and detections "
+                                   "with Detection Log Source (.vbdl).")
+                               .arg(written)
+                               .arg(target));
+}
+
+void MainWindow::onClearRecorder()
+{
+  FlightRecorder::instance()->clear();
+  statusBar()->showMessage("Recording cleared", 3000);
+}
+
 /*******************************************************************************
  * Help Menu Actions
  ******************************************************************************/
@@ -66,6 +66,13 @@ private slots:
     void onToggleStatusBar();
     void onTogglePerformancePanel();
 
+    // Recorder menu actions
+    void onRecordSelectedNodes();
+    void onStopRecordingSelectedNodes();
+    void onRecordAllNodes(bool checked);
+    void onDumpRecorder();
+    void onClearRecorder();
+
     // Help menu actions
     void onAbout();
     void onAboutQt();
@@ -112,6 +119,12 @@ private:
     QAction* m_toggleStatusBarAction;
     QAction* m_togglePerformancePanelAction;
 
+    QAction* m_recordSelectedAction;
+    QAction* m_stopRecordingSelectedAction;
+    QAction* m_recordAllAction;
+    QAction* m_dumpRecorderAction;
+    QAction* m_clearRecorderAction;
+
     QAction* m_loadPluginsAction;
     QAction* m_pluginInfoAction;
 
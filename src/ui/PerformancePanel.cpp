@@ -4,6 +4,8 @@
  ******************************************************************************/
 
 #include "PerformancePanel.h"
+#include "core/ImageCache.h"
+#include "core/FlightRecorder.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QHeaderView>
@@ -14,14 +16,19 @@
 #include <QJsonArray>
 #include <QColor>
 #include <QShowEvent>
+#include <QHideEvent>
 
 namespace VisionBox {
 
 PerformancePanel::PerformancePanel(QWidget* parent)
     : QWidget(parent)
+    , m_model(new PerformanceTableModel(this))
+    , m_proxyModel(new QSortFilterProxyModel(this))
     , m_table(nullptr)
     , m_sortCombo(nullptr)
     , m_summaryLabel(nullptr)
+    , m_cacheLabel(nullptr)
+    , m_recorderLabel(nullptr)
     , m_exportButton(nullptr)
     , m_clearButton(nullptr)
     , m_refreshButton(nullptr)
@@ -29,15 +36,14 @@ PerformancePanel::PerformancePanel(QWidget* parent)
 {
     setupUi();
 
-    // Connect to performance monitor signals
-    connect(PerformanceMonitor::instance(), &PerformanceMonitor::statsUpdated,
-            this, &PerformancePanel::onStatsUpdated);
+    // Per-execution statsUpdated signals are not connected: the timer polls
+    // the monitor's generation instead, which costs nothing when idle
     connect(PerformanceMonitor::instance(), &PerformanceMonitor::statsCleared,
             this, &PerformancePanel::onStatsCleared);
 
-    // Auto-refresh timer (every 2 seconds)
+    // Auto-refresh timer (runs while visible)
     connect(m_refreshTimer, &QTimer::timeout, this, &PerformancePanel::refresh);
-    m_refreshTimer->start(2000);
+    m_refreshTimer->setInterval(500);
 
     // Initial load
     refresh();
@@ -93,12 +99,33 @@ void PerformancePanel::setupUi()
     );
     mainLayout->addWidget(m_summaryLabel);
 
-    // Table
-    m_table = new QTableWidget();
-    m_table->setColumnCount(7);
-    m_table->setHorizontalHeaderLabels({
-        "Node", "Caption", "Last (ms)", "Avg (ms)", "Min (ms)", "Max (ms)", "Count"
-    });
+    // Shared image cache label
+    m_cacheLabel = new QLabel();
+    m_cacheLabel->setAlignment(Qt::AlignCenter);
+    m_cacheLabel->setStyleSheet(
+        "QLabel {"
+        "    background-color: #2b2b2b;"
+        "    color: #cccccc;"
+        "    padding: 4px;"
+        "    border-radius: 4px;"
+        "}"
+    );
+    mainLayout->addWidget(m_cacheLabel);
+
+    // Flight recorder summary
+    m_recorderLabel = new QLabel();
+    m_recorderLabel->setAlignment(Qt::AlignCenter);
+    m_recorderLabel->setStyleSheet(m_cacheLabel->styleSheet());
+    mainLayout->addWidget(m_recorderLabel);
+
+    // Table (rows stay in monitor order in the model, the proxy sorts them)
+    m_proxyModel->setSourceModel(m_model);
+    m_proxyModel->setSortRole(PerformanceTableModel::SortRole);
+    m_proxyModel->setDynamicSortFilter(true);
+
+    m_table = new QTableView();
+    m_table->setModel(m_proxyModel);
+    m_table->setSortingEnabled(true);
 
     // Configure table
     m_table->setSelectionBehavior(QAbstractItemView::SelectRows);
@@ -109,7 +136,7 @@ void PerformancePanel::setupUi()
 
     // Dark theme styling
     m_table->setStyleSheet(
-        "QTableWidget {"
+        "QTableView {"
         "    background-color: #2b2b2b;"
         "    alternate-background-color: #323232;"
         "    color: #ffffff;"
@@ -117,15 +144,15 @@ void PerformancePanel::setupUi()
         "    border: 1px solid #505050;"
         "    font-size: 11px;"
         "}"
-        "QTableWidget::item {"
+        "QTableView::item {"
         "    padding: 5px;"
         "    border: none;"
         "}"
-        "QTableWidget::item:selected {"
+        "QTableView::item:selected {"
         "    background-color: #4a6fa5;"
         "    color: #ffffff;"
         "}"
-        "QTableWidget::item:hover {"
+        "QTableView::item:hover {"
         "    background-color: #3a3a3a;"
         "}"
         "QHeaderView::section {"
@@ -137,7 +164,7 @@ void PerformancePanel::setupUi()
         "    border-bottom: 1px solid #505050;"
         "    font-weight: bold;"
         "}"
-        "QTableWidget QTableCornerButton::section {"
+        "QTableView QTableCornerButton::section {"
         "    background-color: #3d3d3d;"
         "    border: 1px solid #505050;"
         "}"
@@ -176,109 +203,80 @@ void PerformancePanel::setupUi()
     m_table->setColumnWidth(4, 80);  // Min
     m_table->setColumnWidth(5, 80);  // Max
     m_table->setColumnWidth(6, 60);  // Count
+    applySortOrder();
 
     mainLayout->addWidget(m_table);
 }
 
 void PerformancePanel::refresh()
 {
-    int sortIndex = m_sortCombo->currentData().toInt();
-    QVector<PerformanceStats> stats;
+    m_model->refresh();
+    updateSummary();
+    updateCacheSummary();
+    updateRecorderSummary();
+}
 
-    switch (sortIndex)
+void PerformancePanel::applySortOrder()
+{
+    switch (m_sortCombo->currentData().toInt())
     {
         case 0: // Average Time
-            stats = PerformanceMonitor::instance()->getSortedByAvgTime();
+            m_table->sortByColumn(PerformanceTableModel::AvgColumn, Qt::DescendingOrder);
             break;
         case 1: // Last Time
-            stats = PerformanceMonitor::instance()->getSortedByLastTime();
+            m_table->sortByColumn(PerformanceTableModel::LastColumn, Qt::DescendingOrder);
             break;
         case 2: // Execution Count
-            stats = PerformanceMonitor::instance()->getSortedByExecutionCount();
+            m_table->sortByColumn(PerformanceTableModel::CountColumn, Qt::DescendingOrder);
             break;
         case 3: // Node Name (alphabetical)
-        {
-            stats = PerformanceMonitor::instance()->getAllStats();
-            std::sort(stats.begin(), stats.end(),
-                [](const PerformanceStats& a, const PerformanceStats& b)
-                {
-                    return a.nodeName < b.nodeName;
-                });
+            m_table->sortByColumn(PerformanceTableModel::NodeColumn, Qt::AscendingOrder);
             break;
-        }
     }
+}
+
+void PerformancePanel::updateCacheSummary()
+{
+    ImageCacheStats cache = ImageCache::instance()->stats();
+
+    m_cacheLabel->setText(
+        QString("Image Cache: %1 images | %2 / %3 MB | Hits: %4 | Misses: %5 (%6% hit rate)")
+            .arg(cache.entryCount)
+            .arg(cache.residentMB(), 0, 'f', 1)
+            .arg(cache.capacityMB(), 0, 'f', 0)
+            .arg(cache.hits)
+            .arg(cache.misses)
+            .arg(cache.hitRate() * 100.0, 0, 'f', 1));
+}
 
-    updateTable(stats);
+void PerformancePanel::updateRecorderSummary()
+{
+    FlightRecorderStats recorder = FlightRecorder::instance()->stats();
+
+    m_recorderLabel->setText(
+        QString("Flight Recorder: %1 outputs in %2 streams | %3 / %4 MB (%5x) | Skipped: %6")
+            .arg(recorder.frames)
+            .arg(recorder.ringCount)
+            .arg(recorder.storedMB(), 0, 'f', 1)
+            .arg(recorder.capacityMB(), 0, 'f', 0)
+            .arg(recorder.compressionRatio(), 0, 'f', 1)
+            .arg(recorder.dropped));
 }
 
-void PerformancePanel::updateTable(const QVector<PerformanceStats>& stats)
+void PerformancePanel::updateSummary()
 {
-    m_table->setRowCount(stats.size());
+    const QVector<PerformanceStats>& stats = m_model->rows();
 
     double totalAvgTime = 0.0;
     int totalExecutions = 0;
     int slowNodeCount = 0;
 
-    for (int row = 0; row < stats.size(); ++row)
+    for (const PerformanceStats& stat : stats)
     {
-        const PerformanceStats& stat = stats[row];
-
-        // Node name - use caption with instance pointer for uniqueness
-        QString displayName = stat.nodeName;
-        if (displayName.isEmpty())
-        {
-            // Use caption as the name, add instance pointer for uniqueness
-            displayName = stat.nodeCaption;
-        }
-        // Add instance address to distinguish multiple instances of same type
-        QString instanceId = QString(" (0x%1)").arg(
-            reinterpret_cast<quintptr>(stat.nodeInstance), 0, 16);
-        QString uniqueName = displayName + instanceId;
-
-        auto* nameItem = new QTableWidgetItem(uniqueName);
-        m_table->setItem(row, 0, nameItem);
-
-        // Caption
-        auto* captionItem = new QTableWidgetItem(stat.nodeCaption);
-        m_table->setItem(row, 1, captionItem);
-
-        // Last execution time
-        auto* lastItem = new QTableWidgetItem(QString::number(stat.lastMs(), 'f', 2));
-        m_table->setItem(row, 2, lastItem);
-
-        // Average execution time
-        auto* avgItem = new QTableWidgetItem(QString::number(stat.avgMs(), 'f', 2));
-        m_table->setItem(row, 3, avgItem);
-
-        // Min execution time
-        auto* minItem = new QTableWidgetItem(QString::number(stat.minMs(), 'f', 2));
-        m_table->setItem(row, 4, minItem);
-
-        // Max execution time
-        auto* maxItem = new QTableWidgetItem(QString::number(stat.maxMs(), 'f', 2));
-        m_table->setItem(row, 5, maxItem);
-
-        // Execution count
-        auto* countItem = new QTableWidgetItem(QString::number(stat.executionCount));
-        m_table->setItem(row, 6, countItem);
-
-        // Color coding for slow nodes
-        QString color = getPerformanceColor(stat.avgMs(), stat.lastMs());
-        if (!color.isEmpty())
+        if (!PerformanceTableModel::performanceColor(stat.avgMs(), stat.lastMs()).isEmpty())
         {
-            for (int col = 0; col < 7; ++col)
-            {
-                if (auto* item = m_table->item(row, col))
-                {
-                    item->setBackground(QColor(color));
-                    // Ensure white text on colored backgrounds
-                    item->setForeground(QColor("#ffffff"));
-                }
-            }
             slowNodeCount++;
         }
-
-        // Statistics
         totalAvgTime += stat.avgMs();
         totalExecutions += stat.executionCount;
     }
@@ -316,46 +314,31 @@ QString PerformancePanel::formatTime(double milliseconds) const
         return QString::number(milliseconds / 1000.0, 'f', 2) + " s";
 }
 
-QString PerformancePanel::getPerformanceColor(double avgMs, double lastMs) const
-{
-    // Dark theme color coding for performance
-    // > 100ms: Dark Red (very slow)
-    // > 50ms: Dark Orange (slow)
-    // > 10ms: Dark Yellow (moderate)
-    // < 10ms: No color (fast)
-
-    if (avgMs > 100.0 || lastMs > 100.0)
-        return "#5c1a1a"; // Dark red
-    else if (avgMs > 50.0 || lastMs > 50.0)
-        return "#5c3a1a"; // Dark orange
-    else if (avgMs > 10.0 || lastMs > 10.0)
-        return "#5c5c1a"; // Dark yellow
-    else
-        return QString(); // No color
-}
-
-void PerformancePanel::onStatsUpdated(const void* nodeInstance)
-{
-    // Refresh on next timer tick to avoid excessive updates
-    Q_UNUSED(nodeInstance);
-}
-
 void PerformancePanel::showEvent(QShowEvent* event)
 {
     QWidget::showEvent(event);
     // Immediately refresh when panel becomes visible
     refresh();
+    m_refreshTimer->start();
+}
+
+void PerformancePanel::hideEvent(QHideEvent* event)
+{
+    QWidget::hideEvent(event);
+    // A hidden panel costs nothing during benchmarks
+    m_refreshTimer->stop();
 }
 
 void PerformancePanel::onStatsCleared()
 {
+    m_model->reset();
     refresh();
 }
 
 void PerformancePanel::onSortChanged(int index)
 {
     Q_UNUSED(index);
-    refresh();
+    applySortOrder();
 }
 
 void PerformancePanel::onExportClicked()
@@ -7,17 +7,23 @@
 #define VISIONBOX_PERFORMANCE_PANEL_H
 
 #include <QWidget>
-#include <QTableWidget>
+#include <QTableView>
+#include <QSortFilterProxyModel>
 #include <QComboBox>
 #include <QPushButton>
 #include <QLabel>
 #include <QTimer>
 #include "core/PerformanceMonitor.h"
+#include "PerformanceTableModel.h"
 
 namespace VisionBox {
 
 /**
  * @brief Dockable panel showing performance statistics for all nodes
+ *
+ * Backed by PerformanceTableModel, so each refresh only touches rows whose
+ * statistics changed; sorting is done by a proxy model. Refreshing stops
+ * while the panel is hidden.
  */
 class PerformancePanel : public QWidget
 {
@@ -31,24 +37,32 @@ public:
     void clearStats();
 
 private slots:
-    void onStatsUpdated(const void* nodeInstance);
     void onStatsCleared();
     void onSortChanged(int index);
     void onExportClicked();
 
 protected:
     void showEvent(QShowEvent* event) override;
+    void hideEvent(QHideEvent* event) override;
 
 private:
     void setupUi();
-    void updateTable(const QVector<PerformanceStats>& stats);
+    void applySortOrder();
+    void updateSummary();
+    void updateCacheSummary();
+    void updateRecorderSummary();
     QString formatTime(double milliseconds) const;
-    QString getPerformanceColor(double avgMs, double lastMs) const;
+
+    // Model
+    PerformanceTableModel* m_model;
+    QSortFilterProxyModel* m_proxyModel;
 
     // UI Components
-    QTableWidget* m_table;
+    QTableView* m_table;
     QComboBox* m_sortCombo;
     QLabel* m_summaryLabel;
+    QLabel* m_cacheLabel;
+    QLabel* m_recorderLabel;
     QPushButton* m_exportButton;
     QPushButton* m_clearButton;
     QPushButton* m_refreshButton;
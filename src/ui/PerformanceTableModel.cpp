@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Performance Statistics Table Model Implementation
+ ******************************************************************************/
+
+#include "PerformanceTableModel.h"
+#include <QColor>
+#include <QStringList>
+
+namespace VisionBox {
+
+PerformanceTableModel::PerformanceTableModel(QObject* parent)
+    : QAbstractTableModel(parent)
+{
+}
+
+int PerformanceTableModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : m_rows.size();
+}
+
+int PerformanceTableModel::columnCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant PerformanceTableModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_rows.size())
+    {
+        return QVariant();
+    }
+
+    const PerformanceStats& stat = m_rows[index.row()];
+
+    switch (role)
+    {
+        case Qt::DisplayRole:
+            switch (index.column())
+            {
+                case NodeColumn:
+                {
+                    // Caption with instance address to distinguish multiple instances
+                    QString displayName = stat.nodeName.isEmpty() ? stat.nodeCaption : stat.nodeName;
+                    return displayName + QString(" (0x%1)").arg(
+                        reinterpret_cast<quintptr>(stat.nodeInstance), 0, 16);
+                }
+                case CaptionColumn: return stat.nodeCaption;
+                case LastColumn:    return QString::number(stat.lastMs(), 'f', 2);
+                case AvgColumn:     return QString::number(stat.avgMs(), 'f', 2);
+                case MinColumn:     return QString::number(stat.minMs(), 'f', 2);
+                case MaxColumn:     return QString::number(stat.maxMs(), 'f', 2);
+                case CountColumn:   return stat.executionCount;
+            }
+            break;
+
+        case SortRole:
+            switch (index.column())
+            {
+                case NodeColumn:    return stat.nodeName.isEmpty() ? stat.nodeCaption : stat.nodeName;
+                case CaptionColumn: return stat.nodeCaption;
+                case LastColumn:    return stat.lastExecutionTime;
+                case AvgColumn:     return stat.avgExecutionTime;
+                case MinColumn:     return stat.minExecutionTime;
+                case MaxColumn:     return stat.maxExecutionTime;
+                case CountColumn:   return stat.executionCount;
+            }
+            break;
+
+        case Qt::BackgroundRole:
+        {
+            QString color = performanceColor(stat.avgMs(), stat.lastMs());
+            return color.isEmpty() ? QVariant() : QVariant(QColor(color));
+        }
+
+        case Qt::ForegroundRole:
+            // Ensure white text on colored backgrounds
+            return performanceColor(stat.avgMs(), stat.lastMs()).isEmpty()
+                       ? QVariant() : QVariant(QColor("#ffffff"));
+
+        case Qt::ToolTipRole:
+        {
+            // Node-reported metrics (queue depth, encode time, ...)
+            if (stat.metrics.isEmpty())
+            {
+                return QVariant();
+            }
+            QStringList lines;
+            for (auto it = stat.metrics.constBegin(); it != stat.metrics.constEnd(); ++it)
+            {
+                lines << QString("%1: %2").arg(it.key()).arg(it.value(), 0, 'f', 2);
+            }
+            return lines.join("\n");
+        }
+    }
+
+    return QVariant();
+}
+
+QVariant PerformanceTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+    {
+        return QVariant();
+    }
+
+    static const char* headers[ColumnCount] = {
+        "Node", "Caption", "Last (ms)", "Avg (ms)", "Min (ms)", "Max (ms)", "Count"
+    };
+    return (section >= 0 && section < ColumnCount) ? QString(headers[section]) : QVariant();
+}
+
+int PerformanceTableModel::refresh()
+{
+    PerformanceMonitor* monitor = PerformanceMonitor::instance();
+    if (monitor->generation() == m_generation)
+    {
+        return 0; // Nothing changed, no lock taken
+    }
+
+    const QVector<PerformanceStats> changes = monitor->changedSince(m_generation, &m_generation);
+
+    QVector<PerformanceStats> added;
+    for (const PerformanceStats& stat : changes)
+    {
+        auto found = m_rowIndex.constFind(stat.nodeInstance);
+        if (found == m_rowIndex.constEnd())
+        {
+            added.append(stat);
+            continue;
+        }
+
+        const int row = found.value();
+        m_rows[row] = stat;
+        Q_EMIT dataChanged(index(row, 0), index(row, ColumnCount - 1));
+    }
+
+    if (!added.isEmpty())
+    {
+        beginInsertRows(QModelIndex(), m_rows.size(), m_rows.size() + added.size() - 1);
+        for (const PerformanceStats& stat : added)
+        {
+            m_rowIndex.insert(stat.nodeInstance, m_rows.size());
+            m_rows.append(stat);
+        }
+        endInsertRows();
+    }
+
+    return changes.size();
+}
+
+void PerformanceTableModel::reset()
+{
+    beginResetModel();
+    m_rows.clear();
+    m_rowIndex.clear();
+    m_generation = 0;
+    endResetModel();
+}
+
+QString PerformanceTableModel::performanceColor(double avgMs, double lastMs)
+{
+    // Dark theme color coding for performance
+    // > 100ms: Dark Red (very slow)
+    // > 50ms: Dark Orange (slow)
+    // > 10ms: Dark Yellow (moderate)
+    // < 10ms: No color (fast)
+
+    if (avgMs > 100.0 || lastMs > 100.0)
+        return "#5c1a1a"; // Dark red
+    else if (avgMs > 50.0 || lastMs > 50.0)
+        return "#5c3a1a"; // Dark orange
+    else if (avgMs > 10.0 || lastMs > 10.0)
+        return "#5c5c1a"; // Dark yellow
+    else
+        return QString(); // No color
+}
+
+} // namespace VisionBox
@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * VisionBox - Computer Vision Research Framework
+ * Performance Statistics Table Model
+ ******************************************************************************/
+
+#ifndef VISIONBOX_PERFORMANCE_TABLE_MODEL_H
+#define VISIONBOX_PERFORMANCE_TABLE_MODEL_H
+
+#include <QAbstractTableModel>
+#include <QHash>
+#include <QVector>
+#include "core/PerformanceMonitor.h"
+
+namespace VisionBox {
+
+/**
+ * @brief Table model over PerformanceMonitor statistics
+ *
+ * refresh() pulls only the entries that changed since the previous call and
+ * emits dataChanged/rowsInserted for those rows alone; when nothing changed
+ * it returns without touching the monitor's lock. Rows keep their position
+ * in the model, sorting is left to a QSortFilterProxyModel using SortRole.
+ */
+class PerformanceTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Column
+    {
+        NodeColumn = 0,
+        CaptionColumn,
+        LastColumn,
+        AvgColumn,
+        MinColumn,
+        MaxColumn,
+        CountColumn,
+        ColumnCount
+    };
+
+    // Raw numeric value for sorting
+    static constexpr int SortRole = Qt::UserRole;
+
+    explicit PerformanceTableModel(QObject* parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+
+    // Apply changes from the monitor; returns the number of rows updated
+    int refresh();
+
+    // Drop all rows (after the monitor was cleared)
+    void reset();
+
+    const QVector<PerformanceStats>& rows() const { return m_rows; }
+
+    // Background color for slow nodes (empty when fast)
+    static QString performanceColor(double avgMs, double lastMs);
+
+private:
+    QVector<PerformanceStats> m_rows;
+    QHash<const void*, int> m_rowIndex;
+    quint64 m_generation = 0;
+};
+
+} // namespace VisionBox
+
+#endif // VISIONBOX_PERFORMANCE_TABLE_MODEL_H
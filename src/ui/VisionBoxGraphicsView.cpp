@@ -4,13 +4,103 @@
  ******************************************************************************/
 
 #include "VisionBoxGraphicsView.h"
+#include "LodNodePainter.h"
 #include <QtNodes/DataFlowGraphicsScene>
+#include <QtNodes/internal/NodeGraphicsObject.hpp>
+#include <QGraphicsProxyWidget>
 #include <QMimeData>
 #include <QDebug>
 #include <QTimer>
+#include <memory>
 
 namespace VisionBox {
 
+VisionBoxGraphicsView::VisionBoxGraphicsView(QWidget* parent)
+    : ::QtNodes::GraphicsView(parent)
+{
+    setupRendering();
+}
+
+VisionBoxGraphicsView::VisionBoxGraphicsView(::QtNodes::BasicGraphicsScene* scene, QWidget* parent)
+    : ::QtNodes::GraphicsView(scene, parent)
+{
+    setupRendering();
+}
+
+void VisionBoxGraphicsView::setupRendering()
+{
+    // Repaint only what changed instead of the whole viewport
+    setViewportUpdateMode(QGraphicsView::SmartViewportUpdate);
+
+    if (auto* scene = dynamic_cast<::QtNodes::BasicGraphicsScene*>(this->scene()))
+    {
+        scene->setNodePainter(std::make_unique<LodNodePainter>(kDetailThreshold));
+    }
+
+    m_cullTimer = new QTimer(this);
+    m_cullTimer->setSingleShot(true);
+    m_cullTimer->setInterval(16);
+    connect(m_cullTimer, &QTimer::timeout,
+            this, &VisionBoxGraphicsView::updateWidgetCulling);
+
+    // Nodes added while zoomed out or offscreen start culled too
+    if (auto* scene = dynamic_cast<::QtNodes::BasicGraphicsScene*>(this->scene()))
+    {
+        connect(&scene->graphModel(), &::QtNodes::AbstractGraphModel::nodeCreated,
+                m_cullTimer, QOverload<>::of(&QTimer::start));
+    }
+}
+
+void VisionBoxGraphicsView::drawBackground(QPainter* painter, const QRectF& rect)
+{
+    ::QtNodes::GraphicsView::drawBackground(painter, rect);
+
+    // Every pan or zoom repaints the background; re-cull when the view moved
+    const QRectF visible = mapToScene(viewport()->rect()).boundingRect();
+    const double scale = transform().m11();
+    if ((visible != m_lastVisibleRect || scale != m_lastScale) && !m_cullTimer->isActive())
+    {
+        m_cullTimer->start();
+    }
+}
+
+void VisionBoxGraphicsView::updateWidgetCulling()
+{
+    auto* scene = dynamic_cast<::QtNodes::BasicGraphicsScene*>(this->scene());
+    if (!scene)
+    {
+        return;
+    }
+
+    m_lastVisibleRect = mapToScene(viewport()->rect()).boundingRect();
+    m_lastScale = transform().m11();
+
+    // Show widgets slightly before they scroll into view
+    const qreal marginX = m_lastVisibleRect.width() * 0.25;
+    const qreal marginY = m_lastVisibleRect.height() * 0.25;
+    const QRectF shown = m_lastVisibleRect.adjusted(-marginX, -marginY, marginX, marginY);
+    const bool detailed = m_lastScale >= kDetailThreshold;
+
+    for (::QtNodes::NodeId nodeId : scene->graphModel().allNodeIds())
+    {
+        ::QtNodes::NodeGraphicsObject* ngo = scene->nodeGraphicsObject(nodeId);
+        if (!ngo)
+        {
+            continue;
+        }
+
+        const bool visible = detailed && ngo->sceneBoundingRect().intersects(shown);
+        for (QGraphicsItem* child : ngo->childItems())
+        {
+            auto* proxy = qgraphicsitem_cast<QGraphicsProxyWidget*>(child);
+            if (proxy && proxy->isVisible() != visible)
+            {
+                proxy->setVisible(visible);
+            }
+        }
+    }
+}
+
 void VisionBoxGraphicsView::contextMenuEvent(QContextMenuEvent* event)
 {
     // Check if there's an item under cursor - if so, let the item handle it
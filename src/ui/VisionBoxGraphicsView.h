@@ -12,10 +12,14 @@
 #include <QDragMoveEvent>
 #include <QDropEvent>
 #include <QPoint>
+#include <QRectF>
 #include <QHash>
 
+class QTimer;
+
 // Forward declarations
 namespace QtNodes {
+class BasicGraphicsScene;
 class DataFlowGraphicsScene;
 using NodeId = unsigned int;
 }
@@ -24,13 +28,22 @@ namespace VisionBox {
 
 /*******************************************************************************
  * VisionBoxGraphicsView - Custom GraphicsView that supports node dropping
+ *
+ * Keeps large graphs responsive: below kDetailThreshold nodes are drawn as
+ * simple glyphs (LodNodePainter) and their embedded widgets are hidden, and
+ * at any zoom the widgets of offscreen nodes are hidden so they are neither
+ * laid out nor repainted. Only changed regions of the viewport are redrawn.
  ******************************************************************************/
 class VisionBoxGraphicsView : public ::QtNodes::GraphicsView
 {
     Q_OBJECT
 
 public:
-    using ::QtNodes::GraphicsView::GraphicsView;
+    explicit VisionBoxGraphicsView(QWidget* parent = nullptr);
+    VisionBoxGraphicsView(::QtNodes::BasicGraphicsScene* scene, QWidget* parent = nullptr);
+
+    // Zoom level below which nodes collapse to glyphs
+    static constexpr double kDetailThreshold = 0.5;
 
 protected:
     // Disable only the scene context menu, not item interactions
@@ -41,15 +54,25 @@ protected:
     void dragMoveEvent(QDragMoveEvent* event) override;
     void dropEvent(QDropEvent* event) override;
 
+    // Watches pan and zoom to re-cull embedded widgets
+    void drawBackground(QPainter* painter, const QRectF& rect) override;
+
 private:
     void createNodeFromDrag(const QString& modelName, const QPoint& viewPos);
     void onNodeCreated(::QtNodes::NodeId nodeId);
     void setupNodePositioning();
+    void setupRendering();
+    void updateWidgetCulling();
 
 private:
     // Store the position for the next node to be created
     QPointF m_nextNodePosition;
     bool m_hasPendingPosition = false;
+
+    // Widget culling, throttled to one pass per frame
+    QTimer* m_cullTimer = nullptr;
+    QRectF m_lastVisibleRect;
+    double m_lastScale = -1.0;
 };
 
 } // namespace VisionBox
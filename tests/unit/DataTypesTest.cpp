@@ -4,8 +4,44 @@
  ******************************************************************************/
 
 #include <QtTest/QtTest>
+#include <QTemporaryDir>
+#include <opencv2/core.hpp>
 #include <opencv2/core/mat.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/dnn.hpp>
+#include <opencv2/imgproc.hpp>
 #include "core/VisionDataTypes.h"
+#include "core/ImageCache.h"
+#include "core/BoundedQueue.h"
+#include "core/DetectionLog.h"
+#include "core/FlightRecorder.h"
+#include "core/FrameCodec.h"
+#include "core/NodeError.h"
+#include "core/YoloDecoder.h"
+#include "core/DnnNetCache.h"
+#include "core/DnnModelLoader.h"
+#include "core/DnnBatcher.h"
+#include "core/BlobPreprocessor.h"
+#include "core/InferencePipeline.h"
+#include "core/TileGrid.h"
+#include "core/BoxNms.h"
+#include "core/DetectionCadence.h"
+#include "core/RawFrameFormat.h"
+#include "core/PatternGenerator.h"
+#include "core/ExportNaming.h"
+#include "StreamingFileWriter.h"
+#include "ui/PerformanceTableModel.h"
+#include "BoundingBoxOverlayModel.h"
+#include <QFile>
+#include <QJsonObject>
+#include <QElapsedTimer>
+#include <QThread>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <thread>
 
 using namespace VisionBox;
 
@@ -129,6 +165,66 @@ private slots:
         QCOMPARE(pixel[1], 0);   // G
         QCOMPARE(pixel[2], 0);   // R
     }
+
+    /***************************************************************************
+     * Display Conversion
+     **************************************************************************/
+    void testToQImageColors()
+    {
+        cv::Mat bgr(4, 6, CV_8UC3, cv::Scalar(10, 20, 30));
+        QImage image = ImageData(bgr).toQImage();
+        QCOMPARE(image.size(), QSize(6, 4));
+        QCOMPARE(image.pixel(2, 1), qRgb(30, 20, 10));
+
+        cv::Mat bgra(4, 6, CV_8UC4, cv::Scalar(10, 20, 30, 255));
+        QCOMPARE(ImageData(bgra).toQImage().pixel(0, 0), qRgb(30, 20, 10));
+
+        cv::Mat depth(4, 6, CV_16UC1, cv::Scalar(65535));
+        QCOMPARE(ImageData(depth).toQImage().pixel(5, 3), qRgb(255, 255, 255));
+    }
+
+    void testToQImageCachedPerBuffer()
+    {
+        ImageData data(cv::Mat(8, 8, CV_32FC1, cv::Scalar(0.5f)));
+
+        // Repeated calls share one conversion
+        QImage first = data.toQImage();
+        QImage second = data.toQImage();
+        QCOMPARE(first.constBits(), second.constBits());
+
+        // A new buffer is converted again
+        data.setImage(cv::Mat(8, 8, CV_32FC1, cv::Scalar(1.0f)));
+        QImage third = data.toQImage();
+        QVERIFY(third.constBits() != first.constBits());
+        QCOMPARE(third.pixel(0, 0), qRgb(255, 255, 255));
+        QCOMPARE(first.pixel(0, 0), qRgb(128, 128, 128));
+    }
+
+    void testToQImageWrapsWithoutCopy()
+    {
+        cv::Mat gray(8, 8, CV_8UC1, cv::Scalar(7));
+        QImage image = ImageData(gray).toQImage();
+        QCOMPARE(image.constBits(), static_cast<const uchar*>(gray.data));
+
+        // Painting on the QImage must not touch the Mat
+        image.setPixel(0, 0, 200);
+        QCOMPARE(gray.at<uchar>(0, 0), uchar(7));
+    }
+
+    /***************************************************************************
+     * Frame Metadata
+     **************************************************************************/
+    void testFrameMetadata()
+    {
+        ImageData data(cv::Mat(10, 10, CV_8UC1));
+        QCOMPARE(data.frameIndex(), qint64(-1));
+        QCOMPARE(data.timestampMs(), 0.0);
+
+        data.setFrameIndex(42);
+        data.setTimestampMs(1400.0);
+        QCOMPARE(data.frameIndex(), qint64(42));
+        QCOMPARE(data.timestampMs(), 1400.0);
+    }
 };
 
 /*******************************************************************************
@@ -389,28 +485,2040 @@ private slots:
 };
 
 /*******************************************************************************
- * Main Test Runner
+ * Test Suite: ImageCache Tests
  ******************************************************************************/
-int main(int argc, char* argv[])
+class ImageCacheTest : public QObject
 {
-    QApplication app(argc, argv);
-    app.setApplicationName("VisionBox Data Types Test");
+    Q_OBJECT
 
-    int result = 0;
+private slots:
+    void init()
+    {
+        ImageCache::instance()->clear();
+        ImageCache::instance()->resetStats();
+        ImageCache::instance()->setCapacityBytes(64 * 1024 * 1024);
+    }
 
+    void testHitAfterFirstDecode()
     {
-        ImageDataTest imageDataTest;
-        result |= QTest::qExec(&imageDataTest, argc, argv);
+        QTemporaryDir dir;
+        QString path = dir.filePath("a.png");
+        QVERIFY(cv::imwrite(path.toStdString(), cv::Mat(32, 48, CV_8UC3, cv::Scalar(1, 2, 3))));
+
+        cv::Mat first = ImageCache::instance()->imread(path);
+        cv::Mat second = ImageCache::instance()->imread(path);
+
+        QVERIFY(!first.empty());
+        QCOMPARE(first.data, second.data);
+
+        ImageCacheStats stats = ImageCache::instance()->stats();
+        QCOMPARE(stats.misses, 1LL);
+        QCOMPARE(stats.hits, 1LL);
+        QCOMPARE(stats.entryCount, 1);
+        QCOMPARE(stats.residentBytes, 32LL * 48 * 3);
     }
 
+    void testFlagsAreSeparateEntries()
     {
-        DetectionDataTest detectionDataTest;
-        result |= QTest::qExec(&detectionDataTest, argc, argv);
+        QTemporaryDir dir;
+        QString path = dir.filePath("b.png");
+        QVERIFY(cv::imwrite(path.toStdString(), cv::Mat(16, 16, CV_8UC3, cv::Scalar(10, 20, 30))));
+
+        cv::Mat color = ImageCache::instance()->imread(path, cv::IMREAD_COLOR);
+        cv::Mat gray = ImageCache::instance()->imread(path, cv::IMREAD_GRAYSCALE);
+
+        QCOMPARE(color.channels(), 3);
+        QCOMPARE(gray.channels(), 1);
+        QCOMPARE(ImageCache::instance()->stats().entryCount, 2);
     }
 
+    void testEvictionWithinBudget()
     {
-        KeypointDataTest keypointDataTest;
-        result |= QTest::qExec(&keypointDataTest, argc, argv);
+        QTemporaryDir dir;
+        const qint64 imageBytes = 64 * 64 * 3;
+        ImageCache::instance()->setCapacityBytes(imageBytes * 2);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            QString path = dir.filePath(QString("c%1.png").arg(i));
+            QVERIFY(cv::imwrite(path.toStdString(), cv::Mat(64, 64, CV_8UC3, cv::Scalar(i))));
+            QVERIFY(!ImageCache::instance()->imread(path).empty());
+        }
+
+        ImageCacheStats stats = ImageCache::instance()->stats();
+        QCOMPARE(stats.entryCount, 2);
+        QCOMPARE(stats.evictions, 1LL);
+        QVERIFY(stats.residentBytes <= stats.capacityBytes);
+    }
+
+    void testMissingFile()
+    {
+        QVERIFY(ImageCache::instance()->imread("/nonexistent/file.png").empty());
+        QCOMPARE(ImageCache::instance()->stats().entryCount, 0);
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: BoundedQueue Tests
+ ******************************************************************************/
+class BoundedQueueTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testFifoOrder()
+    {
+        BoundedQueue<int> queue(4);
+        QVERIFY(queue.push(1));
+        QVERIFY(queue.push(2));
+        QVERIFY(queue.push(3));
+
+        int value = 0;
+        QVERIFY(queue.pop(value));
+        QCOMPARE(value, 1);
+        QVERIFY(queue.pop(value));
+        QCOMPARE(value, 2);
+        QCOMPARE(queue.size(), 1);
+    }
+
+    void testDropOldest()
+    {
+        BoundedQueue<int> queue(2, QueueOverflowPolicy::DropOldest);
+        queue.push(1);
+        queue.push(2);
+        QVERIFY(queue.push(3));
+
+        int value = 0;
+        queue.pop(value);
+        QCOMPARE(value, 2);
+        QCOMPARE(queue.droppedCount(), qint64(1));
+    }
+
+    void testDropNewest()
+    {
+        BoundedQueue<int> queue(2, QueueOverflowPolicy::DropNewest);
+        queue.push(1);
+        queue.push(2);
+        QVERIFY(!queue.push(3));
+
+        int value = 0;
+        queue.pop(value);
+        QCOMPARE(value, 1);
+        QCOMPARE(queue.droppedCount(), qint64(1));
+    }
+
+    void testCloseDrainsRemainingItems()
+    {
+        BoundedQueue<int> queue(8);
+        std::vector<int> consumed;
+        std::thread consumer([&]()
+        {
+            int value = 0;
+            while (queue.pop(value))
+            {
+                consumed.push_back(value);
+            }
+        });
+
+        for (int i = 0; i < 100; ++i)
+        {
+            QVERIFY(queue.push(i)); // Blocks while the consumer catches up
+        }
+        queue.close();
+        consumer.join();
+
+        QCOMPARE(consumed.size(), size_t(100));
+        for (int i = 0; i < 100; ++i)
+        {
+            QCOMPARE(consumed[i], i);
+        }
+        QVERIFY(!queue.push(100));
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: DetectionLog Tests
+ ******************************************************************************/
+class DetectionLogTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testRoundTripAcrossBlocks()
+    {
+        QTemporaryDir dir;
+        QString path = dir.filePath("log.vbdl");
+
+        DetectionLogEncoder encoder(2);
+        QFile file(path);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write(DetectionLogEncoder::fileHeader());
+
+        const QStringList labels = {"person", "car", "dog"};
+        for (int frame = 0; frame < 5; ++frame)
+        {
+            QVector<DetectionData::Detection> detections;
+            for (int i = 0; i < frame; ++i)
+            {
+                detections.append(DetectionData::Detection(
+                    QRectF(0.1 * i, 0.2, 0.25, 0.5), labels[i % 3], 0.5f + 0.1f * i));
+            }
+            std::vector<cv::KeyPoint> keypoints = {cv::KeyPoint(frame, 2.0f, 3.0f)};
+
+            if (encoder.addFrame(100 + frame, frame * 33.0, detections, keypoints))
+            {
+                file.write(encoder.takeBlock());
+            }
+        }
+        file.write(encoder.takeBlock());
+        file.close();
+
+        DetectionLogReader reader;
+        QVERIFY2(reader.open(path), qPrintable(reader.errorString()));
+        QCOMPARE(reader.frameCount(), 5);
+        QCOMPARE(reader.totalDetections(), qint64(0 + 1 + 2 + 3 + 4));
+        QCOMPARE(reader.labels().size(), 3);
+
+        QCOMPARE(reader.frameIndex(3), qint64(103));
+        QCOMPARE(reader.timestampMs(4), 132.0);
+
+        auto detections = reader.detections(4);
+        QCOMPARE(detections.size(), 4);
+        QCOMPARE(detections[3].label, QString("person"));
+        QCOMPARE(detections[2].bbox, QRectF(0.2f, 0.2f, 0.25f, 0.5f));
+        QCOMPARE(detections[1].confidence, 0.6f);
+
+        auto keypoints = reader.keypoints(2);
+        QCOMPARE(keypoints.size(), size_t(1));
+        QCOMPARE(keypoints[0].pt.x, 2.0f);
+        QCOMPARE(keypoints[0].size, 3.0f);
+
+        QVERIFY(reader.detections(5).isEmpty());
+    }
+
+    void testTruncatedTailIsIgnored()
+    {
+        QTemporaryDir dir;
+        QString path = dir.filePath("truncated.vbdl");
+
+        DetectionLogEncoder encoder(1);
+        encoder.addFrame(0, 0.0, {DetectionData::Detection(QRectF(0, 0, 1, 1), "a", 1.0f)});
+        QByteArray first = encoder.takeBlock();
+        encoder.addFrame(1, 1.0, {DetectionData::Detection(QRectF(0, 0, 1, 1), "b", 1.0f)});
+        QByteArray second = encoder.takeBlock();
+
+        QFile file(path);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write(DetectionLogEncoder::fileHeader());
+        file.write(first);
+        file.write(second.left(second.size() / 2));
+        file.close();
+
+        DetectionLogReader reader;
+        QVERIFY(reader.open(path));
+        QCOMPARE(reader.frameCount(), 1);
+        QCOMPARE(reader.detections(0).first().label, QString("a"));
+    }
+
+    void testRejectsForeignFile()
+    {
+        QTemporaryDir dir;
+        QString path = dir.filePath("foreign.bin");
+        QFile file(path);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write(QByteArray(64, 'x'));
+        file.close();
+
+        DetectionLogReader reader;
+        QVERIFY(!reader.open(path));
+        QVERIFY(!reader.isOpen());
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: FlightRecorder Tests
+ ******************************************************************************/
+class FlightRecorderTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init()
+    {
+        FlightRecorder::instance()->clear();
+        FlightRecorder::instance()->setFramesPerNode(4);
+        FlightRecorder::instance()->setCapacityBytes(64LL * 1024 * 1024);
+    }
+
+    void cleanup()
+    {
+        FlightRecorder::instance()->setRecordAll(false);
+        FlightRecorder::instance()->clear();
+    }
+
+    void testIgnoresNodesNotRecorded()
+    {
+        int node = 0;
+        auto image = std::make_shared<ImageData>(cv::Mat(8, 8, CV_8UC1, cv::Scalar(1)));
+        FlightRecorder::instance()->record(&node, "Node", 0, image);
+
+        QTest::qWait(50);
+        QCOMPARE(FlightRecorder::instance()->stats().frames, qint64(0));
+    }
+
+    void testKeepsLastFramesPerNode()
+    {
+        int node = 0;
+        FlightRecorder* recorder = FlightRecorder::instance();
+        recorder->setNodeEnabled(&node, true);
+
+        for (int i = 0; i < 10; ++i)
+        {
+            auto image = std::make_shared<ImageData>(cv::Mat(16, 16, CV_16UC1, cv::Scalar(i)));
+            recorder->record(&node, "Node", 0, image);
+            QTest::qWait(5); // Let the encoder keep up so nothing is skipped
+        }
+
+        QTRY_COMPARE(recorder->stats().frames, qint64(4));
+        QVERIFY(recorder->stats().compressionRatio() > 1.0);
+
+        recorder->removeNode(&node);
+        QCOMPARE(recorder->stats().frames, qint64(0));
+    }
+
+    void testDumpWritesReplayableFiles()
+    {
+        int node = 0;
+        FlightRecorder* recorder = FlightRecorder::instance();
+        recorder->setRecordAll(true);
+
+        cv::Mat frame(4, 6, CV_32FC3, cv::Scalar(0.5f, 1.5f, 2.5f));
+        recorder->record(&node, "Blur Filter", 0, std::make_shared<ImageData>(frame));
+        QTest::qWait(5);
+        recorder->record(&node, "Blur Filter", 0, std::make_shared<ImageData>(frame));
+
+        DetectionData detections;
+        detections.addDetection(QRectF(0.1, 0.1, 0.2, 0.2), "person", 0.9f);
+        recorder->record(&node, "Blur Filter", 1, std::make_shared<DetectionData>(detections));
+
+        QTRY_COMPARE(recorder->stats().frames, qint64(3));
+
+        QTemporaryDir dir;
+        QString error;
+        QCOMPARE(recorder->dump(dir.path(), &error), 3);
+        QVERIFY(error.isEmpty());
+        QVERIFY(QFile::exists(dir.filePath("manifest.json")));
+
+        // One folder per (node, port): an image stack and a detection log
+        QStringList folders = QDir(dir.path()).entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+        QCOMPARE(folders.size(), 2);
+
+        bool foundStack = false;
+        bool foundLog = false;
+        for (const QString& folder : folders)
+        {
+            QDir ringDir(dir.filePath(folder));
+            for (const QString& file : ringDir.entryList(QDir::Files))
+            {
+                if (file.endsWith(".npy"))
+                {
+                    QFile stack(ringDir.filePath(file));
+                    QVERIFY(stack.open(QIODevice::ReadOnly));
+                    QByteArray header = stack.read(128);
+                    QVERIFY(header.contains("'shape': (2, 4, 6, 3)"));
+                    QCOMPARE(stack.size() % 64, qint64((2 * 4 * 6 * 3 * 4) % 64));
+                    foundStack = true;
+                }
+                else if (file.endsWith(".vbdl"))
+                {
+                    DetectionLogReader reader;
+                    QVERIFY(reader.open(ringDir.filePath(file)));
+                    QCOMPARE(reader.frameCount(), 1);
+                    QCOMPARE(reader.detections(0).first().label, QString("person"));
+                    foundLog = true;
+                }
+            }
+        }
+        QVERIFY(foundStack);
+        QVERIFY(foundLog);
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: FrameCodec Tests
+ ******************************************************************************/
+class FrameCodecTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    static bool sameBytes(const cv::Mat& a, const cv::Mat& b)
+    {
+        if (a.size() != b.size() || a.type() != b.type())
+        {
+            return false;
+        }
+        const size_t rowBytes = a.cols * a.elemSize();
+        for (int y = 0; y < a.rows; ++y)
+        {
+            if (std::memcmp(a.ptr(y), b.ptr(y), rowBytes) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private slots:
+    void testRoundTripsEveryDepth()
+    {
+        const int depths[] = {CV_8U, CV_8S, CV_16U, CV_16S, CV_32S, CV_32F, CV_64F, CV_16F};
+        for (int depth : depths)
+        {
+            for (int channels : {1, 3, 4})
+            {
+                // Random bit patterns, so float NaNs and denormals are covered too
+                const int type = CV_MAKETYPE(depth, channels);
+                cv::Mat bits(37, 41 * CV_ELEM_SIZE(type), CV_8UC1);
+                cv::randu(bits, 0, 256);
+                cv::Mat image(37, 41, type, bits.data);
+
+                for (int filters : {int(FrameCodec::NoFilter),
+                                    FrameCodec::DeltaFilter | FrameCodec::ShuffleFilter})
+                {
+                    cv::Mat decoded = FrameCodec::decode(FrameCodec::encode(image, filters));
+                    QVERIFY2(sameBytes(image, decoded),
+                             qPrintable(QString("depth %1, %2 channels").arg(depth).arg(channels)));
+                }
+            }
+        }
+    }
+
+    void testSmoothImagesCompress()
+    {
+        // Multi-chunk 16-bit gradient, like a depth map
+        cv::Mat image(1024, 640, CV_16UC1);
+        for (int y = 0; y < image.rows; ++y)
+        {
+            for (int x = 0; x < image.cols; ++x)
+            {
+                image.at<quint16>(y, x) = static_cast<quint16>(1000 + 3 * x + y);
+            }
+        }
+
+        QByteArray encoded = FrameCodec::encode(image);
+        QVERIFY(encoded.size() < static_cast<int>(image.total() * image.elemSize()) / 4);
+        QVERIFY(sameBytes(image, FrameCodec::decode(encoded)));
+    }
+
+    void testRegionOfInterest()
+    {
+        cv::Mat full(64, 64, CV_32FC3);
+        cv::randu(full, -1.0f, 1.0f);
+        cv::Mat roi = full(cv::Rect(5, 7, 20, 30));
+        QVERIFY(!roi.isContinuous());
+
+        cv::Mat decoded = FrameCodec::decode(FrameCodec::encode(roi));
+        QVERIFY(decoded.isContinuous());
+        QVERIFY(sameBytes(roi, decoded));
+    }
+
+    void testFileAndCache()
+    {
+        QTemporaryDir dir;
+        QString path = dir.filePath("frame.vbf");
+
+        cv::Mat image(48, 64, CV_8UC3, cv::Scalar(10, 20, 30));
+        QVERIFY(FrameCodec::writeFile(path, image));
+        QVERIFY(sameBytes(image, FrameCodec::readFile(path)));
+        QVERIFY(sameBytes(image, ImageCache::instance()->imread(path)));
+    }
+
+    void testRejectsCorruptInput()
+    {
+        cv::Mat image(300, 300, CV_16UC1);
+        cv::randu(image, 0, 64);
+        QByteArray encoded = FrameCodec::encode(image);
+
+        QVERIFY(FrameCodec::decode(QByteArray("not a frame")).empty());
+        QVERIFY(FrameCodec::decode(encoded.left(encoded.size() - 10)).empty());
+
+        QByteArray damaged = encoded;
+        damaged[damaged.size() / 2] = static_cast<char>(damaged[damaged.size() / 2] ^ 0x5A);
+        cv::Mat decoded = FrameCodec::decode(damaged);
+        QVERIFY(decoded.empty() || !sameBytes(image, decoded));
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: NodeStatusCoalescer Tests
+ ******************************************************************************/
+class StatusTestModel : public QtNodes::NodeDelegateModel
+{
+public:
+    QString caption() const override { return "Status Test"; }
+    QString name() const override { return "StatusTestModel"; }
+    unsigned int nPorts(QtNodes::PortType) const override { return 0; }
+    QtNodes::NodeDataType dataType(QtNodes::PortType, QtNodes::PortIndex) const override
+    {
+        return ImageData().type();
+    }
+    std::shared_ptr<QtNodes::NodeData> outData(QtNodes::PortIndex) override { return nullptr; }
+    void setInData(std::shared_ptr<QtNodes::NodeData>, QtNodes::PortIndex) override {}
+    QWidget* embeddedWidget() override { return nullptr; }
+};
+
+class NodeStatusCoalescerTest : public QObject, public ErrorHandlingNode
+{
+    Q_OBJECT
+
+private slots:
+    void init()
+    {
+        NodeStatusCoalescer::instance()->flush();
+    }
+
+    void testRepeatedSuccessAppliedOnce()
+    {
+        StatusTestModel model;
+        for (int i = 0; i < 100; ++i)
+        {
+            QVERIFY(tryOpenCVOperation("noop", []() {}, &model));
+        }
+
+        QCOMPARE(NodeStatusCoalescer::instance()->flush(), 1);
+        QCOMPARE(model.processingStatus(), QtNodes::NodeProcessingStatus::Updated);
+
+        // Unchanged status does not touch the node again
+        QVERIFY(tryOpenCVOperation("noop", []() {}, &model));
+        QCOMPARE(NodeStatusCoalescer::instance()->flush(), 0);
+    }
+
+    void testLatestStatusWins()
+    {
+        StatusTestModel model;
+        QVERIFY(!tryOpenCVOperation("fail", []() { throw std::runtime_error("boom"); }, &model));
+        QVERIFY(tryOpenCVOperation("noop", []() {}, &model));
+
+        QCOMPARE(NodeStatusCoalescer::instance()->flush(), 1);
+        QCOMPARE(model.validationState()._state, QtNodes::NodeValidationState::State::Valid);
+
+        QVERIFY(!tryOpenCVOperation("fail", []() { throw std::runtime_error("boom"); }, &model));
+        QTRY_COMPARE(model.validationState()._state, QtNodes::NodeValidationState::State::Error);
+    }
+
+    void testDeletedNodeIsSkipped()
+    {
+        auto* model = new StatusTestModel();
+        QVERIFY(tryOpenCVOperation("noop", []() {}, model));
+        delete model;
+        QCOMPARE(NodeStatusCoalescer::instance()->flush(), 0);
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: YoloDecoder Tests
+ ******************************************************************************/
+class YoloDecoderTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    // Synthetic [1, rows, 85] head: few rows above the objectness threshold
+    static cv::Mat syntheticOutput(int rows, int numClasses)
+    {
+        int sizes[] = {1, rows, 5 + numClasses};
+        cv::Mat output(3, sizes, CV_32F);
+        cv::Mat flat = output.reshape(1, rows);
+
+        cv::RNG rng(1234);
+        rng.fill(flat, cv::RNG::UNIFORM, 0.0f, 1.0f);
+        for (int r = 0; r < rows; ++r)
+        {
+            float* row = flat.ptr<float>(r);
+            row[4] = (r % 50 == 0) ? rng.uniform(0.5f, 1.0f) : rng.uniform(0.0f, 0.2f);
+        }
+        return output;
+    }
+
+    // Previous per-row cv::Mat + minMaxLoc decoding, kept as the baseline
+    static int referenceDecode(const cv::Mat& output, float threshold, std::vector<cv::Rect>& boxes,
+                               std::vector<float>& scores, std::vector<int>& classIds)
+    {
+        cv::Mat flat = output.reshape(1, output.size[1]);
+        const int numClasses = flat.cols - 5;
+        for (int i = 0; i < flat.rows; ++i)
+        {
+            const float* data = flat.ptr<float>(i);
+            if (data[4] >= threshold)
+            {
+                cv::Mat classScores(1, numClasses, CV_32F, const_cast<float*>(data + 5));
+                cv::Point classIdPoint;
+                double maxScore;
+                cv::minMaxLoc(classScores, 0, &maxScore, 0, &classIdPoint);
+                if (maxScore >= threshold)
+                {
+                    boxes.push_back(cv::Rect(static_cast<int>(data[0] - data[2] / 2),
+                                             static_cast<int>(data[1] - data[3] / 2),
+                                             static_cast<int>(data[2]), static_cast<int>(data[3])));
+                    scores.push_back(static_cast<float>(maxScore));
+                    classIds.push_back(classIdPoint.x);
+                }
+            }
+        }
+        return static_cast<int>(scores.size());
+    }
+
+private slots:
+    void testArgmax()
+    {
+        std::vector<float> values(83, 0.1f);
+        values[77] = 0.9f;
+        values[3] = 0.9f; // First maximum wins, as with minMaxLoc
+        float maxValue = 0.0f;
+        QCOMPARE(YoloDecoder::argmax(values.data(), static_cast<int>(values.size()), maxValue), 3);
+        QCOMPARE(maxValue, 0.9f);
+
+        QCOMPARE(YoloDecoder::argmax(values.data() + 4, 2, maxValue), 0);
+    }
+
+    void testMatchesReferenceDecode()
+    {
+        cv::Mat output = syntheticOutput(2000, 80);
+
+        std::vector<cv::Rect> boxes;
+        std::vector<float> scores;
+        std::vector<int> classIds;
+        int expected = referenceDecode(output, 0.5f, boxes, scores, classIds);
+        QVERIFY(expected > 0);
+
+        YoloDecoder::Params params;
+        params.scoreThreshold = 0.5f;
+        params.multiplyObjectness = false;
+        YoloCandidates candidates;
+        QCOMPARE(YoloDecoder::decode(output, params, candidates), expected);
+
+        for (int i = 0; i < expected; ++i)
+        {
+            QCOMPARE(candidates.classId[i], classIds[i]);
+            QCOMPARE(candidates.score[i], scores[i]);
+            QCOMPARE(candidates.rect(i), boxes[i]);
+        }
+    }
+
+    void testObjectnessScalingAndClipping()
+    {
+        // One row in 640x640 input pixels, mapped to a 1280x720 image
+        int sizes[] = {1, 1, 7};
+        cv::Mat output(3, sizes, CV_32F);
+        float* row = output.ptr<float>();
+        const float values[] = {20.0f, 320.0f, 80.0f, 160.0f, 0.8f, 0.25f, 0.75f};
+        std::copy(values, values + 7, row);
+
+        YoloDecoder::Params params;
+        params.scoreThreshold = 0.5f;
+        params.scaleX = 1280.0f / 640.0f;
+        params.scaleY = 720.0f / 640.0f;
+        params.clipWidth = 1280;
+        params.clipHeight = 720;
+
+        YoloCandidates candidates;
+        QCOMPARE(YoloDecoder::decode(output, params, candidates), 1);
+        QCOMPARE(candidates.classId[0], 1);
+        QCOMPARE(candidates.score[0], 0.8f * 0.75f);
+        QCOMPARE(candidates.x[0], 0.0f);                        // Clipped at the left edge
+        QCOMPARE(candidates.width[0], 40.0f + 80.0f);
+        QCOMPARE(candidates.y[0], 360.0f - 90.0f);
+
+        // Objectness * class below threshold
+        params.scoreThreshold = 0.7f;
+        candidates.clear();
+        QCOMPARE(YoloDecoder::decode(output, params, candidates), 0);
+    }
+
+    /***************************************************************************
+     * Microbenchmarks (run with -tickcounter or -iterations for stable numbers)
+     **************************************************************************/
+    void benchmarkReferenceDecode()
+    {
+        cv::Mat output = syntheticOutput(25200, 80);
+        QBENCHMARK
+        {
+            std::vector<cv::Rect> boxes;
+            std::vector<float> scores;
+            std::vector<int> classIds;
+            referenceDecode(output, 0.25f, boxes, scores, classIds);
+        }
+    }
+
+    void benchmarkVectorizedDecode()
+    {
+        cv::Mat output = syntheticOutput(25200, 80);
+        YoloDecoder::Params params;
+        params.scoreThreshold = 0.25f;
+        params.multiplyObjectness = false;
+        YoloCandidates candidates;
+        QBENCHMARK
+        {
+            candidates.clear();
+            YoloDecoder::decode(output, params, candidates);
+        }
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: DnnNetCache Tests
+ ******************************************************************************/
+class DnnNetCacheTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    // Weightless Darknet network (a single max pool), enough to parse
+    static QString writeTinyConfig(const QTemporaryDir& dir)
+    {
+        QString path = dir.filePath("tiny.cfg");
+        QFile file(path);
+        if (file.open(QIODevice::WriteOnly | QIODevice::Text))
+        {
+            file.write("[net]\nwidth=8\nheight=8\nchannels=3\n\n"
+                       "[maxpool]\nsize=2\nstride=2\n");
+        }
+        return path;
+    }
+
+private slots:
+    void init()
+    {
+        DnnNetCache::instance()->clear();
+    }
+
+    void testSameModelIsShared()
+    {
+        QTemporaryDir dir;
+        QString path = writeTinyConfig(dir);
+
+        auto first = DnnNetCache::instance()->acquire(path);
+        auto second = DnnNetCache::instance()->acquire(path);
+
+        QVERIFY(first);
+        QCOMPARE(first.get(), second.get());
+        QCOMPARE(first->contextCount(), 1);
+        QCOMPARE(DnnNetCache::instance()->networkCount(), 1);
+    }
+
+    void testSequentialLeasesReuseContext()
+    {
+        QTemporaryDir dir;
+        auto network = DnnNetCache::instance()->acquire(writeTinyConfig(dir));
+
+        {
+            SharedDnnNet::Lease lease = network->lease();
+            QVERIFY(lease.isValid());
+            QVERIFY(!lease.net().empty());
+        }
+        {
+            SharedDnnNet::Lease lease = network->lease();
+        }
+        QCOMPARE(network->contextCount(), 1);
+
+        // Held concurrently, the second lease gets its own context
+        SharedDnnNet::Lease a = network->lease();
+        SharedDnnNet::Lease b = network->lease();
+        QCOMPARE(network->contextCount(), 2);
+    }
+
+    void testAddedContextsAreLeasedWithoutParsing()
+    {
+        QTemporaryDir dir;
+        auto network = DnnNetCache::instance()->acquire(writeTinyConfig(dir));
+        network->addContext();
+        QCOMPARE(network->contextCount(), 2);
+
+        SharedDnnNet::Lease a = network->tryLease();
+        SharedDnnNet::Lease b = network->tryLease();
+        QVERIFY(a.isValid());
+        QVERIFY(b.isValid());
+
+        // All busy: tryLease() gives up instead of parsing a third
+        QVERIFY(!network->tryLease().isValid());
+        QCOMPARE(network->contextCount(), 2);
+    }
+
+    void testIdleNetworksAreTrimmed()
+    {
+        QTemporaryDir dir;
+        QString path = writeTinyConfig(dir);
+
+        DnnNetCache::instance()->acquire(path);
+        QCOMPARE(DnnNetCache::instance()->networkCount(), 1);
+
+        DnnNetCache::instance()->clear();
+        QCOMPARE(DnnNetCache::instance()->networkCount(), 0);
+    }
+
+    void testMissingModelThrows()
+    {
+        bool threw = false;
+        try
+        {
+            DnnNetCache::instance()->acquire("/nonexistent/model.onnx");
+        }
+        catch (const cv::Exception&)
+        {
+            threw = true;
+        }
+
+        QVERIFY(threw);
+        QCOMPARE(DnnNetCache::instance()->networkCount(), 0);
+    }
+
+    void testLoaderWarmsUpInBackground()
+    {
+        QTemporaryDir dir;
+
+        DnnModelLoader loader;
+        DnnModelLoader::Result result;
+        int loadedCount = 0;
+        connect(&loader, &DnnModelLoader::loaded, this,
+                [&](const DnnModelLoader::Result& r) { result = r; loadedCount++; });
+
+        DnnModelLoader::Request request;
+        request.modelPath = writeTinyConfig(dir);
+        request.inputSize = cv::Size(8, 8);
+        request.warmupRuns = 2;
+        loader.load(request);
+
+        QVERIFY(loader.isLoading());
+        QTRY_COMPARE_WITH_TIMEOUT(loadedCount, 1, 10000);
+        QVERIFY(!loader.isLoading());
+        QVERIFY(result.error.isEmpty());
+        QVERIFY(result.warning.isEmpty());
+        QVERIFY(result.network);
+        QVERIFY(result.firstRunMs > 0.0);
+
+        // The warmed context is the one handed out next
+        QCOMPARE(result.network->contextCount(), 1);
+    }
+
+    void testLoaderReportsErrors()
+    {
+        DnnModelLoader loader;
+        DnnModelLoader::Result result;
+        int loadedCount = 0;
+        connect(&loader, &DnnModelLoader::loaded, this,
+                [&](const DnnModelLoader::Result& r) { result = r; loadedCount++; });
+
+        DnnModelLoader::Request request;
+        request.modelPath = "/nonexistent/model.onnx";
+        loader.load(request);
+
+        QTRY_COMPARE_WITH_TIMEOUT(loadedCount, 1, 10000);
+        QVERIFY(!result.network);
+        QVERIFY(!result.error.isEmpty());
+    }
+
+    void testLoaderPreparesContexts()
+    {
+        QTemporaryDir dir;
+
+        DnnModelLoader loader;
+        DnnModelLoader::Result result;
+        int loadedCount = 0;
+        connect(&loader, &DnnModelLoader::loaded, this,
+                [&](const DnnModelLoader::Result& r) { result = r; loadedCount++; });
+
+        DnnModelLoader::Request request;
+        request.modelPath = writeTinyConfig(dir);
+        request.warmupRuns = 0;
+        request.contexts = 3;
+        loader.load(request);
+
+        QTRY_COMPARE_WITH_TIMEOUT(loadedCount, 1, 10000);
+        QVERIFY(result.error.isEmpty());
+        QVERIFY(result.warning.isEmpty());
+        QCOMPARE(result.network->contextCount(), 3);
+    }
+
+    void testBatcherSharesOneForward()
+    {
+        QTemporaryDir dir;
+        auto network = DnnNetCache::instance()->acquire(writeTinyConfig(dir));
+        QCOMPARE(DnnBatcher::forNetwork(network).get(), DnnBatcher::forNetwork(network).get());
+
+        DnnBatcher batcher(network);
+        DnnBatcher::BlobParams params;
+        params.inputSize = cv::Size(8, 8);
+        params.scale = 1.0;
+        params.swapRB = false;
+        DnnBatcher::Limits limits;
+        limits.maxBatchSize = 3;
+        limits.maxWaitMs = 5000;
+
+        // Three streams with distinct constant frames
+        std::vector<std::vector<cv::Mat>> outputs(3);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 3; ++i)
+        {
+            threads.emplace_back([&, i]()
+            {
+                cv::Mat frame(8, 8, CV_8UC3, cv::Scalar::all(10 * (i + 1)));
+                outputs[i] = batcher.infer(frame, params, limits);
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        QCOMPARE(batcher.stats().batches, qint64(1));
+        QCOMPARE(batcher.stats().frames, qint64(3));
+
+        // Each stream gets its own slice back
+        for (int i = 0; i < 3; ++i)
+        {
+            QCOMPARE(static_cast<int>(outputs[i].size()), 1);
+            QCOMPARE(outputs[i][0].size[0], 1);
+            QCOMPARE(outputs[i][0].ptr<float>()[0], 10.0f * (i + 1));
+        }
+    }
+
+    void testBatcherSlicesOutputs()
+    {
+        int sizes[] = {2, 3, 4};
+        cv::Mat batched(3, sizes, CV_32F);
+        for (int i = 0; i < 24; ++i)
+        {
+            batched.ptr<float>()[i] = static_cast<float>(i);
+        }
+
+        cv::Mat second = DnnBatcher::sliceOutput(batched, 2, 1);
+        QCOMPARE(second.dims, 3);
+        QCOMPARE(second.size[0], 1);
+        QCOMPARE(second.size[2], 4);
+        QCOMPARE(second.ptr<float>()[0], 12.0f);
+
+        // Darknet-style rows stacked per frame
+        cv::Mat rows(6, 5, CV_32F, cv::Scalar(0));
+        rows.row(3).setTo(7.0f);
+        cv::Mat slice = DnnBatcher::sliceOutput(rows, 2, 1);
+        QCOMPARE(slice.rows, 3);
+        QCOMPARE(slice.at<float>(0, 0), 7.0f);
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: InferencePipeline Tests
+ ******************************************************************************/
+class InferencePipelineTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    // Submits frames 0..count-1, retrying while the pipeline is full
+    static void submitAll(InferencePipeline& pipeline, int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            InferenceFrame frame;
+            frame.scores.push_back(static_cast<float>(i));
+            while (!pipeline.submit(frame))
+            {
+                QThread::msleep(1);
+            }
+        }
+    }
+
+private slots:
+    void testResultsArriveInOrder()
+    {
+        // Two inference workers with uneven durations finish out of order
+        InferencePipeline pipeline(
+            nullptr,
+            [](InferenceFrame& frame)
+            {
+                const int id = static_cast<int>(frame.scores[0]);
+                QThread::msleep(id % 3 == 0 ? 15 : 1);
+            },
+            nullptr);
+
+        std::vector<InferenceFrame> results;
+        connect(&pipeline, &InferencePipeline::resultsReady, this, [&]()
+        {
+            for (InferenceFrame& frame : pipeline.takeResults())
+            {
+                results.push_back(std::move(frame));
+            }
+        });
+
+        InferencePipeline::Config config;
+        config.inferenceWorkers = 2;
+        pipeline.start(config);
+        submitAll(pipeline, 20);
+
+        QTRY_COMPARE_WITH_TIMEOUT(static_cast<int>(results.size()), 20, 10000);
+        for (int i = 0; i < 20; ++i)
+        {
+            QCOMPARE(results[i].sequence, static_cast<quint64>(i));
+            QCOMPARE(results[i].scores[0], static_cast<float>(i));
+        }
+
+        InferencePipelineStats stats = pipeline.stats();
+        QCOMPARE(stats.completed, qint64(20));
+        QCOMPARE(stats.inFlight, 0);
+    }
+
+    void testStagesOverlap()
+    {
+        // Each stage takes 20 ms: sequential would be 60 ms per frame
+        auto stage = [](InferenceFrame&) { QThread::msleep(20); };
+        InferencePipeline pipeline(stage, stage, stage);
+
+        int received = 0;
+        connect(&pipeline, &InferencePipeline::resultsReady, this,
+                [&]() { received += static_cast<int>(pipeline.takeResults().size()); });
+
+        QElapsedTimer timer;
+        timer.start();
+        pipeline.start();
+        submitAll(pipeline, 10);
+        QTRY_COMPARE_WITH_TIMEOUT(received, 10, 10000);
+
+        QVERIFY(timer.elapsed() < 10 * 60);
+        QVERIFY(pipeline.stats().bottleneckMs() >= 15.0);
+    }
+
+    void testFailedStageSkipsLaterStages()
+    {
+        bool postprocessRan = false;
+        InferencePipeline pipeline(
+            nullptr,
+            [](InferenceFrame&) { throw std::runtime_error("forward failed"); },
+            [&](InferenceFrame&) { postprocessRan = true; });
+
+        std::vector<InferenceFrame> results;
+        connect(&pipeline, &InferencePipeline::resultsReady, this,
+                [&]() { results = pipeline.takeResults(); });
+
+        pipeline.start();
+        submitAll(pipeline, 1);
+
+        QTRY_COMPARE_WITH_TIMEOUT(static_cast<int>(results.size()), 1, 10000);
+        QCOMPARE(results[0].error, QString("forward failed"));
+        QVERIFY(!postprocessRan);
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: BlobPreprocessor Tests
+ ******************************************************************************/
+class BlobPreprocessorTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testLetterboxTransform()
+    {
+        BlobPreprocessor::Params params;
+        params.inputSize = cv::Size(640, 640);
+
+        LetterboxTransform t = BlobPreprocessor::transformFor(cv::Size(1280, 720), params);
+        QCOMPARE(t.content, cv::Rect(0, 140, 640, 360));
+        QCOMPARE(t.scaleX(), 0.5f);
+
+        // A box covering the content maps back to the whole image
+        cv::Rect2f box = t.toImage(cv::Rect2f(0, 140, 640, 360));
+        QCOMPARE(box.x, 0.0f);
+        QCOMPARE(box.y, 0.0f);
+        QCOMPARE(box.width, 1280.0f);
+        QCOMPARE(box.height, 720.0f);
+
+        params.letterbox = false;
+        t = BlobPreprocessor::transformFor(cv::Size(1280, 720), params);
+        QCOMPARE(t.content, cv::Rect(0, 0, 640, 640));
+    }
+
+    void testMatchesBlobFromImage()
+    {
+        cv::Mat image(48, 64, CV_8UC3);
+        cv::randu(image, cv::Scalar::all(0), cv::Scalar::all(255));
+
+        BlobPreprocessor::Params params;
+        params.mean = cv::Scalar(10, 20, 30);
+        params.letterbox = false;
+        BlobPreprocessor preprocessor;
+
+        // Same size: no resampling, values must match exactly
+        params.inputSize = image.size();
+        cv::Mat blob = preprocessor.process(image, params);
+        cv::Mat reference = cv::dnn::blobFromImage(image, params.scale, params.inputSize,
+                                                   params.mean, true, false, CV_32F);
+        QCOMPARE(blob.dims, 4);
+        QVERIFY(cv::norm(blob, reference, cv::NORM_INF) < 1e-5);
+
+        // Downscaled: bilinear vs OpenCV's fixed-point resize
+        params.inputSize = cv::Size(32, 24);
+        blob = preprocessor.process(image, params);
+        reference = cv::dnn::blobFromImage(image, params.scale, params.inputSize,
+                                           params.mean, true, false, CV_32F);
+        QVERIFY(cv::norm(blob, reference, cv::NORM_INF) < 2.0 / 255.0);
+    }
+
+    void testPaddingAndBufferReuse()
+    {
+        BlobPreprocessor::Params params;
+        params.inputSize = cv::Size(8, 8);
+        BlobPreprocessor preprocessor;
+
+        cv::Mat image(2, 4, CV_8UC3, cv::Scalar::all(255));
+        cv::Mat blob = preprocessor.process(image, params);
+
+        // 4x2 -> 8x4 centered: rows 0-1 and 6-7 are padding
+        const float* plane = blob.ptr<float>();
+        QCOMPARE(plane[0], 114.0f / 255.0f);
+        QCOMPARE(plane[3 * 8], 1.0f);
+        QCOMPARE(plane[7 * 8], 114.0f / 255.0f);
+
+        // A held blob is never handed out again; a released one is
+        const float* first = blob.ptr<float>();
+        cv::Mat second = preprocessor.process(image, params);
+        QVERIFY(second.ptr<float>() != first);
+
+        blob.release();
+        cv::Mat third = preprocessor.process(image, params);
+        QCOMPARE(third.ptr<float>(), first);
+        QCOMPARE(preprocessor.bufferCount(), 2);
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: TileGrid Tests
+ ******************************************************************************/
+class TileGridTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testTilesCoverFrameWithOverlap()
+    {
+        const cv::Size frame(3840, 2160);
+        std::vector<cv::Rect> tiles = TileGrid::cut(frame, cv::Size(640, 640), 0.2);
+
+        // Step at most 512 px: 8 columns, 4 rows
+        QCOMPARE(static_cast<int>(tiles.size()), 8 * 4);
+
+        cv::Mat covered = cv::Mat::zeros(frame, CV_8U);
+        for (const cv::Rect& tile : tiles)
+        {
+            QCOMPARE(tile.size(), cv::Size(640, 640));
+            QVERIFY((tile & cv::Rect(cv::Point(0, 0), frame)) == tile);
+            covered(tile).setTo(1);
+        }
+        QCOMPARE(cv::countNonZero(covered), frame.area());
+
+        // Last column and row end at the edge; neighbours share >= 20%
+        QCOMPARE(tiles[7].br().x, frame.width);
+        QCOMPARE(tiles.back().br().y, frame.height);
+        for (int i = 1; i < 8; ++i)
+        {
+            QVERIFY(tiles[i - 1].br().x - tiles[i].x >= 128);
+        }
+    }
+
+    void testSmallFrameIsOneTile()
+    {
+        std::vector<cv::Rect> tiles = TileGrid::cut(cv::Size(300, 200), cv::Size(640, 640), 0.2);
+        QCOMPARE(static_cast<int>(tiles.size()), 1);
+        QCOMPARE(tiles[0], cv::Rect(0, 0, 300, 200));
+
+        QVERIFY(TileGrid::cut(cv::Size(), cv::Size(640, 640), 0.2).empty());
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: BoxNms Tests
+ ******************************************************************************/
+class BoxNmsTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    // Low-threshold detector output: jittered boxes around a few hundred
+    // objects, mostly of the object's class. Integer coordinates, so the
+    // kernel and cv::dnn::NMSBoxes see the same boxes.
+    static YoloCandidates syntheticCandidates(int count, int numClasses)
+    {
+        cv::RNG rng(4321);
+        const int objects = 300;
+        std::vector<cv::Rect> centers(objects);
+        std::vector<int> objectClass(objects);
+        for (int o = 0; o < objects; ++o)
+        {
+            centers[o] = cv::Rect(rng.uniform(0, 3700), rng.uniform(0, 2000),
+                                  rng.uniform(16, 140), rng.uniform(16, 140));
+            objectClass[o] = rng.uniform(0, numClasses);
+        }
+
+        YoloCandidates candidates;
+        candidates.reserve(count);
+        for (int i = 0; i < count; ++i)
+        {
+            const int o = rng.uniform(0, objects);
+            const cv::Rect& c = centers[o];
+            candidates.x.push_back(static_cast<float>(c.x + rng.uniform(-12, 13)));
+            candidates.y.push_back(static_cast<float>(c.y + rng.uniform(-12, 13)));
+            candidates.width.push_back(static_cast<float>(c.width + rng.uniform(-10, 11)));
+            candidates.height.push_back(static_cast<float>(c.height + rng.uniform(-10, 11)));
+            candidates.score.push_back(rng.uniform(0.05f, 1.0f));
+            candidates.classId.push_back(rng.uniform(0, 10) == 0 ? rng.uniform(0, numClasses)
+                                                                 : objectClass[o]);
+        }
+        return candidates;
+    }
+
+    static std::vector<cv::Rect> rects(const YoloCandidates& candidates)
+    {
+        std::vector<cv::Rect> boxes(candidates.size());
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            boxes[i] = candidates.rect(i);
+        }
+        return boxes;
+    }
+
+private slots:
+    void testMatchesNmsBoxes()
+    {
+        YoloCandidates candidates = syntheticCandidates(5000, 8);
+        std::vector<cv::Rect> boxes = rects(candidates);
+
+        BoxNms::Params params;
+        params.scoreThreshold = 0.25f;
+        params.iouThreshold = 0.45f;
+
+        // Class-agnostic: same boxes in the same order
+        std::vector<int> expected;
+        cv::dnn::NMSBoxes(boxes, candidates.score, 0.25f, 0.45f, expected);
+
+        std::vector<int> indices;
+        std::vector<float> scores;
+        params.perClass = false;
+        QCOMPARE(BoxNms::run(candidates, params, indices, scores), static_cast<int>(expected.size()));
+        QCOMPARE(indices, expected);
+
+        // Class-aware: the union of NMSBoxes run on each class alone
+        std::vector<int> perClassExpected;
+        for (int classId = 0; classId < 8; ++classId)
+        {
+            std::vector<cv::Rect> classBoxes;
+            std::vector<float> classScores;
+            std::vector<int> classIndex;
+            for (size_t i = 0; i < candidates.size(); ++i)
+            {
+                if (candidates.classId[i] == classId)
+                {
+                    classBoxes.push_back(boxes[i]);
+                    classScores.push_back(candidates.score[i]);
+                    classIndex.push_back(static_cast<int>(i));
+                }
+            }
+            std::vector<int> kept;
+            cv::dnn::NMSBoxes(classBoxes, classScores, 0.25f, 0.45f, kept);
+            for (int k : kept)
+            {
+                perClassExpected.push_back(classIndex[k]);
+            }
+        }
+
+        params.perClass = true;
+        BoxNms::run(candidates, params, indices, scores);
+        QVERIFY(indices.size() > expected.size());
+        QVERIFY(std::is_sorted(scores.begin(), scores.end(), std::greater<float>()));
+        std::sort(indices.begin(), indices.end());
+        std::sort(perClassExpected.begin(), perClassExpected.end());
+        QCOMPARE(indices, perClassExpected);
+    }
+
+    void testSoftNmsAndLimit()
+    {
+        // Two overlapping boxes of one class, one apart, one of another class
+        YoloCandidates candidates;
+        const float values[][6] = {{0, 0, 100, 100, 0.9f, 0},
+                                   {10, 0, 100, 100, 0.8f, 0},
+                                   {0, 0, 100, 100, 0.7f, 1},
+                                   {400, 400, 50, 50, 0.6f, 0}};
+        for (const auto& v : values)
+        {
+            candidates.x.push_back(v[0]);
+            candidates.y.push_back(v[1]);
+            candidates.width.push_back(v[2]);
+            candidates.height.push_back(v[3]);
+            candidates.score.push_back(v[4]);
+            candidates.classId.push_back(static_cast<int>(v[5]));
+        }
+
+        BoxNms::Params params;
+        params.scoreThreshold = 0.1f;
+        params.iouThreshold = 0.5f;
+        std::vector<int> indices;
+        std::vector<float> scores;
+        QCOMPARE(BoxNms::run(candidates, params, indices, scores), 3);
+        QCOMPARE(indices, std::vector<int>({0, 2, 3}));
+
+        // Soft-NMS keeps the overlapping box with a decayed score
+        params.soft = true;
+        QCOMPARE(BoxNms::run(candidates, params, indices, scores), 4);
+        QCOMPARE(indices, std::vector<int>({0, 2, 3, 1}));
+        const float iou = 9000.0f / 11000.0f;
+        QVERIFY(qAbs(scores[3] - 0.8f * std::exp(-iou * iou / params.sigma)) < 1e-5f);
+        QCOMPARE(scores[2], 0.6f);
+
+        params.maxDetections = 2;
+        QCOMPARE(BoxNms::run(candidates, params, indices, scores), 2);
+        QCOMPARE(indices, std::vector<int>({0, 2}));
+    }
+
+    /***************************************************************************
+     * Microbenchmarks (run with -tickcounter or -iterations for stable numbers)
+     **************************************************************************/
+    void benchmarkNmsBoxes_data()
+    {
+        QTest::addColumn<int>("count");
+        QTest::newRow("1k") << 1000;
+        QTest::newRow("10k") << 10000;
+        QTest::newRow("50k") << 50000;
+    }
+
+    void benchmarkNmsBoxes()
+    {
+        QFETCH(int, count);
+        YoloCandidates candidates = syntheticCandidates(count, 80);
+        std::vector<cv::Rect> boxes = rects(candidates);
+        QBENCHMARK
+        {
+            std::vector<int> indices;
+            cv::dnn::NMSBoxes(boxes, candidates.score, 0.25f, 0.45f, indices);
+        }
+    }
+
+    void benchmarkBoxNms_data()
+    {
+        benchmarkNmsBoxes_data();
+    }
+
+    void benchmarkBoxNms()
+    {
+        QFETCH(int, count);
+        YoloCandidates candidates = syntheticCandidates(count, 80);
+        BoxNms::Params params;
+        params.scoreThreshold = 0.25f;
+        params.iouThreshold = 0.45f;
+        std::vector<int> indices;
+        std::vector<float> scores;
+        QBENCHMARK
+        {
+            BoxNms::run(candidates, params, indices, scores);
+        }
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: DetectionCadence Tests
+ ******************************************************************************/
+class DetectionCadenceTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    // Smooth random texture, trackable by optical flow
+    static cv::Mat texturedFrame()
+    {
+        cv::Mat frame(240, 320, CV_8UC3);
+        cv::RNG rng(77);
+        rng.fill(frame, cv::RNG::UNIFORM, 0, 256);
+        cv::GaussianBlur(frame, frame, cv::Size(5, 5), 1.5);
+        return frame;
+    }
+
+private slots:
+    void testKeyframeCadence()
+    {
+        DetectionCadence::Params params;
+        params.interval = 3;
+        DetectionCadence cadence;
+        cadence.setParams(params);
+
+        cv::Mat frame = texturedFrame();
+        QVERIFY(cadence.needsDetection(frame));
+        cadence.setDetections(frame, {cv::Rect(100, 80, 60, 50)});
+
+        // Every third frame is a keyframe
+        QVERIFY(!cadence.needsDetection(frame));
+        QVERIFY(!cadence.needsDetection(frame));
+        QVERIFY(cadence.needsDetection(frame));
+
+        // Result still outstanding (pipelined detector): the next frame is tracked
+        QVERIFY(!cadence.needsDetection(frame));
+        cadence.setDetections(frame, {cv::Rect(100, 80, 60, 50)});
+
+        // Scene change triggers a keyframe at once
+        cv::Mat other(frame.size(), frame.type(), cv::Scalar::all(255));
+        QVERIFY(cadence.needsDetection(other));
+        QCOMPARE(cadence.stats().sceneChanges, qint64(1));
+        QCOMPARE(cadence.stats().keyframes, qint64(3));
+        QCOMPARE(cadence.stats().trackedFrames, qint64(3));
+    }
+
+    void testTrackingFollowsMotion()
+    {
+        cv::Mat frame = texturedFrame();
+        DetectionCadence cadence;
+        QVERIFY(cadence.needsDetection(frame));
+        cadence.setDetections(frame, {cv::Rect(100, 80, 60, 50), cv::Rect(20, 20, 40, 40)});
+
+        // Whole frame moves right by 5 and down by 3
+        cv::Mat shifted;
+        const cv::Mat shift = (cv::Mat_<double>(2, 3) << 1, 0, 5, 0, 1, 3);
+        cv::warpAffine(frame, shifted, shift, frame.size(), cv::INTER_LINEAR, cv::BORDER_REFLECT);
+
+        std::vector<cv::Rect> boxes;
+        std::vector<int> sources;
+        QVERIFY(!cadence.needsDetection(shifted));
+        cadence.track(shifted, boxes, sources);
+        QCOMPARE(sources, std::vector<int>({0, 1}));
+        QVERIFY(qAbs(boxes[0].x - 105) <= 1 && qAbs(boxes[0].y - 83) <= 1);
+        QVERIFY(qAbs(boxes[0].width - 60) <= 1 && qAbs(boxes[0].height - 50) <= 1);
+        QVERIFY(qAbs(boxes[1].x - 25) <= 1 && qAbs(boxes[1].y - 23) <= 1);
+
+        // A frame of another size cannot be tracked
+        cv::Mat resized;
+        cv::resize(frame, resized, cv::Size(160, 120));
+        cadence.track(resized, boxes, sources);
+        QVERIFY(boxes.empty());
+        QVERIFY(cadence.needsDetection(resized));
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: RawFrameFormat Tests
+ ******************************************************************************/
+class RawFrameFormatTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    // 4x3 uint16 frames: 24 bytes each
+    static QJsonObject sidecar()
+    {
+        return QJsonObject{{"width", 4}, {"height", 3}, {"dtype", "uint16"}};
+    }
+
+private slots:
+    void testValidSidecar()
+    {
+        RawFrameLayout layout;
+        QString error;
+        QVERIFY(RawFrameFormat::parseRawSidecar(sidecar(), 100, layout, error));
+        QCOMPARE(layout.type, CV_16UC1);
+        QCOMPARE(layout.frameBytes, qint64(24));
+        QCOMPARE(layout.frameCount, 4);
+
+        // Header, padded stride and an explicit count that fits
+        QJsonObject padded = sidecar();
+        padded["headerBytes"] = 16;
+        padded["frameBytes"] = 32;
+        padded["frameCount"] = 2;
+        QVERIFY(RawFrameFormat::parseRawSidecar(padded, 100, layout, error));
+        QCOMPARE(layout.headerBytes, qint64(16));
+        QCOMPARE(layout.frameBytes, qint64(32));
+        QCOMPARE(layout.frameCount, 2);
+
+        // A stride below the packed frame size is raised to it
+        QJsonObject overlapping = sidecar();
+        overlapping["frameBytes"] = 8;
+        QVERIFY(RawFrameFormat::parseRawSidecar(overlapping, 100, layout, error));
+        QCOMPARE(layout.frameBytes, qint64(24));
+    }
+
+    void testMalformedSidecar_data()
+    {
+        QTest::addColumn<QString>("key");
+        QTest::addColumn<double>("value");
+
+        QTest::newRow("negative header") << "headerBytes" << -8.0;
+        QTest::newRow("fractional header") << "headerBytes" << 2.5;
+        QTest::newRow("header past end") << "headerBytes" << 101.0;
+        QTest::newRow("negative stride") << "frameBytes" << -24.0;
+        QTest::newRow("too many frames") << "frameCount" << 5.0;
+        QTest::newRow("negative count") << "frameCount" << -1.0;
+    }
+
+    void testMalformedSidecar()
+    {
+        QFETCH(QString, key);
+        QFETCH(double, value);
+
+        QJsonObject malformed = sidecar();
+        malformed[key] = value;
+
+        RawFrameLayout layout;
+        QString error;
+        QVERIFY(!RawFrameFormat::parseRawSidecar(malformed, 100, layout, error));
+        QVERIFY(!error.isEmpty());
+    }
+
+    void testMissingDimensions()
+    {
+        RawFrameLayout layout;
+        QString error;
+        QVERIFY(!RawFrameFormat::parseRawSidecar(QJsonObject{{"width", 4}}, 100, layout, error));
+        QVERIFY(!RawFrameFormat::parseRawSidecar(
+            QJsonObject{{"width", 4}, {"height", 3}, {"dtype", "complex64"}}, 100, layout, error));
+    }
+
+    void testNpyHeader()
+    {
+        // Version 1.0 header for three 2x5 float32 frames, padded to 128 bytes
+        QByteArray header = "{'descr': '<f4', 'fortran_order': False, 'shape': (3, 2, 5), }";
+        header = header.leftJustified(128 - 10 - 1, ' ') + '\n';
+        QByteArray file("\x93NUMPY\x01\x00", 8);
+        file.append(char(header.size() & 0xFF));
+        file.append(char(header.size() >> 8));
+        file.append(header);
+        file.append(QByteArray(3 * 2 * 5 * 4, '\0'));
+
+        RawFrameLayout layout;
+        QString error;
+        const uchar* data = reinterpret_cast<const uchar*>(file.constData());
+        QVERIFY(RawFrameFormat::parseNpyHeader(data, file.size(), layout, error));
+        QCOMPARE(layout.headerBytes, qint64(128));
+        QCOMPARE(layout.type, CV_32FC1);
+        QCOMPARE(layout.width, 5);
+        QCOMPARE(layout.height, 2);
+        QCOMPARE(layout.frameCount, 3);
+
+        // A truncated file holds fewer complete frames than the shape says
+        QVERIFY(RawFrameFormat::parseNpyHeader(data, file.size() - 1, layout, error));
+        QCOMPARE(layout.frameCount, 2);
+
+        QVERIFY(!RawFrameFormat::parseNpyHeader(data, 8, layout, error));
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: PatternGenerator Tests
+ ******************************************************************************/
+class PatternGeneratorTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    static PatternGenerator::Params params(PatternGenerator::Pattern pattern,
+                                           double value1, double value2)
+    {
+        PatternGenerator::Params params;
+        params.pattern = pattern;
+        params.width = 333;       // Odd sizes: rows split unevenly across threads
+        params.height = 251;
+        params.value1 = value1;
+        params.value2 = value2;
+        params.random = true;
+        params.seed = 1234;
+        return params;
+    }
+
+private slots:
+    void testThreadCountIndependent_data()
+    {
+        QTest::addColumn<int>("pattern");
+        QTest::addColumn<double>("value1");
+        QTest::addColumn<double>("value2");
+
+        QTest::newRow("gradient") << int(PatternGenerator::GradientDiagonal) << 0.0 << 255.0;
+        QTest::newRow("checkerboard") << int(PatternGenerator::Checkerboard) << 32.0 << 0.0;
+        QTest::newRow("grid") << int(PatternGenerator::Grid) << 64.0 << 2.0;
+        QTest::newRow("circles") << int(PatternGenerator::Circles) << 10.0 << 30.0;
+        QTest::newRow("gaussian noise") << int(PatternGenerator::GaussianNoise) << 128.0 << 30.0;
+        QTest::newRow("uniform noise") << int(PatternGenerator::UniformNoise) << 0.0 << 255.0;
+    }
+
+    void testThreadCountIndependent()
+    {
+        QFETCH(int, pattern);
+        QFETCH(double, value1);
+        QFETCH(double, value2);
+        const PatternGenerator::Params p =
+            params(static_cast<PatternGenerator::Pattern>(pattern), value1, value2);
+
+        const int threads = cv::getNumThreads();
+        cv::setNumThreads(1);
+        const cv::Mat single = PatternGenerator::render(p, 17);
+        cv::setNumThreads(std::max(4, threads));
+        const cv::Mat parallel = PatternGenerator::render(p, 17);
+        const cv::Mat again = PatternGenerator::render(p, 17);
+        cv::setNumThreads(threads);
+
+        QCOMPARE(single.size(), cv::Size(333, 251));
+        QCOMPARE(cv::norm(single, parallel, cv::NORM_INF), 0.0);
+        QCOMPARE(cv::norm(single, again, cv::NORM_INF), 0.0);
+
+        // Another frame of the animation differs
+        QVERIFY(cv::norm(single, PatternGenerator::render(p, 18), cv::NORM_INF) > 0.0);
+    }
+
+    void testSeedChangesNoise()
+    {
+        PatternGenerator::Params p = params(PatternGenerator::UniformNoise, 0.0, 255.0);
+        const cv::Mat first = PatternGenerator::render(p, 0);
+        p.seed++;
+        QVERIFY(cv::norm(first, PatternGenerator::render(p, 0), cv::NORM_INF) > 0.0);
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: ExportNaming Tests
+ ******************************************************************************/
+class ExportNamingTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testTimestampHasMilliseconds()
+    {
+        const QDateTime time(QDate(2025, 1, 27), QTime(14, 30, 0, 123));
+        QCOMPARE(ExportNaming::timestamp(time), QString("20250127_143000_123"));
+    }
+
+    void testUniqueStem()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+
+        // Same second, same prefix: each caller gets its own name
+        const QString first = ExportNaming::uniqueStem(dir.path(), "run", ".csv");
+        const QString second = ExportNaming::uniqueStem(dir.path(), "run", ".csv");
+        QCOMPARE(first, QString("run"));
+        QCOMPARE(second, QString("run_2"));
+
+        // Names taken on disk are skipped as well
+        QFile existing(dir.filePath("dump_000000.png"));
+        QVERIFY(existing.open(QIODevice::WriteOnly));
+        existing.close();
+        QCOMPARE(ExportNaming::uniqueStem(dir.path(), "dump", "_000000.png"), QString("dump_2"));
+
+        // Another extension is another file
+        QCOMPARE(ExportNaming::uniqueStem(dir.path(), "run", ".jsonl"), QString("run"));
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: StreamingFileWriter Tests
+ ******************************************************************************/
+class StreamingFileWriterTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    static QByteArray readAll(const QString& path)
+    {
+        QFile file(path);
+        return file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+    }
+
+    static StreamingFileWriter::Options options(const QTemporaryDir& dir)
+    {
+        StreamingFileWriter::Options options;
+        options.basePath = dir.filePath("log");
+        options.extension = ".csv";
+        options.header = "frame,value\n";
+        return options;
+    }
+
+private slots:
+    void testRotateByRecords()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+
+        StreamingFileWriter::Options opts = options(dir);
+        opts.rotateRecords = 2;
+
+        StreamingFileWriter writer;
+        QVERIFY(writer.start(opts));
+        for (int i = 0; i < 5; ++i)
+        {
+            QVERIFY(writer.append(QByteArray::number(i) + ",x\n"));
+        }
+        writer.stop();
+
+        QCOMPARE(writer.recordsWritten(), qint64(5));
+        QCOMPARE(writer.fileIndex(), 2);
+        QCOMPARE(readAll(dir.filePath("log_000.csv")), QByteArray("frame,value\n0,x\n1,x\n"));
+        QCOMPARE(readAll(dir.filePath("log_001.csv")), QByteArray("frame,value\n2,x\n3,x\n"));
+        QCOMPARE(readAll(dir.filePath("log_002.csv")), QByteArray("frame,value\n4,x\n"));
+        QVERIFY(!writer.append("5,x\n"));
+    }
+
+    void testRotateByBytes()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+
+        // Header (12 bytes) + one 10-byte record reaches the limit
+        StreamingFileWriter::Options opts = options(dir);
+        opts.rotateBytes = 20;
+
+        StreamingFileWriter writer;
+        QVERIFY(writer.start(opts));
+        for (int i = 0; i < 3; ++i)
+        {
+            QVERIFY(writer.append(QByteArray("123456789\n")));
+        }
+        writer.stop();
+
+        QCOMPARE(writer.fileIndex(), 2);
+        for (int i = 0; i < 3; ++i)
+        {
+            QCOMPARE(readAll(dir.filePath(QString("log_00%1.csv").arg(i))),
+                     QByteArray("frame,value\n123456789\n"));
+        }
+    }
+
+    void testAppendResumesExistingFile()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+
+        StreamingFileWriter writer;
+        QVERIFY(writer.start(options(dir)));
+        QVERIFY(writer.append("0,a\n"));
+        writer.stop();
+
+        // A restart appends and does not repeat the header
+        QVERIFY(writer.start(options(dir)));
+        QVERIFY(writer.append("1,b\n"));
+        writer.stop();
+
+        QCOMPARE(writer.currentFilePath(), dir.filePath("log.csv"));
+        QCOMPARE(readAll(dir.filePath("log.csv")), QByteArray("frame,value\n0,a\n1,b\n"));
+        QCOMPARE(writer.recordsWritten(), qint64(1));
+    }
+
+    void testResumeSkipsFullRotationFiles()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+
+        StreamingFileWriter::Options opts = options(dir);
+        opts.rotateBytes = 20;
+
+        StreamingFileWriter writer;
+        QVERIFY(writer.start(opts));
+        QVERIFY(writer.append("123456789\n"));
+        writer.stop();
+
+        // log_000 is full: the resumed run continues in log_001
+        QVERIFY(writer.start(opts));
+        QCOMPARE(writer.fileIndex(), 1);
+        QVERIFY(writer.append("abcdefghi\n"));
+        writer.stop();
+
+        QCOMPARE(readAll(dir.filePath("log_000.csv")), QByteArray("frame,value\n123456789\n"));
+        QCOMPARE(readAll(dir.filePath("log_001.csv")), QByteArray("frame,value\nabcdefghi\n"));
+    }
+
+    void testOpenFailureIsReported()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+
+        // The base path is a directory, so the log file cannot be created
+        QVERIFY(QDir(dir.path()).mkpath("blocked.csv"));
+        StreamingFileWriter::Options opts = options(dir);
+        opts.basePath = dir.filePath("blocked");
+
+        StreamingFileWriter writer;
+        QVERIFY(!writer.start(opts));
+        QVERIFY(!writer.lastError().isEmpty());
+        QVERIFY(!writer.append("0,a\n"));
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: PerformanceTableModel Tests
+ ******************************************************************************/
+class PerformanceTableModelTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    // Stand-ins for node instances; only their addresses matter
+    int m_nodeA = 0;
+    int m_nodeB = 0;
+    int m_nodeC = 0;
+
+private slots:
+    void init()
+    {
+        PerformanceMonitor::instance()->clear();
+    }
+
+    void testRefreshAppliesOnlyChanges()
+    {
+        PerformanceMonitor* monitor = PerformanceMonitor::instance();
+        PerformanceTableModel model;
+        QSignalSpy changed(&model, &QAbstractItemModel::dataChanged);
+        QSignalSpy inserted(&model, &QAbstractItemModel::rowsInserted);
+
+        monitor->recordExecution(&m_nodeA, "A", "Node A", 1000);
+        monitor->recordExecution(&m_nodeB, "B", "Node B", 2000);
+        QCOMPARE(model.refresh(), 2);
+        QCOMPARE(model.rowCount(), 2);
+        QCOMPARE(inserted.count(), 1);
+        QCOMPARE(changed.count(), 0);
+
+        // Unchanged: nothing to apply, no signals
+        QCOMPARE(model.refresh(), 0);
+        QCOMPARE(inserted.count(), 1);
+        QCOMPARE(changed.count(), 0);
+
+        // Changed: only that row is updated
+        monitor->recordExecution(&m_nodeB, "B", "Node B", 4000);
+        QCOMPARE(model.refresh(), 1);
+        QCOMPARE(changed.count(), 1);
+        const int rowB = changed[0][0].value<QModelIndex>().row();
+        QCOMPARE(changed[0][1].value<QModelIndex>().row(), rowB);
+        QCOMPARE(model.rows()[rowB].nodeInstance, static_cast<void*>(&m_nodeB));
+        QCOMPARE(model.rows()[rowB].executionCount, 2);
+        QCOMPARE(model.rows()[rowB].maxExecutionTime, qint64(4000));
+        QCOMPARE(model.rows()[1 - rowB].executionCount, 1);
+
+        // Added: appended, existing rows keep their position
+        monitor->recordMetric(&m_nodeC, "Node C", "queueDepth", 3.0);
+        QCOMPARE(model.refresh(), 1);
+        QCOMPARE(model.rowCount(), 3);
+        QCOMPARE(inserted.count(), 2);
+        QCOMPARE(inserted[1][1].toInt(), 2);
+        QCOMPARE(model.rows()[2].metrics.value("queueDepth"), 3.0);
+        QCOMPARE(model.rows()[rowB].nodeInstance, static_cast<void*>(&m_nodeB));
+        QCOMPARE(changed.count(), 1);
+    }
+
+    void testResetAfterClear()
+    {
+        PerformanceMonitor* monitor = PerformanceMonitor::instance();
+        PerformanceTableModel model;
+
+        monitor->recordExecution(&m_nodeA, "A", "Node A", 1000);
+        monitor->recordExecution(&m_nodeB, "B", "Node B", 1000);
+        QCOMPARE(model.refresh(), 2);
+
+        // Cleared monitor: the view drops every row, then picks up new ones
+        monitor->clear();
+        model.reset();
+        QCOMPARE(model.rowCount(), 0);
+        QCOMPARE(model.refresh(), 0);
+
+        monitor->recordExecution(&m_nodeB, "B", "Node B", 3000);
+        QCOMPARE(model.refresh(), 1);
+        QCOMPARE(model.rowCount(), 1);
+        QCOMPARE(model.rows()[0].nodeInstance, static_cast<void*>(&m_nodeB));
+        QCOMPARE(model.rows()[0].executionCount, 1);
+    }
+};
+
+/*******************************************************************************
+ * Test Suite: BoundingBoxOverlay Tests
+ ******************************************************************************/
+class BoundingBoxOverlayTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    static std::shared_ptr<ImageData> blackFrame()
+    {
+        return std::make_shared<ImageData>(cv::Mat(100, 100, CV_8UC3, cv::Scalar::all(0)));
+    }
+
+    // One unlabeled box (no text drawn), normalized coordinates
+    static std::shared_ptr<DetectionData> detections(const QRectF& box)
+    {
+        auto data = std::make_shared<DetectionData>();
+        data->addDetection(box, QString(), 0.0f);
+        return data;
+    }
+
+    static cv::Mat output(BoundingBoxOverlayModel& model)
+    {
+        return std::static_pointer_cast<ImageData>(model.outData(0))->image();
+    }
+
+    static bool drawnAt(const cv::Mat& image, int x, int y)
+    {
+        return image.at<cv::Vec3b>(y, x) != cv::Vec3b(0, 0, 0);
+    }
+
+private slots:
+    void testDrawsOnlyMatchingPairs()
+    {
+        BoundingBoxOverlayModel model;
+        QSignalSpy updated(&model, &QtNodes::NodeDelegateModel::dataUpdated);
+
+        // Detections first, then their frame: drawn once both are in
+        model.setInData(detections(QRectF(0.25, 0.25, 0.5, 0.5)), 1);
+        QCOMPARE(updated.count(), 0);
+        model.setInData(blackFrame(), 0);
+        QCOMPARE(updated.count(), 1);
+        QVERIFY(drawnAt(output(model), 50, 25));
+
+        // The next frame waits for its own detections
+        model.setInData(blackFrame(), 0);
+        QCOMPARE(updated.count(), 1);
+        model.setInData(detections(QRectF(0.1, 0.1, 0.2, 0.2)), 1);
+        QCOMPARE(updated.count(), 2);
+
+        const cv::Mat image = output(model);
+        QVERIFY(drawnAt(image, 20, 10));
+        QVERIFY(!drawnAt(image, 50, 25));
+    }
+
+    void testDisconnectClearsBoxes()
+    {
+        BoundingBoxOverlayModel model;
+        model.setInData(detections(QRectF(0.25, 0.25, 0.5, 0.5)), 1);
+        model.setInData(blackFrame(), 0);
+        QVERIFY(drawnAt(output(model), 50, 25));
+
+        QSignalSpy updated(&model, &QtNodes::NodeDelegateModel::dataUpdated);
+        model.setInData(nullptr, 1);
+        QCOMPARE(updated.count(), 1);
+        QCOMPARE(cv::countNonZero(output(model).reshape(1)), 0);
+
+        // Images pass straight through while nothing is connected
+        model.setInData(blackFrame(), 0);
+        QCOMPARE(updated.count(), 2);
+        QCOMPARE(cv::countNonZero(output(model).reshape(1)), 0);
+    }
+};
+
+/*******************************************************************************
+ * Main Test Runner
+ ******************************************************************************/
+int main(int argc, char* argv[])
+{
+    QApplication app(argc, argv);
+    app.setApplicationName("VisionBox Data Types Test");
+
+    int result = 0;
+
+    {
+        ImageDataTest imageDataTest;
+        result |= QTest::qExec(&imageDataTest, argc, argv);
+    }
+
+    {
+        DetectionDataTest detectionDataTest;
+        result |= QTest::qExec(&detectionDataTest, argc, argv);
+    }
+
+    {
+        KeypointDataTest keypointDataTest;
+        result |= QTest::qExec(&keypointDataTest, argc, argv);
+    }
+
+    {
+        BoundedQueueTest boundedQueueTest;
+        result |= QTest::qExec(&boundedQueueTest, argc, argv);
+    }
+
+    {
+        ImageCacheTest imageCacheTest;
+        result |= QTest::qExec(&imageCacheTest, argc, argv);
+    }
+
+    {
+        DetectionLogTest detectionLogTest;
+        result |= QTest::qExec(&detectionLogTest, argc, argv);
+    }
+
+    {
+        FlightRecorderTest flightRecorderTest;
+        result |= QTest::qExec(&flightRecorderTest, argc, argv);
+    }
+
+    {
+        FrameCodecTest frameCodecTest;
+        result |= QTest::qExec(&frameCodecTest, argc, argv);
+    }
+
+    {
+        NodeStatusCoalescerTest nodeStatusCoalescerTest;
+        result |= QTest::qExec(&nodeStatusCoalescerTest, argc, argv);
+    }
+
+    {
+        YoloDecoderTest yoloDecoderTest;
+        result |= QTest::qExec(&yoloDecoderTest, argc, argv);
+    }
+
+    {
+        DnnNetCacheTest dnnNetCacheTest;
+        result |= QTest::qExec(&dnnNetCacheTest, argc, argv);
+    }
+
+    {
+        InferencePipelineTest inferencePipelineTest;
+        result |= QTest::qExec(&inferencePipelineTest, argc, argv);
+    }
+
+    {
+        BlobPreprocessorTest blobPreprocessorTest;
+        result |= QTest::qExec(&blobPreprocessorTest, argc, argv);
+    }
+
+    {
+        TileGridTest tileGridTest;
+        result |= QTest::qExec(&tileGridTest, argc, argv);
+    }
+
+    {
+        BoxNmsTest boxNmsTest;
+        result |= QTest::qExec(&boxNmsTest, argc, argv);
+    }
+
+    {
+        DetectionCadenceTest detectionCadenceTest;
+        result |= QTest::qExec(&detectionCadenceTest, argc, argv);
+    }
+
+    {
+        RawFrameFormatTest rawFrameFormatTest;
+        result |= QTest::qExec(&rawFrameFormatTest, argc, argv);
+    }
+
+    {
+        PatternGeneratorTest patternGeneratorTest;
+        result |= QTest::qExec(&patternGeneratorTest, argc, argv);
+    }
+
+    {
+        ExportNamingTest exportNamingTest;
+        result |= QTest::qExec(&exportNamingTest, argc, argv);
+    }
+
+    {
+        StreamingFileWriterTest streamingFileWriterTest;
+        result |= QTest::qExec(&streamingFileWriterTest, argc, argv);
+    }
+
+    {
+        PerformanceTableModelTest performanceTableModelTest;
+        result |= QTest::qExec(&performanceTableModelTest, argc, argv);
+    }
+
+    {
+        BoundingBoxOverlayTest boundingBoxOverlayTest;
+        result |= QTest::qExec(&boundingBoxOverlayTest, argc, argv);
     }
 
     return result;